@@ -39,6 +39,46 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayBufferCre
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayCreate
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    arrayCreateFromBooleans
+ * Signature: (J[Z)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayCreateFromBooleans
+  (JNIEnv *, jobject, jlong, jbooleanArray);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    arrayCreateFromDoubles
+ * Signature: (J[D)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayCreateFromDoubles
+  (JNIEnv *, jobject, jlong, jdoubleArray);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    arrayCreateFromIntegers
+ * Signature: (J[I)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayCreateFromIntegers
+  (JNIEnv *, jobject, jlong, jintArray);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    arrayCreateFromLongs
+ * Signature: (J[J)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayCreateFromLongs
+  (JNIEnv *, jobject, jlong, jlongArray);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    arrayCreateFromStrings
+ * Signature: (J[Ljava/lang/String;)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayCreateFromStrings
+  (JNIEnv *, jobject, jlong, jobjectArray);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    arrayGetLength
@@ -55,6 +95,38 @@ JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_arrayGetLength
 JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_await
   (JNIEnv *, jobject, jlong, jint);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    backingStoreAttach
+ * Signature: (JJ)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_backingStoreAttach
+  (JNIEnv *, jobject, jlong, jlong);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    backingStoreCreate
+ * Signature: (Ljava/nio/ByteBuffer;IZ)J
+ */
+JNIEXPORT jlong JNICALL Java_com_caoccao_javet_interop_V8Native_backingStoreCreate
+  (JNIEnv *, jobject, jobject, jint, jboolean);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    backingStoreGetByteBuffer
+ * Signature: (J)Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_backingStoreGetByteBuffer
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    backingStoreRelease
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_backingStoreRelease
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    batchArrayGet
@@ -63,6 +135,46 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_await
 JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGet
   (JNIEnv *, jobject, jlong, jlong, jint, jobjectArray, jint, jint);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    batchArrayGetBooleans
+ * Signature: (JJI[Z[ZII)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGetBooleans
+  (JNIEnv *, jobject, jlong, jlong, jint, jbooleanArray, jbooleanArray, jint, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    batchArrayGetDoubles
+ * Signature: (JJI[D[ZII)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGetDoubles
+  (JNIEnv *, jobject, jlong, jlong, jint, jdoubleArray, jbooleanArray, jint, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    batchArrayGetIntegers
+ * Signature: (JJI[I[ZII)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGetIntegers
+  (JNIEnv *, jobject, jlong, jlong, jint, jintArray, jbooleanArray, jint, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    batchArrayGetLongs
+ * Signature: (JJI[J[ZII)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGetLongs
+  (JNIEnv *, jobject, jlong, jlong, jint, jlongArray, jbooleanArray, jint, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    batchArrayGetStrings
+ * Signature: (JJI[Ljava/lang/String;II)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGetStrings
+  (JNIEnv *, jobject, jlong, jlong, jint, jobjectArray, jint, jint);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    batchObjectGet
@@ -71,6 +183,54 @@ JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGet
 JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGet
   (JNIEnv *, jobject, jlong, jlong, jint, jobjectArray, jobjectArray, jint);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    batchObjectGetBooleans
+ * Signature: (JJI[Ljava/lang/Object;[Z[ZI)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGetBooleans
+  (JNIEnv *, jobject, jlong, jlong, jint, jobjectArray, jbooleanArray, jbooleanArray, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    batchObjectGetDoubles
+ * Signature: (JJI[Ljava/lang/Object;[D[ZI)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGetDoubles
+  (JNIEnv *, jobject, jlong, jlong, jint, jobjectArray, jdoubleArray, jbooleanArray, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    batchObjectGetIntegers
+ * Signature: (JJI[Ljava/lang/Object;[I[ZI)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGetIntegers
+  (JNIEnv *, jobject, jlong, jlong, jint, jobjectArray, jintArray, jbooleanArray, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    batchObjectGetLongs
+ * Signature: (JJI[Ljava/lang/Object;[J[ZI)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGetLongs
+  (JNIEnv *, jobject, jlong, jlong, jint, jobjectArray, jlongArray, jbooleanArray, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    batchObjectGetStrings
+ * Signature: (JJI[Ljava/lang/Object;[Ljava/lang/String;I)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGetStrings
+  (JNIEnv *, jobject, jlong, jlong, jint, jobjectArray, jobjectArray, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    batchSetAdd
+ * Signature: (JJI[Ljava/lang/Object;I)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchSetAdd
+  (JNIEnv *, jobject, jlong, jlong, jint, jobjectArray, jint);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    booleanObjectCreate
@@ -207,6 +367,22 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_equals
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_errorCreate
   (JNIEnv *, jobject, jlong, jint, jstring);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    externalSourceCreate
+ * Signature: (Ljava/nio/ByteBuffer;Z)J
+ */
+JNIEXPORT jlong JNICALL Java_com_caoccao_javet_interop_V8Native_externalSourceCreate
+  (JNIEnv *, jobject, jobject, jboolean);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    externalSourceRelease
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_externalSourceRelease
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    functionCall
@@ -234,10 +410,10 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_functionCanDi
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    functionCompile
- * Signature: (JLjava/lang/String;[BLjava/lang/String;IIIZ[Ljava/lang/String;[Ljava/lang/Object;)Ljava/lang/Object;
+ * Signature: (JLjava/lang/Object;[BLjava/lang/String;IIIZ[Ljava/lang/String;[Ljava/lang/Object;)Ljava/lang/Object;
  */
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_functionCompile
-  (JNIEnv *, jobject, jlong, jstring, jbyteArray, jstring, jint, jint, jint, jboolean, jobjectArray, jobjectArray);
+  (JNIEnv *, jobject, jlong, jobject, jbyteArray, jstring, jint, jint, jint, jboolean, jobjectArray, jobjectArray);
 
 /*
  * Class:     com_caoccao_javet_interop_V8Native
@@ -399,6 +575,14 @@ JNIEXPORT jlongArray JNICALL Java_com_caoccao_javet_interop_V8Native_getInternal
 JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_getPriority
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    getV8ArrayBufferStatistics
+ * Signature: (J)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8ArrayBufferStatistics
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    getV8HeapSpaceStatistics
@@ -415,6 +599,14 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8HeapSpace
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8HeapStatistics
   (JNIEnv *, jobject, jlong);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    getV8PropertyKeyCacheStatistics
+ * Signature: (J)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8PropertyKeyCacheStatistics
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    getV8SharedMemoryStatistics
@@ -423,6 +615,14 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8HeapStati
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8SharedMemoryStatistics
   (JNIEnv *, jobject);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    getV8UnboundScriptCacheStatistics
+ * Signature: (J)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8UnboundScriptCacheStatistics
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    getVersion
@@ -535,6 +735,30 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_isMemorySaver
 JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_isWeak
   (JNIEnv *, jobject, jlong, jlong, jint);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    jsonParse
+ * Signature: (JLjava/nio/ByteBuffer;II)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_jsonParse
+  (JNIEnv *, jobject, jlong, jobject, jint, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    jsonStringify
+ * Signature: (JJILjava/nio/ByteBuffer;II)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_jsonStringify
+  (JNIEnv *, jobject, jlong, jlong, jint, jobject, jint, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    jsonStringifyGrowable
+ * Signature: (JJILjava/nio/ByteBuffer;II)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_jsonStringifyGrowable
+  (JNIEnv *, jobject, jlong, jlong, jint, jobject, jint, jint);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    lockV8Runtime
@@ -666,9 +890,9 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_mapHas
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    mapSet
- * Signature: (JJI[Ljava/lang/Object;)Z
+ * Signature: (JJI[Ljava/lang/Object;)I
  */
-JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_mapSet
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_mapSet
   (JNIEnv *, jobject, jlong, jlong, jint, jobjectArray);
 
 /*
@@ -730,10 +954,10 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_mapSetUndefin
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    moduleCompile
- * Signature: (JLjava/lang/String;[BZLjava/lang/String;IIIZZ)Ljava/lang/Object;
+ * Signature: (JLjava/lang/Object;[BZLjava/lang/String;IIIZZ)Ljava/lang/Object;
  */
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_moduleCompile
-  (JNIEnv *, jobject, jlong, jstring, jbyteArray, jboolean, jstring, jint, jint, jint, jboolean, jboolean);
+  (JNIEnv *, jobject, jlong, jobject, jbyteArray, jboolean, jstring, jint, jint, jint, jboolean, jboolean);
 
 /*
  * Class:     com_caoccao_javet_interop_V8Native
@@ -754,10 +978,10 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_moduleEvaluate
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    moduleExecute
- * Signature: (JLjava/lang/String;[BZLjava/lang/String;IIIZ)Ljava/lang/Object;
+ * Signature: (JLjava/lang/Object;[BZLjava/lang/String;IIIZ)Ljava/lang/Object;
  */
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_moduleExecute
-  (JNIEnv *, jobject, jlong, jstring, jbyteArray, jboolean, jstring, jint, jint, jint, jboolean);
+  (JNIEnv *, jobject, jlong, jobject, jbyteArray, jboolean, jstring, jint, jint, jint, jboolean);
 
 /*
  * Class:     com_caoccao_javet_interop_V8Native
@@ -1010,9 +1234,9 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_objectIsSeale
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    objectSet
- * Signature: (JJI[Ljava/lang/Object;)Z
+ * Signature: (JJI[Ljava/lang/Object;)I
  */
-JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_objectSet
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_objectSet
   (JNIEnv *, jobject, jlong, jlong, jint, jobjectArray);
 
 /*
@@ -1287,6 +1511,14 @@ JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_removeRawPointer
 JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_removeReferenceHandle
   (JNIEnv *, jobject, jlong, jlong, jint);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    removeReferenceHandles
+ * Signature: (J[JI)V
+ */
+JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_removeReferenceHandles
+  (JNIEnv *, jobject, jlong, jlongArray, jint);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    reportPendingMessages
@@ -1330,18 +1562,18 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_sameValue
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    scriptCompile
- * Signature: (JLjava/lang/String;[BZLjava/lang/String;IIIZZ)Ljava/lang/Object;
+ * Signature: (JLjava/lang/Object;[BZLjava/lang/String;IIIZZI[I)Ljava/lang/Object;
  */
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_scriptCompile
-  (JNIEnv *, jobject, jlong, jstring, jbyteArray, jboolean, jstring, jint, jint, jint, jboolean, jboolean);
+  (JNIEnv *, jobject, jlong, jobject, jbyteArray, jboolean, jstring, jint, jint, jint, jboolean, jboolean, jint, jintArray);
 
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    scriptExecute
- * Signature: (JLjava/lang/String;[BZLjava/lang/String;IIIZ)Ljava/lang/Object;
+ * Signature: (JLjava/lang/Object;[BZLjava/lang/String;IIIZI[I)Ljava/lang/Object;
  */
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_scriptExecute
-  (JNIEnv *, jobject, jlong, jstring, jbyteArray, jboolean, jstring, jint, jint, jint, jboolean);
+  (JNIEnv *, jobject, jlong, jobject, jbyteArray, jboolean, jstring, jint, jint, jint, jboolean, jint, jintArray);
 
 /*
  * Class:     com_caoccao_javet_interop_V8Native
@@ -1351,6 +1583,14 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_scriptExecute
 JNIEXPORT jbyteArray JNICALL Java_com_caoccao_javet_interop_V8Native_scriptGetCachedData
   (JNIEnv *, jobject, jlong, jlong, jint);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    scriptGetCompileHints
+ * Signature: (JJI)[I
+ */
+JNIEXPORT jintArray JNICALL Java_com_caoccao_javet_interop_V8Native_scriptGetCompileHints
+  (JNIEnv *, jobject, jlong, jlong, jint);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    scriptGetResourceName
@@ -1367,6 +1607,38 @@ JNIEXPORT jstring JNICALL Java_com_caoccao_javet_interop_V8Native_scriptGetResou
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_scriptRun
   (JNIEnv *, jobject, jlong, jlong, jint, jboolean);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    scriptStreamingCreate
+ * Signature: (JLjava/io/InputStream;II[I)J
+ */
+JNIEXPORT jlong JNICALL Java_com_caoccao_javet_interop_V8Native_scriptStreamingCreate
+  (JNIEnv *, jobject, jlong, jobject, jint, jint, jintArray);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    scriptStreamingFinish
+ * Signature: (JJLjava/lang/String;III)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_scriptStreamingFinish
+  (JNIEnv *, jobject, jlong, jlong, jstring, jint, jint, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    scriptStreamingRelease
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_scriptStreamingRelease
+  (JNIEnv *, jobject, jlong, jlong);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    scriptStreamingRun
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_scriptStreamingRun
+  (JNIEnv *, jobject, jlong);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    setAdd
@@ -1551,6 +1823,30 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_throwError__J
 JNIEXPORT jstring JNICALL Java_com_caoccao_javet_interop_V8Native_toString
   (JNIEnv *, jobject, jlong, jlong, jint);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    typedArrayGetByteBuffer
+ * Signature: (JJI)Ljava/nio/ByteBuffer;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_typedArrayGetByteBuffer
+  (JNIEnv *, jobject, jlong, jlong, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    typedArrayGetRegion
+ * Signature: (JJILjava/lang/Object;III)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_typedArrayGetRegion
+  (JNIEnv *, jobject, jlong, jlong, jint, jobject, jint, jint, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    typedArraySetRegion
+ * Signature: (JJILjava/lang/Object;III)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_typedArraySetRegion
+  (JNIEnv *, jobject, jlong, jlong, jint, jobject, jint, jint, jint);
+
 /*
  * Class:     com_caoccao_javet_interop_V8Native
  * Method:    unlockV8Runtime
@@ -1591,6 +1887,22 @@ JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_unregisterNearHea
 JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_v8InspectorSend
   (JNIEnv *, jobject, jlong, jstring);
 
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    valueDeserialize
+ * Signature: (JLjava/nio/ByteBuffer;I)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_valueDeserialize
+  (JNIEnv *, jobject, jlong, jobject, jint);
+
+/*
+ * Class:     com_caoccao_javet_interop_V8Native
+ * Method:    valueSerialize
+ * Signature: (JJILjava/nio/ByteBuffer;)I
+ */
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_valueSerialize
+  (JNIEnv *, jobject, jlong, jlong, jint, jobject);
+
 #ifdef __cplusplus
 }
 #endif
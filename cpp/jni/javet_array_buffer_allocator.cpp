@@ -0,0 +1,194 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include "javet_array_buffer_allocator.h"
+#include "javet_constants.h"
+
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <sys/mman.h>
+#define ENABLE_HUGE_PAGE
+#endif
+
+namespace Javet {
+    namespace ArrayBufferAllocator {
+        static jclass jclassV8ArrayBufferStatistics;
+        static jmethodID jmethodIDV8ArrayBufferStatisticsConstructor;
+
+        void Initialize(JNIEnv* jniEnv) noexcept {
+            jclassV8ArrayBufferStatistics = FIND_CLASS(jniEnv, "com/caoccao/javet/interop/monitoring/V8ArrayBufferStatistics");
+            jmethodIDV8ArrayBufferStatisticsConstructor = jniEnv->GetMethodID(jclassV8ArrayBufferStatistics, "<init>", "(JJJJJJJJ)V");
+        }
+
+        static inline size_t GetSizeClassIndex(size_t length) noexcept {
+            size_t index = 0;
+            size_t size = (size_t)1 << SIZE_CLASS_MIN_SHIFT;
+            while (size < length) {
+                size <<= 1;
+                ++index;
+            }
+            return index;
+        }
+
+        static inline size_t GetSizeClassSize(size_t index) noexcept {
+            return (size_t)1 << (SIZE_CLASS_MIN_SHIFT + index);
+        }
+
+#ifdef ENABLE_HUGE_PAGE
+        static inline size_t GetHugePageAlignedSize(size_t length) noexcept {
+            return (length + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        }
+#endif
+
+        JavetArrayBufferAllocator::JavetArrayBufferAllocator(
+            const size_t maxAllocatedBytes, const size_t maxPooledBytes) noexcept
+            : allocatedBytes(0), allocationCount(0), hugePageBytes(0),
+            maxAllocatedBytes(maxAllocatedBytes), maxPooledBytes(maxPooledBytes),
+            peakAllocatedBytes(0), poolHitCount(0), pooledBytes(0), rejectionCount(0) {
+        }
+
+        void* JavetArrayBufferAllocator::Allocate(size_t length) {
+            return AllocateInternal(length, true);
+        }
+
+        void* JavetArrayBufferAllocator::AllocateInternal(size_t length, bool initialized) noexcept {
+            if (!Reserve(length)) {
+                // V8 turns the null pointer into a RangeError in JavaScript.
+                return nullptr;
+            }
+            void* data = nullptr;
+            if (length <= SIZE_CLASS_MAX_SIZE) {
+                size_t index = GetSizeClassIndex(length);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!pools[index].empty()) {
+                        data = pools[index].back();
+                        pools[index].pop_back();
+                        pooledBytes -= GetSizeClassSize(index);
+                        ++poolHitCount;
+                    }
+                }
+                if (data == nullptr) {
+                    data = std::malloc(GetSizeClassSize(index));
+                }
+                if (data != nullptr && initialized) {
+                    std::memset(data, 0, length);
+                }
+            }
+#ifdef ENABLE_HUGE_PAGE
+            else if (length >= HUGE_PAGE_SIZE) {
+                size_t alignedSize = GetHugePageAlignedSize(length);
+                // Anonymous mappings are zero-filled, so there is no difference between initialized and uninitialized.
+                data = mmap(nullptr, alignedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (data == MAP_FAILED) {
+                    data = nullptr;
+                }
+                else {
+                    madvise(data, alignedSize, MADV_HUGEPAGE);
+                    hugePageBytes += alignedSize;
+                }
+            }
+#endif
+            else {
+                data = initialized ? std::calloc(length, 1) : std::malloc(length);
+            }
+            if (data == nullptr) {
+                allocatedBytes -= length;
+                ++rejectionCount;
+                return nullptr;
+            }
+            ++allocationCount;
+            return data;
+        }
+
+        void* JavetArrayBufferAllocator::AllocateUninitialized(size_t length) {
+            return AllocateInternal(length, false);
+        }
+
+        void JavetArrayBufferAllocator::Free(void* data, size_t length) {
+            if (data == nullptr) {
+                return;
+            }
+            allocatedBytes -= length;
+            if (length <= SIZE_CLASS_MAX_SIZE) {
+                size_t index = GetSizeClassIndex(length);
+                size_t size = GetSizeClassSize(index);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (pooledBytes + size <= maxPooledBytes) {
+                        pools[index].push_back(data);
+                        pooledBytes += size;
+                        return;
+                    }
+                }
+                std::free(data);
+            }
+#ifdef ENABLE_HUGE_PAGE
+            else if (length >= HUGE_PAGE_SIZE) {
+                size_t alignedSize = GetHugePageAlignedSize(length);
+                munmap(data, alignedSize);
+                hugePageBytes -= alignedSize;
+            }
+#endif
+            else {
+                std::free(data);
+            }
+        }
+
+        jobject JavetArrayBufferAllocator::GetStatistics(JNIEnv* jniEnv) const noexcept {
+            return jniEnv->NewObject(
+                jclassV8ArrayBufferStatistics,
+                jmethodIDV8ArrayBufferStatisticsConstructor,
+                static_cast<jlong>(allocatedBytes.load()),
+                static_cast<jlong>(allocationCount.load()),
+                static_cast<jlong>(hugePageBytes.load()),
+                static_cast<jlong>(maxAllocatedBytes),
+                static_cast<jlong>(peakAllocatedBytes.load()),
+                static_cast<jlong>(poolHitCount.load()),
+                static_cast<jlong>(pooledBytes.load()),
+                static_cast<jlong>(rejectionCount.load()));
+        }
+
+        bool JavetArrayBufferAllocator::Reserve(size_t length) noexcept {
+            size_t currentBytes = allocatedBytes.load();
+            size_t newBytes;
+            do {
+                newBytes = currentBytes + length;
+                if (maxAllocatedBytes > 0 && (newBytes > maxAllocatedBytes || newBytes < currentBytes)) {
+                    ++rejectionCount;
+                    return false;
+                }
+            } while (!allocatedBytes.compare_exchange_weak(currentBytes, newBytes));
+            size_t peakBytes = peakAllocatedBytes.load();
+            while (newBytes > peakBytes && !peakAllocatedBytes.compare_exchange_weak(peakBytes, newBytes)) {
+            }
+            return true;
+        }
+
+        JavetArrayBufferAllocator::~JavetArrayBufferAllocator() {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto& pool : pools) {
+                for (auto data : pool) {
+                    std::free(data);
+                }
+                pool.clear();
+            }
+            pooledBytes = 0;
+        }
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#pragma once
+
+#include <jni.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "javet_v8.h"
+
+namespace Javet {
+    namespace ArrayBufferAllocator {
+        // Small buffers are rounded up to a power of two between 64 bytes and 64 KB.
+        constexpr size_t SIZE_CLASS_MIN_SHIFT = 6;
+        constexpr size_t SIZE_CLASS_MAX_SHIFT = 16;
+        constexpr size_t SIZE_CLASS_COUNT = SIZE_CLASS_MAX_SHIFT - SIZE_CLASS_MIN_SHIFT + 1;
+        constexpr size_t SIZE_CLASS_MAX_SIZE = (size_t)1 << SIZE_CLASS_MAX_SHIFT;
+        // Large buffers are mapped directly and advised to be backed by huge pages where supported.
+        constexpr size_t HUGE_PAGE_SIZE = (size_t)2 << 20;
+
+        void Initialize(JNIEnv* jniEnv) noexcept;
+
+        /*
+         * The Javet array buffer allocator is created per V8 runtime.
+         * It keeps freed small buffers in size class pools up to a configurable amount,
+         * counts the bytes held by array buffers of the runtime,
+         * and fails the allocation cleanly when the configurable cap would be exceeded.
+         * It may be called from any thread because V8 frees backing stores on background threads.
+         */
+        class JavetArrayBufferAllocator final : public V8ArrayBufferAllocator {
+        public:
+            JavetArrayBufferAllocator(const size_t maxAllocatedBytes, const size_t maxPooledBytes) noexcept;
+
+            void* Allocate(size_t length) override;
+            void* AllocateUninitialized(size_t length) override;
+            void Free(void* data, size_t length) override;
+
+            jobject GetStatistics(JNIEnv* jniEnv) const noexcept;
+
+            virtual ~JavetArrayBufferAllocator();
+
+        private:
+            std::atomic<size_t> allocatedBytes;
+            std::atomic<size_t> allocationCount;
+            std::atomic<size_t> hugePageBytes;
+            const size_t maxAllocatedBytes;
+            const size_t maxPooledBytes;
+            std::mutex mutex;
+            std::atomic<size_t> peakAllocatedBytes;
+            std::atomic<size_t> poolHitCount;
+            std::vector<void*> pools[SIZE_CLASS_COUNT];
+            std::atomic<size_t> pooledBytes;
+            std::atomic<size_t> rejectionCount;
+
+            void* AllocateInternal(size_t length, bool initialized) noexcept;
+            bool Reserve(size_t length) noexcept;
+        };
+    }
+}
@@ -15,6 +15,7 @@
  *   limitations under the License.
  */
 
+#include <type_traits>
 #include "javet_callbacks.h"
 #include "javet_converter.h"
 #include "javet_exceptions.h"
@@ -25,6 +26,9 @@
 namespace Javet {
     namespace Callback {
         jclass jclassJavetCallbackContext;
+        jmethodID jmethodIDJavetCallbackContextGetCallbackReceiver;
+        jmethodID jmethodIDJavetCallbackContextGetPrimitiveSignature;
+        jmethodID jmethodIDJavetCallbackContextIsFastCall;
         jmethodID jmethodIDJavetCallbackContextIsReturnResult;
         jmethodID jmethodIDJavetCallbackContextIsThisObjectRequired;
         jmethodID jmethodIDJavetCallbackContextSetHandle;
@@ -35,21 +39,31 @@ namespace Javet {
         jclass jclassIV8ValueReference;
         jmethodID jmethodIDIV8ValueReferenceClose;
 
+        jclass jclassJavetPrimitiveSignature;
+        jmethodID jmethodIDJavetPrimitiveSignatureGetMethod;
+        jmethodID jmethodIDJavetPrimitiveSignatureGetParameterTypes;
+        jmethodID jmethodIDJavetPrimitiveSignatureGetReturnType;
+
         jclass jclassJavetResourceUtils;
         jmethodID jmethodIDJavetResourceUtilsSafeClose;
 
+        jclass jclassMethod;
+        jmethodID jmethodIDMethodGetDeclaringClass;
+
         jclass jclassV8FunctionCallback;
         jmethodID jmethodIDV8FunctionCallbackReceiveCallback;
 
         jclass jclassV8Runtime;
-        jmethodID jmethodIDV8RuntimeGetCallbackContext;
         jmethodID jmethodIDV8RuntimeGetV8Module;
+        jmethodID jmethodIDV8RuntimeReceiveCodeCacheRejectedCallback;
         jmethodID jmethodIDV8RuntimeReceiveGCEpilogueCallback;
         jmethodID jmethodIDV8RuntimeReceiveGCPrologueCallback;
         jmethodID jmethodIDV8RuntimeReceiveNearHeapLimitCallback;
         jmethodID jmethodIDV8RuntimeReceivePromiseRejectCallback;
         jmethodID jmethodIDV8RuntimeRemoveCallbackContext;
 
+        constexpr int MAX_FAST_API_PARAMETER_COUNT = 3;
+
         const std::string PROMISE_REJECT_EVENTS[] = {
             "PromiseRejectWithNoHandler",
             "PromiseHandlerAddedAfterReject",
@@ -57,8 +71,64 @@ namespace Javet {
             "PromiseRejectAfterResolved",
         };
 
+        static inline void ToJValue(jvalue& mValue, const bool value) noexcept { mValue.z = value; }
+        static inline void ToJValue(jvalue& mValue, const double value) noexcept { mValue.d = value; }
+        static inline void ToJValue(jvalue& mValue, const int32_t value) noexcept { mValue.i = value; }
+
+        /*
+         * The fast API callback is called by TurboFan optimized code without a function callback info.
+         * The callback context reference is passed in via the data of the function template.
+         */
+        template<typename R, typename... Args>
+        R JavetFastApiCallback(V8LocalObject receiver, Args... args, v8::FastApiCallbackOptions& options) noexcept {
+            auto javetCallbackContextReference = JavetCallbackContextReference::FromV8Value(options.data);
+            INCREASE_COUNTER(Javet::Monitor::CounterType::FastApiCall);
+            FETCH_JNI_ENV(GlobalJavaVM);
+            jvalue mValues[sizeof...(Args) + 1];
+            size_t index = 0;
+            (ToJValue(mValues[index++], args), ...);
+            jvalue mResult = javetCallbackContextReference->CallPrimitiveMethod(jniEnv, mValues);
+            if (jniEnv->ExceptionCheck()) {
+                V8HandleScope v8HandleScope(options.isolate);
+                Javet::Exceptions::ThrowV8Exception(
+                    jniEnv, options.isolate->GetCurrentContext(), "Uncaught JavaError in function callback");
+            }
+            if constexpr (std::is_same_v<R, bool>) {
+                return (bool)mResult.z;
+            }
+            else if constexpr (std::is_same_v<R, double>) {
+                return (double)mResult.d;
+            }
+            else if constexpr (std::is_same_v<R, int32_t>) {
+                return (int32_t)mResult.i;
+            }
+        }
+
+        template<typename R, typename... Args>
+        const v8::CFunction* GetFastApiCFunction(const jint* parameterTypes, const int remainingCount) noexcept {
+            using namespace Javet::Enums::JavetPrimitiveType;
+            if (remainingCount == 0) {
+                using FastApiCallbackType = R(V8LocalObject, Args..., v8::FastApiCallbackOptions&);
+                static const v8::CFunction cFunction = v8::CFunction::Make(
+                    static_cast<FastApiCallbackType*>(JavetFastApiCallback<R, Args...>));
+                return &cFunction;
+            }
+            if constexpr (sizeof...(Args) < MAX_FAST_API_PARAMETER_COUNT) {
+                switch (parameterTypes[0]) {
+                case Boolean: return GetFastApiCFunction<R, Args..., bool>(parameterTypes + 1, remainingCount - 1);
+                case Double: return GetFastApiCFunction<R, Args..., double>(parameterTypes + 1, remainingCount - 1);
+                case Int: return GetFastApiCFunction<R, Args..., int32_t>(parameterTypes + 1, remainingCount - 1);
+                default: break;
+                }
+            }
+            return nullptr;
+        }
+
         void Initialize(JNIEnv* jniEnv) noexcept {
             jclassJavetCallbackContext = FIND_CLASS(jniEnv, "com/caoccao/javet/interop/callback/JavetCallbackContext");
+            jmethodIDJavetCallbackContextGetCallbackReceiver = jniEnv->GetMethodID(jclassJavetCallbackContext, "getCallbackReceiver", "()Ljava/lang/Object;");
+            jmethodIDJavetCallbackContextGetPrimitiveSignature = jniEnv->GetMethodID(jclassJavetCallbackContext, "getPrimitiveSignature", "()Lcom/caoccao/javet/interop/callback/JavetPrimitiveSignature;");
+            jmethodIDJavetCallbackContextIsFastCall = jniEnv->GetMethodID(jclassJavetCallbackContext, "isFastCall", "()Z");
             jmethodIDJavetCallbackContextIsReturnResult = jniEnv->GetMethodID(jclassJavetCallbackContext, "isReturnResult", "()Z");
             jmethodIDJavetCallbackContextIsThisObjectRequired = jniEnv->GetMethodID(jclassJavetCallbackContext, "isThisObjectRequired", "()Z");
             jmethodIDJavetCallbackContextSetHandle = jniEnv->GetMethodID(jclassJavetCallbackContext, "setHandle", "(J)V");
@@ -69,16 +139,24 @@ namespace Javet {
             jclassIV8ValueReference = FIND_CLASS(jniEnv, "com/caoccao/javet/values/reference/IV8ValueReference");
             jmethodIDIV8ValueReferenceClose = jniEnv->GetMethodID(jclassIV8ValueReference, "close", "(Z)V");
 
+            jclassJavetPrimitiveSignature = FIND_CLASS(jniEnv, "com/caoccao/javet/interop/callback/JavetPrimitiveSignature");
+            jmethodIDJavetPrimitiveSignatureGetMethod = jniEnv->GetMethodID(jclassJavetPrimitiveSignature, "getMethod", "()Ljava/lang/reflect/Method;");
+            jmethodIDJavetPrimitiveSignatureGetParameterTypes = jniEnv->GetMethodID(jclassJavetPrimitiveSignature, "getParameterTypes", "()[I");
+            jmethodIDJavetPrimitiveSignatureGetReturnType = jniEnv->GetMethodID(jclassJavetPrimitiveSignature, "getReturnType", "()I");
+
             jclassJavetResourceUtils = FIND_CLASS(jniEnv, "com/caoccao/javet/utils/JavetResourceUtils");
             jmethodIDJavetResourceUtilsSafeClose = jniEnv->GetStaticMethodID(jclassJavetResourceUtils, "safeClose", "(Ljava/lang/Object;)V");
 
+            jclassMethod = FIND_CLASS(jniEnv, "java/lang/reflect/Method");
+            jmethodIDMethodGetDeclaringClass = jniEnv->GetMethodID(jclassMethod, "getDeclaringClass", "()Ljava/lang/Class;");
+
             jclassV8FunctionCallback = FIND_CLASS(jniEnv, "com/caoccao/javet/interop/callback/V8FunctionCallback");
             jmethodIDV8FunctionCallbackReceiveCallback = jniEnv->GetStaticMethodID(jclassV8FunctionCallback, "receiveCallback",
                 "(Lcom/caoccao/javet/interop/V8Runtime;Lcom/caoccao/javet/interop/callback/JavetCallbackContext;Lcom/caoccao/javet/values/V8Value;[Lcom/caoccao/javet/values/V8Value;)Lcom/caoccao/javet/values/V8Value;");
 
             jclassV8Runtime = FIND_CLASS(jniEnv, "com/caoccao/javet/interop/V8Runtime");
-            jmethodIDV8RuntimeGetCallbackContext = jniEnv->GetMethodID(jclassV8Runtime, "getCallbackContext", "(J)Lcom/caoccao/javet/interop/callback/JavetCallbackContext;");
             jmethodIDV8RuntimeGetV8Module = jniEnv->GetMethodID(jclassV8Runtime, "getV8Module", "(Ljava/lang/String;Lcom/caoccao/javet/values/reference/IV8Module;)Lcom/caoccao/javet/values/reference/IV8Module;");
+            jmethodIDV8RuntimeReceiveCodeCacheRejectedCallback = jniEnv->GetMethodID(jclassV8Runtime, "receiveCodeCacheRejectedCallback", "()V");
             jmethodIDV8RuntimeReceiveGCEpilogueCallback = jniEnv->GetMethodID(jclassV8Runtime, "receiveGCEpilogueCallback", "(II)V");
             jmethodIDV8RuntimeReceiveGCPrologueCallback = jniEnv->GetMethodID(jclassV8Runtime, "receiveGCPrologueCallback", "(II)V");
             jmethodIDV8RuntimeReceiveNearHeapLimitCallback = jniEnv->GetMethodID(jclassV8Runtime, "receiveNearHeapLimitCallback", "(JJ)J");
@@ -115,9 +193,7 @@ namespace Javet {
         }
 
         void JavetFunctionCallback(const v8::FunctionCallbackInfo<v8::Value>& info) noexcept {
-            auto javetCallbackContextReference = reinterpret_cast<JavetCallbackContextReference*>(
-                info.Data().As<v8::BigInt>()->Int64Value());
-            javetCallbackContextReference->CallFunction(info);
+            JavetCallbackContextReference::FromV8Value(info.Data())->CallFunction(info);
         }
 
         void JavetGCEpilogueCallback(
@@ -173,18 +249,16 @@ namespace Javet {
         void JavetPropertyGetterCallback(
             V8LocalName propertyName,
             const v8::PropertyCallbackInfo<v8::Value>& info) noexcept {
-            auto javetCallbackContextReference = reinterpret_cast<JavetCallbackContextReference*>(
-                info.Data().As<v8::Array>()->Get(info.GetIsolate()->GetCurrentContext(), 0).ToLocalChecked().As<v8::BigInt>()->Int64Value());
-            javetCallbackContextReference->CallPropertyGetter(propertyName, info);
+            auto v8LocalValue = info.Data().As<v8::Array>()->Get(info.GetIsolate()->GetCurrentContext(), 0).ToLocalChecked();
+            JavetCallbackContextReference::FromV8Value(v8LocalValue)->CallPropertyGetter(propertyName, info);
         }
 
         void JavetPropertySetterCallback(
             V8LocalName propertyName,
             V8LocalValue propertyValue,
             const v8::PropertyCallbackInfo<void>& info) noexcept {
-            reinterpret_cast<Javet::Callback::JavetCallbackContextReference*>(
-                info.Data().As<v8::Array>()->Get(info.GetIsolate()->GetCurrentContext(), 1).ToLocalChecked().As<v8::BigInt>()->Int64Value())
-                ->CallPropertySetter(propertyName, propertyValue, info);
+            auto v8LocalValue = info.Data().As<v8::Array>()->Get(info.GetIsolate()->GetCurrentContext(), 1).ToLocalChecked();
+            JavetCallbackContextReference::FromV8Value(v8LocalValue)->CallPropertySetter(propertyName, propertyValue, info);
         }
 
         V8MaybeLocalModule JavetModuleResolveCallback(
@@ -312,6 +386,34 @@ namespace Javet {
             }
         }
 
+        /*
+         * The rejection of a consumed code cache, e.g. after a V8 upgrade, a flag change or a source mismatch,
+         * is reported to the V8 runtime in Java on the calling thread before the compile call returns,
+         * so that it is attributed to that call. An accepted code cache only increases the counter.
+         */
+        void JavetReportCodeCacheConsumption(
+            JNIEnv* jniEnv,
+            const jobject externalV8Runtime,
+            const V8ScriptCompilerCachedData* cachedData,
+            const char* kind) noexcept {
+            if (cachedData == nullptr) {
+                return;
+            }
+            if (cachedData->rejected) {
+                LOG_DEBUG(kind << " cache is rejected.");
+                INCREASE_COUNTER(Javet::Monitor::CounterType::CodeCacheRejected);
+                jniEnv->CallVoidMethod(externalV8Runtime, jmethodIDV8RuntimeReceiveCodeCacheRejectedCallback);
+                if (jniEnv->ExceptionCheck()) {
+                    jniEnv->ExceptionClear();
+                    LOG_ERROR("JavetReportCodeCacheConsumption: Exception occurred in Java callback.");
+                }
+            }
+            else {
+                LOG_DEBUG(kind << " cache is accepted.");
+                INCREASE_COUNTER(Javet::Monitor::CounterType::CodeCacheAccepted);
+            }
+        }
+
         V8MaybeLocalValue JavetSyntheticModuleEvaluationStepsCallback(
             V8LocalContext v8Context,
             V8LocalModule v8LocalModule) {
@@ -373,10 +475,53 @@ namespace Javet {
         }
 
         JavetCallbackContextReference::JavetCallbackContextReference(JNIEnv* jniEnv, const jobject callbackContext) noexcept
-            : v8PersistentCallbackContextHandlePointer(nullptr) {
+            : v8PersistentCallbackContextHandlePointer(nullptr), primitiveClass(nullptr), primitiveMethodID(nullptr),
+            primitiveParameterTypes(), primitiveReceiver(nullptr), primitiveReturnType(Javet::Enums::JavetPrimitiveType::Void) {
+            // The flags are immutable, so they are read only once at registration.
+            fastCall = jniEnv->CallBooleanMethod(callbackContext, jmethodIDJavetCallbackContextIsFastCall);
+            returnResult = jniEnv->CallBooleanMethod(callbackContext, jmethodIDJavetCallbackContextIsReturnResult);
+            thisObjectRequired = jniEnv->CallBooleanMethod(callbackContext, jmethodIDJavetCallbackContextIsThisObjectRequired);
+            this->callbackContext = jniEnv->NewGlobalRef(callbackContext);
+            INCREASE_COUNTER(Javet::Monitor::CounterType::NewGlobalRef);
+            jobject mPrimitiveSignature = jniEnv->CallObjectMethod(callbackContext, jmethodIDJavetCallbackContextGetPrimitiveSignature);
+            if (mPrimitiveSignature != nullptr) {
+                jobject mMethod = jniEnv->CallObjectMethod(mPrimitiveSignature, jmethodIDJavetPrimitiveSignatureGetMethod);
+                jintArray mParameterTypes = (jintArray)jniEnv->CallObjectMethod(mPrimitiveSignature, jmethodIDJavetPrimitiveSignatureGetParameterTypes);
+                jobject mReceiver = jniEnv->CallObjectMethod(callbackContext, jmethodIDJavetCallbackContextGetCallbackReceiver);
+                primitiveReturnType = jniEnv->CallIntMethod(mPrimitiveSignature, jmethodIDJavetPrimitiveSignatureGetReturnType);
+                primitiveParameterTypes.resize(jniEnv->GetArrayLength(mParameterTypes));
+                if (!primitiveParameterTypes.empty()) {
+                    jniEnv->GetIntArrayRegion(mParameterTypes, 0, (jsize)primitiveParameterTypes.size(), primitiveParameterTypes.data());
+                }
+                if (mReceiver == nullptr) {
+                    // The receiver is absent for a static method.
+                    jclass mClass = (jclass)jniEnv->CallObjectMethod(mMethod, jmethodIDMethodGetDeclaringClass);
+                    primitiveClass = (jclass)jniEnv->NewGlobalRef(mClass);
+                    INCREASE_COUNTER(Javet::Monitor::CounterType::NewGlobalRef);
+                    DELETE_LOCAL_REF(jniEnv, mClass);
+                }
+                else {
+                    primitiveReceiver = jniEnv->NewGlobalRef(mReceiver);
+                    INCREASE_COUNTER(Javet::Monitor::CounterType::NewGlobalRef);
+                    DELETE_LOCAL_REF(jniEnv, mReceiver);
+                }
+                primitiveMethodID = jniEnv->FromReflectedMethod(mMethod);
+                DELETE_LOCAL_REF(jniEnv, mParameterTypes);
+                DELETE_LOCAL_REF(jniEnv, mMethod);
+                DELETE_LOCAL_REF(jniEnv, mPrimitiveSignature);
+            }
             jniEnv->CallVoidMethod(callbackContext, jmethodIDJavetCallbackContextSetHandle, TO_JAVA_LONG(this));
         }
 
+        V8LocalExternal JavetCallbackContextReference::BindV8External(V8Isolate* v8Isolate) noexcept {
+            auto v8LocalExternal = v8::External::New(v8Isolate, this);
+            v8PersistentCallbackContextHandlePointer = new V8PersistentExternal(v8Isolate, v8LocalExternal);
+            INCREASE_COUNTER(Javet::Monitor::CounterType::NewPersistentCallbackContextReference);
+            v8PersistentCallbackContextHandlePointer->SetWeak(
+                this, JavetCloseWeakCallbackContextHandle, v8::WeakCallbackType::kParameter);
+            return v8LocalExternal;
+        }
+
         void JavetCallbackContextReference::CallFunction(
             const v8::FunctionCallbackInfo<v8::Value>& args) noexcept {
             FETCH_JNI_ENV(GlobalJavaVM);
@@ -398,11 +543,11 @@ namespace Javet {
                 else {
                     jobject externalV8Runtime = v8Runtime->externalV8Runtime;
                     V8ContextScope v8ContextScope(v8Context);
-                    jobject callbackContext = jniEnv->CallObjectMethod(externalV8Runtime, jmethodIDV8RuntimeGetCallbackContext, TO_JAVA_LONG(this));
-                    jboolean isReturnResult = jniEnv->CallBooleanMethod(callbackContext, jmethodIDJavetCallbackContextIsReturnResult);
-                    jboolean isThisObjectRequired = jniEnv->CallBooleanMethod(callbackContext, jmethodIDJavetCallbackContextIsThisObjectRequired);
+                    if (primitiveMethodID != nullptr && CallPrimitiveFunction(jniEnv, v8Context, args)) {
+                        return;
+                    }
                     jobjectArray externalArgs = Javet::Converter::ToExternalV8ValueArray(jniEnv, v8Runtime, v8Context, args);
-                    jobject thisObject = isThisObjectRequired ? Javet::Converter::ToExternalV8Value(jniEnv, v8Runtime, v8Context, args.This()) : nullptr;
+                    jobject thisObject = thisObjectRequired ? Javet::Converter::ToExternalV8Value(jniEnv, v8Runtime, v8Context, args.This()) : nullptr;
                     jobject mResult = jniEnv->CallStaticObjectMethod(
                         jclassV8FunctionCallback,
                         jmethodIDV8FunctionCallbackReceiveCallback,
@@ -412,7 +557,6 @@ namespace Javet {
                         externalArgs);
                     DELETE_LOCAL_REF(jniEnv, thisObject);
                     DELETE_LOCAL_REF(jniEnv, externalArgs);
-                    DELETE_LOCAL_REF(jniEnv, callbackContext);
                     if (jniEnv->ExceptionCheck()) {
                         if (mResult != nullptr) {
                             jniEnv->CallStaticVoidMethod(jclassJavetResourceUtils, jmethodIDJavetResourceUtilsSafeClose, mResult);
@@ -421,7 +565,7 @@ namespace Javet {
                         Javet::Exceptions::ThrowV8Exception(jniEnv, v8Context, "Uncaught JavaError in function callback");
                     }
                     else {
-                        if (isReturnResult) {
+                        if (returnResult) {
                             if (mResult == nullptr) {
                                 args.GetReturnValue().SetUndefined();
                             }
@@ -438,6 +582,155 @@ namespace Javet {
             }
         }
 
+        bool JavetCallbackContextReference::CallPrimitiveFunction(
+            JNIEnv* jniEnv,
+            const V8LocalContext& v8Context,
+            const v8::FunctionCallbackInfo<v8::Value>& args) noexcept {
+            using namespace Javet::Enums::JavetPrimitiveType;
+            const int length = (int)primitiveParameterTypes.size();
+            if (args.Length() != length) {
+                return false;
+            }
+            auto v8Isolate = args.GetIsolate();
+            std::unique_ptr<jvalue[]> mValues(new jvalue[length > 0 ? length : 1]);
+            // All arguments are checked before any Java object is created so that the fallback is side-effect free.
+            for (int i = 0; i < length; ++i) {
+                auto v8LocalValue = args[i];
+                switch (primitiveParameterTypes[i]) {
+                case Boolean:
+                    if (!v8LocalValue->IsBoolean()) {
+                        return false;
+                    }
+                    mValues[i].z = v8LocalValue->BooleanValue(v8Isolate);
+                    break;
+                case Int:
+                    if (!v8LocalValue->IsInt32()) {
+                        return false;
+                    }
+                    mValues[i].i = v8LocalValue.As<v8::Int32>()->Value();
+                    break;
+                case Long:
+                    if (v8LocalValue->IsInt32()) {
+                        mValues[i].j = v8LocalValue.As<v8::Int32>()->Value();
+                    }
+                    else if (v8LocalValue->IsBigInt()) {
+                        bool lossless = false;
+                        mValues[i].j = v8LocalValue.As<v8::BigInt>()->Int64Value(&lossless);
+                        if (!lossless) {
+                            return false;
+                        }
+                    }
+                    else {
+                        return false;
+                    }
+                    break;
+                case Double:
+                    if (!v8LocalValue->IsNumber()) {
+                        return false;
+                    }
+                    mValues[i].d = v8LocalValue.As<v8::Number>()->Value();
+                    break;
+                case String:
+                    if (!v8LocalValue->IsString()) {
+                        return false;
+                    }
+                    mValues[i].l = nullptr;
+                    break;
+                default:
+                    return false;
+                }
+            }
+            for (int i = 0; i < length; ++i) {
+                if (primitiveParameterTypes[i] == String) {
+                    mValues[i].l = Javet::Converter::ToJavaString(jniEnv, v8Isolate, args[i].As<v8::String>());
+                }
+            }
+            jvalue mResult = CallPrimitiveMethod(jniEnv, mValues.get());
+            for (int i = 0; i < length; ++i) {
+                if (primitiveParameterTypes[i] == String) {
+                    DELETE_LOCAL_REF(jniEnv, mValues[i].l);
+                }
+            }
+            if (jniEnv->ExceptionCheck()) {
+                if (primitiveReturnType == String) {
+                    DELETE_LOCAL_REF(jniEnv, mResult.l);
+                }
+                Javet::Exceptions::ThrowV8Exception(jniEnv, v8Context, "Uncaught JavaError in function callback");
+                return true;
+            }
+            auto returnValue = args.GetReturnValue();
+            switch (primitiveReturnType) {
+            case Boolean:
+                returnValue.Set((bool)mResult.z);
+                break;
+            case Int:
+                returnValue.Set((int32_t)mResult.i);
+                break;
+            case Long:
+                returnValue.Set(Javet::Converter::ToV8Long(v8Isolate, mResult.j));
+                break;
+            case Double:
+                returnValue.Set((double)mResult.d);
+                break;
+            case String:
+                if (mResult.l == nullptr) {
+                    returnValue.SetNull();
+                }
+                else {
+                    returnValue.Set(Javet::Converter::ToV8String(jniEnv, v8Isolate, (jstring)mResult.l));
+                    DELETE_LOCAL_REF(jniEnv, mResult.l);
+                }
+                break;
+            default:
+                returnValue.SetUndefined();
+                break;
+            }
+            return true;
+        }
+
+        jvalue JavetCallbackContextReference::CallPrimitiveMethod(JNIEnv* jniEnv, const jvalue* mValues) noexcept {
+            using namespace Javet::Enums::JavetPrimitiveType;
+            const bool isStatic = primitiveReceiver == nullptr;
+            jvalue mResult;
+            mResult.j = 0;
+            switch (primitiveReturnType) {
+            case Boolean:
+                mResult.z = isStatic
+                    ? jniEnv->CallStaticBooleanMethodA(primitiveClass, primitiveMethodID, mValues)
+                    : jniEnv->CallBooleanMethodA(primitiveReceiver, primitiveMethodID, mValues);
+                break;
+            case Int:
+                mResult.i = isStatic
+                    ? jniEnv->CallStaticIntMethodA(primitiveClass, primitiveMethodID, mValues)
+                    : jniEnv->CallIntMethodA(primitiveReceiver, primitiveMethodID, mValues);
+                break;
+            case Long:
+                mResult.j = isStatic
+                    ? jniEnv->CallStaticLongMethodA(primitiveClass, primitiveMethodID, mValues)
+                    : jniEnv->CallLongMethodA(primitiveReceiver, primitiveMethodID, mValues);
+                break;
+            case Double:
+                mResult.d = isStatic
+                    ? jniEnv->CallStaticDoubleMethodA(primitiveClass, primitiveMethodID, mValues)
+                    : jniEnv->CallDoubleMethodA(primitiveReceiver, primitiveMethodID, mValues);
+                break;
+            case String:
+                mResult.l = isStatic
+                    ? jniEnv->CallStaticObjectMethodA(primitiveClass, primitiveMethodID, mValues)
+                    : jniEnv->CallObjectMethodA(primitiveReceiver, primitiveMethodID, mValues);
+                break;
+            default:
+                if (isStatic) {
+                    jniEnv->CallStaticVoidMethodA(primitiveClass, primitiveMethodID, mValues);
+                }
+                else {
+                    jniEnv->CallVoidMethodA(primitiveReceiver, primitiveMethodID, mValues);
+                }
+                break;
+            }
+            return mResult;
+        }
+
         void JavetCallbackContextReference::CallPropertyGetter(
             const V8LocalName& propertyName,
             const v8::PropertyCallbackInfo<v8::Value>& args) noexcept {
@@ -459,9 +752,7 @@ namespace Javet {
                 else {
                     jobject externalV8Runtime = v8Runtime->externalV8Runtime;
                     V8ContextScope v8ContextScope(v8Context);
-                    jobject callbackContext = jniEnv->CallObjectMethod(externalV8Runtime, jmethodIDV8RuntimeGetCallbackContext, TO_JAVA_LONG(this));
-                    jboolean isThisObjectRequired = jniEnv->CallBooleanMethod(callbackContext, jmethodIDJavetCallbackContextIsThisObjectRequired);
-                    jobject thisObject = isThisObjectRequired ? Javet::Converter::ToExternalV8Value(jniEnv, v8Runtime, v8Context, args.This()) : nullptr;
+                    jobject thisObject = thisObjectRequired ? Javet::Converter::ToExternalV8Value(jniEnv, v8Runtime, v8Context, args.This()) : nullptr;
                     jobject mResult = jniEnv->CallStaticObjectMethod(
                         jclassV8FunctionCallback,
                         jmethodIDV8FunctionCallbackReceiveCallback,
@@ -470,7 +761,6 @@ namespace Javet {
                         thisObject,
                         nullptr);
                     DELETE_LOCAL_REF(jniEnv, thisObject);
-                    DELETE_LOCAL_REF(jniEnv, callbackContext);
                     if (jniEnv->ExceptionCheck()) {
                         Javet::Exceptions::ThrowV8Exception(jniEnv, v8Context, "Uncaught JavaError in property getter callback");
                     }
@@ -519,9 +809,7 @@ namespace Javet {
                     }
                     else {
                         jobject externalV8Runtime = v8Runtime->externalV8Runtime;
-                        jobject callbackContext = jniEnv->CallObjectMethod(externalV8Runtime, jmethodIDV8RuntimeGetCallbackContext, TO_JAVA_LONG(this));
-                        jboolean isThisObjectRequired = jniEnv->CallBooleanMethod(callbackContext, jmethodIDJavetCallbackContextIsThisObjectRequired);
-                        jobject thisObject = isThisObjectRequired ? Javet::Converter::ToExternalV8Value(jniEnv, v8Runtime, v8Context, args.This()) : nullptr;
+                        jobject thisObject = thisObjectRequired ? Javet::Converter::ToExternalV8Value(jniEnv, v8Runtime, v8Context, args.This()) : nullptr;
                         jobjectArray mArguments = Javet::Converter::ToExternalV8ValueArray(jniEnv, v8Runtime, v8Context, v8LocalArray);
                         jobject mResult = jniEnv->CallStaticObjectMethod(
                             jclassV8FunctionCallback,
@@ -532,7 +820,6 @@ namespace Javet {
                             mArguments);
                         DELETE_LOCAL_REF(jniEnv, thisObject);
                         DELETE_LOCAL_REF(jniEnv, mArguments);
-                        DELETE_LOCAL_REF(jniEnv, callbackContext);
                         if (jniEnv->ExceptionCheck()) {
                             Javet::Exceptions::ThrowV8Exception(jniEnv, v8Context, "Uncaught JavaError in property setter callback");
                         }
@@ -548,6 +835,22 @@ namespace Javet {
             }
         }
 
+        const v8::CFunction* JavetCallbackContextReference::GetFastApiCFunction() const noexcept {
+            using namespace Javet::Enums::JavetPrimitiveType;
+            const int parameterCount = (int)primitiveParameterTypes.size();
+            if (!fastCall || primitiveMethodID == nullptr || parameterCount > MAX_FAST_API_PARAMETER_COUNT) {
+                return nullptr;
+            }
+            auto parameterTypes = primitiveParameterTypes.data();
+            switch (primitiveReturnType) {
+            case Boolean: return Javet::Callback::GetFastApiCFunction<bool>(parameterTypes, parameterCount);
+            case Double: return Javet::Callback::GetFastApiCFunction<double>(parameterTypes, parameterCount);
+            case Int: return Javet::Callback::GetFastApiCFunction<int32_t>(parameterTypes, parameterCount);
+            case Void: return Javet::Callback::GetFastApiCFunction<void>(parameterTypes, parameterCount);
+            default: return nullptr;
+            }
+        }
+
         void JavetCallbackContextReference::RemoveCallbackContext(const jobject externalV8Runtime) noexcept {
             FETCH_JNI_ENV(GlobalJavaVM);
             jniEnv->CallVoidMethod(externalV8Runtime, jmethodIDV8RuntimeRemoveCallbackContext, TO_JAVA_LONG(this));
@@ -560,6 +863,24 @@ namespace Javet {
                 INCREASE_COUNTER(Javet::Monitor::CounterType::DeletePersistentCallbackContextReference);
                 v8PersistentCallbackContextHandlePointer = nullptr;
             }
+            if (callbackContext != nullptr || primitiveClass != nullptr || primitiveReceiver != nullptr) {
+                FETCH_JNI_ENV(GlobalJavaVM);
+                if (callbackContext != nullptr) {
+                    jniEnv->DeleteGlobalRef(callbackContext);
+                    INCREASE_COUNTER(Javet::Monitor::CounterType::DeleteGlobalRef);
+                    callbackContext = nullptr;
+                }
+                if (primitiveClass != nullptr) {
+                    jniEnv->DeleteGlobalRef(primitiveClass);
+                    INCREASE_COUNTER(Javet::Monitor::CounterType::DeleteGlobalRef);
+                    primitiveClass = nullptr;
+                }
+                if (primitiveReceiver != nullptr) {
+                    jniEnv->DeleteGlobalRef(primitiveReceiver);
+                    INCREASE_COUNTER(Javet::Monitor::CounterType::DeleteGlobalRef);
+                    primitiveReceiver = nullptr;
+                }
+            }
         }
 
         V8ValueReference::V8ValueReference(JNIEnv* jniEnv, const jobject objectReference) noexcept
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <jni.h>
+#include <vector>
 #include "javet_v8.h"
 
 namespace Javet {
@@ -55,15 +56,34 @@ namespace Javet {
 #endif
         size_t JavetNearHeapLimitCallback(void* data, size_t currentHeapLimit, size_t initialHeapLimit) noexcept;
         void JavetPromiseRejectCallback(v8::PromiseRejectMessage message) noexcept;
+        void JavetReportCodeCacheConsumption(
+            JNIEnv* jniEnv,
+            const jobject externalV8Runtime,
+            const V8ScriptCompilerCachedData* cachedData,
+            const char* kind) noexcept;
         V8MaybeLocalValue JavetSyntheticModuleEvaluationStepsCallback(
             V8LocalContext v8Context,
             V8LocalModule v8LocalModule);
 
+        /*
+         * The callback context reference holds the Java callback context as a global reference
+         * together with its immutable flags, so that a callback only needs one JNI upcall.
+         */
         class JavetCallbackContextReference {
         public:
-            V8PersistentBigInt* v8PersistentCallbackContextHandlePointer;
+            jobject callbackContext;
+            bool fastCall;
+            bool returnResult;
+            bool thisObjectRequired;
+            V8PersistentExternal* v8PersistentCallbackContextHandlePointer;
             JavetCallbackContextReference(JNIEnv* jniEnv, const jobject callbackContext) noexcept;
+            V8LocalExternal BindV8External(V8Isolate* v8Isolate) noexcept;
             void CallFunction(const v8::FunctionCallbackInfo<v8::Value>& args) noexcept;
+            bool CallPrimitiveFunction(
+                JNIEnv* jniEnv,
+                const V8LocalContext& v8Context,
+                const v8::FunctionCallbackInfo<v8::Value>& args) noexcept;
+            jvalue CallPrimitiveMethod(JNIEnv* jniEnv, const jvalue* mValues) noexcept;
             void CallPropertyGetter(
                 const V8LocalName& propertyName,
                 const v8::PropertyCallbackInfo<v8::Value>& args) noexcept;
@@ -71,8 +91,23 @@ namespace Javet {
                 const V8LocalName& propertyName,
                 const V8LocalValue& propertyValue,
                 const v8::PropertyCallbackInfo<void>& args) noexcept;
+            /*
+             * Fast API call is only available to a callback with a primitive signature
+             * of up to 3 int, double or boolean parameters and a void, int, double or boolean result.
+             */
+            const v8::CFunction* GetFastApiCFunction() const noexcept;
+            static inline JavetCallbackContextReference* FromV8Value(const V8LocalValue& v8LocalValue) noexcept {
+                return static_cast<JavetCallbackContextReference*>(v8LocalValue.As<v8::External>()->Value());
+            }
             void RemoveCallbackContext(const jobject externalV8Runtime) noexcept;
             virtual ~JavetCallbackContextReference();
+        private:
+            // The primitive signature is only present if the callback is eligible for the native trampoline.
+            jclass primitiveClass;
+            jmethodID primitiveMethodID;
+            std::vector<jint> primitiveParameterTypes;
+            jobject primitiveReceiver;
+            jint primitiveReturnType;
         };
 
         class V8ValueReference {
@@ -0,0 +1,62 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <algorithm>
+#include "javet_compile_hints.h"
+
+namespace Javet {
+    namespace CompileHints {
+        CompileHints::CompileHints(JNIEnv* jniEnv, const jint mCompileOptions, const jintArray mCompileHints) noexcept
+            : compileOptions(v8::ScriptCompiler::kNoCompileOptions) {
+            if (mCompileOptions & COMPILE_OPTION_EAGER_COMPILE) {
+                compileOptions = v8::ScriptCompiler::kEagerCompile;
+                return;
+            }
+            int options = v8::ScriptCompiler::kNoCompileOptions;
+            if (mCompileOptions & COMPILE_OPTION_PRODUCE_COMPILE_HINTS) {
+                options |= v8::ScriptCompiler::kProduceCompileHints;
+            }
+            else if (mCompileHints != nullptr) {
+                const jsize length = jniEnv->GetArrayLength(mCompileHints);
+                if (length > 0) {
+                    // The positions are sorted by Java so that the callback can binary search them.
+                    positions.resize(length);
+                    jniEnv->GetIntArrayRegion(mCompileHints, 0, length, reinterpret_cast<jint*>(positions.data()));
+                    options |= v8::ScriptCompiler::kConsumeCompileHints;
+                }
+            }
+            if (mCompileOptions & COMPILE_OPTION_FOLLOW_COMPILE_HINTS_MAGIC_COMMENT) {
+                options |= v8::ScriptCompiler::kFollowCompileHintsMagicComment;
+            }
+            compileOptions = static_cast<V8ScriptCompilerCompileOptions>(options);
+        }
+
+        bool CompileHints::Callback(int position, void* data) noexcept {
+            auto positionsPointer = static_cast<std::vector<int>*>(data);
+            return std::binary_search(positionsPointer->begin(), positionsPointer->end(), position);
+        }
+
+        jintArray ToJavaIntArray(JNIEnv* jniEnv, const std::vector<int>& positions) noexcept {
+            const jsize length = static_cast<jsize>(positions.size());
+            jintArray mPositions = jniEnv->NewIntArray(length);
+            if (mPositions != nullptr && length > 0) {
+                jniEnv->SetIntArrayRegion(mPositions, 0, length, reinterpret_cast<const jint*>(positions.data()));
+            }
+            return mPositions;
+        }
+    }
+}
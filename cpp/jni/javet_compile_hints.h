@@ -0,0 +1,68 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#pragma once
+
+#include <jni.h>
+#include <vector>
+#include "javet_v8.h"
+
+namespace Javet {
+    namespace CompileHints {
+        // The compile options must be in sync with V8ScriptOrigin.
+        constexpr auto COMPILE_OPTION_EAGER_COMPILE = 1;
+        constexpr auto COMPILE_OPTION_PRODUCE_COMPILE_HINTS = 2;
+        constexpr auto COMPILE_OPTION_FOLLOW_COMPILE_HINTS_MAGIC_COMMENT = 4;
+
+        /*
+         * The compile hints translate the compile options and the recorded source positions from Java
+         * to the V8 compile options and the compile hint callback.
+         * V8 does not allow the eager compile to be combined with any other option,
+         * nor the compile hints to be produced and consumed at the same time,
+         * so the eager compile wins over the others and producing wins over consuming.
+         * It must outlive the compilation because V8 calls the callback during the compilation.
+         */
+        class CompileHints final {
+        public:
+            CompileHints(JNIEnv* jniEnv, const jint mCompileOptions, const jintArray mCompileHints) noexcept;
+
+            inline v8::CompileHintCallback GetCallback() const noexcept {
+                return IsConsuming() ? Callback : nullptr;
+            }
+
+            inline void* GetCallbackData() noexcept {
+                return IsConsuming() ? &positions : nullptr;
+            }
+
+            inline V8ScriptCompilerCompileOptions GetCompileOptions() const noexcept {
+                return compileOptions;
+            }
+
+        private:
+            V8ScriptCompilerCompileOptions compileOptions;
+            std::vector<int> positions;
+
+            static bool Callback(int position, void* data) noexcept;
+
+            inline bool IsConsuming() const noexcept {
+                return (compileOptions & v8::ScriptCompiler::kConsumeCompileHints) != 0;
+            }
+        };
+
+        jintArray ToJavaIntArray(JNIEnv* jniEnv, const std::vector<int>& positions) noexcept;
+    }
+}
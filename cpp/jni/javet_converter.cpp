@@ -18,6 +18,7 @@
 #include "javet_converter.h"
 #include "javet_enums.h"
 #include "javet_exceptions.h"
+#include "javet_external_source.h"
 #include "javet_logging.h"
 
 namespace Javet {
@@ -25,6 +26,8 @@ namespace Javet {
         // JDK
 
         jclass jclassByteBuffer;
+        jmethodID jmethodIDByteBufferAllocateDirect;
+        jmethodID jmethodIDByteBufferPosition;
         jclass jclassString;
 
         // Runtime
@@ -41,6 +44,7 @@ namespace Javet {
         // Primitive
 
         jclass jclassV8Value;
+        jfieldID jfieldIDV8ValueTypeTag;
 
         jclass jclassV8ValueBigInteger;
         jmethodID jmethodIDV8ValueBigIntegerConstructor;
@@ -62,6 +66,7 @@ namespace Javet {
         jmethodID jmethodIDV8ValueIntegerToPrimitive;
 
         jclass jclassV8ValueString;
+        jfieldID jfieldIDV8ValueStringValue;
         jmethodID jmethodIDV8ValueStringConstructor;
         jmethodID jmethodIDV8ValueStringToPrimitive;
 
@@ -154,6 +159,7 @@ namespace Javet {
         jmethodID jmethodIDV8ValueProxyGetHandle;
 
         jclass jclassV8ValueReference;
+        jfieldID jfieldIDV8ValueReferenceHandle;
 
         jclass jclassV8ValueRegExp;
         jmethodID jmethodIDV8ValueRegExpConstructor;
@@ -195,6 +201,9 @@ namespace Javet {
         jclass jclassJavetScriptingError;
         jmethodID jmethodIDJavetScriptingErrorConstructor;
 
+        jclass jclassV8ExternalSource;
+        jmethodID jmethodIDV8ExternalSourceGetHandle;
+
         jclass jclassIV8ValueFunctionScriptSource;
         jmethodID jmethodIDIV8ValueFunctionScriptSourceConstructor;
         jmethodID jmethodIDIV8ValueFunctionScriptGetCode;
@@ -362,6 +371,7 @@ namespace Javet {
             // Primitive
 
             jclassV8Value = FIND_CLASS(jniEnv, "com/caoccao/javet/values/V8Value");
+            jfieldIDV8ValueTypeTag = jniEnv->GetFieldID(jclassV8Value, "typeTag", "I");
 
             jclassV8ValueBigInteger = FIND_CLASS(jniEnv, "com/caoccao/javet/values/primitive/V8ValueBigInteger");
             jmethodIDV8ValueBigIntegerConstructor = jniEnv->GetMethodID(jclassV8ValueBigInteger, "<init>", "(Lcom/caoccao/javet/interop/V8Runtime;I[J)V");
@@ -383,6 +393,7 @@ namespace Javet {
             jclassV8ValueNull = FIND_CLASS(jniEnv, "com/caoccao/javet/values/primitive/V8ValueNull");
 
             jclassV8ValueString = FIND_CLASS(jniEnv, "com/caoccao/javet/values/primitive/V8ValueString");
+            jfieldIDV8ValueStringValue = jniEnv->GetFieldID(jclassV8ValueString, "value", "Ljava/lang/Object;");
             jmethodIDV8ValueStringConstructor = jniEnv->GetMethodID(jclassV8ValueString, "<init>", "(Lcom/caoccao/javet/interop/V8Runtime;Ljava/lang/String;)V");
             jmethodIDV8ValueStringToPrimitive = jniEnv->GetMethodID(jclassV8ValueString, JAVA_METHOD_TO_PRIMITIVE, "()Ljava/lang/String;");
 
@@ -473,6 +484,7 @@ namespace Javet {
             jmethodIDV8ValueProxyGetHandle = GET_METHOD_GET_HANDLE(jniEnv, jclassV8ValueProxy);
 
             jclassV8ValueReference = FIND_CLASS(jniEnv, "com/caoccao/javet/values/reference/V8ValueReference");
+            jfieldIDV8ValueReferenceHandle = jniEnv->GetFieldID(jclassV8ValueReference, "handle", "J");
 
             jclassV8ValueRegExp = FIND_CLASS(jniEnv, "com/caoccao/javet/values/reference/V8ValueRegExp");
             jmethodIDV8ValueRegExpConstructor = GET_METHOD_CONSTRUCTOR(jniEnv, jclassV8ValueRegExp);
@@ -512,11 +524,16 @@ namespace Javet {
 
             // Misc
             jclassByteBuffer = FIND_CLASS(jniEnv, "java/nio/ByteBuffer");
+            jmethodIDByteBufferAllocateDirect = jniEnv->GetStaticMethodID(jclassByteBuffer, "allocateDirect", "(I)Ljava/nio/ByteBuffer;");
+            jmethodIDByteBufferPosition = jniEnv->GetMethodID(jclassByteBuffer, "position", "(I)Ljava/nio/Buffer;");
             jclassString = FIND_CLASS(jniEnv, "java/lang/String");
 
             jclassJavetScriptingError = FIND_CLASS(jniEnv, "com/caoccao/javet/exceptions/JavetScriptingError");
             jmethodIDJavetScriptingErrorConstructor = jniEnv->GetMethodID(jclassJavetScriptingError, "<init>", "(Lcom/caoccao/javet/values/V8Value;Ljava/lang/String;Ljava/lang/String;IIIII)V");
 
+            jclassV8ExternalSource = FIND_CLASS(jniEnv, "com/caoccao/javet/interop/V8ExternalSource");
+            jmethodIDV8ExternalSourceGetHandle = GET_METHOD_GET_HANDLE(jniEnv, jclassV8ExternalSource);
+
             jclassIV8ValueFunctionScriptSource = FIND_CLASS(jniEnv, "com/caoccao/javet/values/reference/IV8ValueFunction$ScriptSource");
             jmethodIDIV8ValueFunctionScriptSourceConstructor = jniEnv->GetMethodID(jclassIV8ValueFunctionScriptSource, "<init>", "(Ljava/lang/String;II)V");
             jmethodIDIV8ValueFunctionScriptGetCode = jniEnv->GetMethodID(jclassIV8ValueFunctionScriptSource, "getCode", "()Ljava/lang/String;");
@@ -524,6 +541,43 @@ namespace Javet {
             jmethodIDIV8ValueFunctionScriptGetStartPosition = jniEnv->GetMethodID(jclassIV8ValueFunctionScriptSource, "getStartPosition", "()I");
         }
 
+        JavaStringCharacters::JavaStringCharacters(JNIEnv* jniEnv, const jstring mString) noexcept
+            : buffer(static_cast<size_t>(jniEnv->GetStringLength(mString)) + 1) {
+            length = jniEnv->GetStringLength(mString);
+            // The modified UTF-8 length equals the UTF-16 length only if all characters are ASCII without NUL.
+            oneByte = jniEnv->GetStringUTFLength(mString) == length;
+            if (oneByte) {
+                jniEnv->GetStringUTFRegion(mString, 0, length, reinterpret_cast<char*>(buffer.Get()));
+            }
+            else {
+                jniEnv->GetStringRegion(mString, 0, length, buffer.Get());
+            }
+        }
+
+        static jstring ToJavaStringFromOneByteBuffer(
+            JNIEnv* jniEnv,
+            uint8_t* oneByteBuffer,
+            const int length) noexcept {
+            bool isAscii = true;
+            for (int i = 0; i < length; ++i) {
+                if (oneByteBuffer[i] == 0 || oneByteBuffer[i] > 0x7F) {
+                    isAscii = false;
+                    break;
+                }
+            }
+            if (isAscii) {
+                // The buffer always reserves one byte for the terminator.
+                oneByteBuffer[length] = 0;
+                return jniEnv->NewStringUTF(reinterpret_cast<const char*>(oneByteBuffer));
+            }
+            InlineBuffer<jchar> twoByteBuffer(static_cast<size_t>(length));
+            auto twoBytePointer = twoByteBuffer.Get();
+            for (int i = 0; i < length; ++i) {
+                twoBytePointer[i] = oneByteBuffer[i];
+            }
+            return jniEnv->NewString(twoBytePointer, length);
+        }
+
         V8ScriptCompilerCachedData* ToCachedDataPointer(
             JNIEnv* jniEnv,
             const jbyteArray mCachedArray) noexcept {
@@ -536,6 +590,33 @@ namespace Javet {
             return new V8ScriptCompilerCachedData(bytes, length, V8ScriptCompilerCachedDataBufferPolicy::BufferOwned);
         }
 
+        jstring ToJavaString(
+            JNIEnv* jniEnv,
+            const uint8_t* oneByteString,
+            const int length) noexcept {
+            InlineBuffer<uint8_t> oneByteBuffer(static_cast<size_t>(length) + 1);
+            memcpy(oneByteBuffer.Get(), oneByteString, length);
+            return ToJavaStringFromOneByteBuffer(jniEnv, oneByteBuffer.Get(), length);
+        }
+
+        jstring ToJavaString(
+            JNIEnv* jniEnv,
+            V8Isolate* v8Isolate,
+            const V8LocalString& v8LocalString) noexcept {
+            if (v8LocalString.IsEmpty()) {
+                return jniEnv->NewString(nullptr, 0);
+            }
+            const int length = v8LocalString->Length();
+            if (v8LocalString->IsOneByte()) {
+                InlineBuffer<uint8_t> oneByteBuffer(static_cast<size_t>(length) + 1);
+                v8LocalString->WriteOneByteV2(v8Isolate, 0, length, oneByteBuffer.Get());
+                return ToJavaStringFromOneByteBuffer(jniEnv, oneByteBuffer.Get(), length);
+            }
+            InlineBuffer<uint16_t> twoByteBuffer(static_cast<size_t>(length));
+            v8LocalString->WriteV2(v8Isolate, 0, length, twoByteBuffer.Get());
+            return jniEnv->NewString(twoByteBuffer.Get(), length);
+        }
+
         jbyteArray ToJavaByteArray(
             JNIEnv* jniEnv,
             const V8ScriptCompilerCachedData* cachedDataPointer) noexcept {
@@ -555,7 +636,7 @@ namespace Javet {
                 jclassV8Context,
                 jmethodIDV8ContextConstructor,
                 v8Runtime->externalV8Runtime,
-                ToV8PersistentReference(v8Runtime->v8Isolate, v8ContextValue));
+                ToV8PersistentReference(v8Runtime, v8ContextValue));
         }
 
         jobject ToExternalV8Module(
@@ -566,7 +647,7 @@ namespace Javet {
                 jclassV8Module,
                 jmethodIDV8ModuleConstructor,
                 v8Runtime->externalV8Runtime,
-                ToV8PersistentReference(v8Runtime->v8Isolate, v8Module));
+                ToV8PersistentReference(v8Runtime, v8Module));
         }
 
         jobject ToExternalV8Script(
@@ -577,7 +658,7 @@ namespace Javet {
                 jclassV8Script,
                 jmethodIDV8ScriptConstructor,
                 v8Runtime->externalV8Runtime,
-                ToV8PersistentReference(v8Runtime->v8Isolate, v8Script));
+                ToV8PersistentReference(v8Runtime, v8Script));
         }
 
         jobject ToExternalV8Value(
@@ -629,7 +710,7 @@ namespace Javet {
                         jclassV8ValueArray,
                         jmethodIDV8ValueArrayConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsTypedArray()) {
                     int type = V8ValueReferenceType::Invalid;
@@ -674,7 +755,7 @@ namespace Javet {
                             jclassV8ValueTypedArray,
                             jmethodIDV8ValueTypedArrayConstructor,
                             v8Runtime->externalV8Runtime,
-                            ToV8PersistentReference(v8Isolate, v8Value),
+                            ToV8PersistentReference(v8Runtime, v8Value),
                             type);
                     }
                 }
@@ -683,7 +764,7 @@ namespace Javet {
                         jclassV8ValueDataView,
                         jmethodIDV8ValueDataViewConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsArrayBuffer()) {
                     auto v8ArrayBuffer = v8Value.As<v8::ArrayBuffer>();
@@ -694,7 +775,7 @@ namespace Javet {
                         jclassV8ValueArrayBuffer,
                         jmethodIDV8ValueArrayBufferConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value),
+                        ToV8PersistentReference(v8Runtime, v8Value),
                         directByteBuffer);
                     DELETE_LOCAL_REF(jniEnv, directByteBuffer);
                     return v8ValueArrayBuffer;
@@ -708,7 +789,7 @@ namespace Javet {
                         jclassV8ValueSharedArrayBuffer,
                         jmethodIDV8ValueSharedArrayBufferConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value),
+                        ToV8PersistentReference(v8Runtime, v8Value),
                         directByteBuffer);
                     DELETE_LOCAL_REF(jniEnv, directByteBuffer);
                     return v8ValueSharedArrayBuffer;
@@ -724,56 +805,56 @@ namespace Javet {
                         jclassV8ValueWeakMap,
                         jmethodIDV8ValueWeakMapConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsWeakSet()) {
                     return jniEnv->NewObject(
                         jclassV8ValueWeakSet,
                         jmethodIDV8ValueWeakSetConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsMap()) {
                     return jniEnv->NewObject(
                         jclassV8ValueMap,
                         jmethodIDV8ValueMapConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsSet()) {
                     return jniEnv->NewObject(
                         jclassV8ValueSet,
                         jmethodIDV8ValueSetConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsMapIterator() || v8Value->IsSetIterator() || v8Value->IsGeneratorObject()) {
                     return jniEnv->NewObject(
                         jclassV8ValueIterator,
                         jmethodIDV8ValueIteratorConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsArgumentsObject()) {
                     return jniEnv->NewObject(
                         jclassV8ValueArguments,
                         jmethodIDV8ValueArgumentsConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsPromise()) {
                     return jniEnv->NewObject(
                         jclassV8ValuePromise,
                         jmethodIDV8ValuePromiseConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsRegExp()) {
                     return jniEnv->NewObject(
                         jclassV8ValueRegExp,
                         jmethodIDV8ValueRegExpConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsAsyncFunction()) {
                     // It defaults to V8ValueFunction.
@@ -787,21 +868,21 @@ namespace Javet {
                         jclassV8ValueProxy,
                         jmethodIDV8ValueProxyConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsFunction()) {
                     return jniEnv->NewObject(
                         jclassV8ValueFunction,
                         jmethodIDV8ValueFunctionConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsNativeError()) {
                     return jniEnv->NewObject(
                         jclassV8ValueError,
                         jmethodIDV8ValueErrorConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsDate()) {
                     auto v8Date = v8Value->ToObject(v8Context).ToLocalChecked().As<v8::Date>();
@@ -815,35 +896,35 @@ namespace Javet {
                         jclassV8ValueSymbolObject,
                         jmethodIDV8ValueSymbolObjectConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsStringObject()) {
                     return jniEnv->NewObject(
                         jclassV8ValueStringObject,
                         jmethodIDV8ValueStringObjectConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsNumberObject()) {
                     return jniEnv->NewObject(
                         jclassV8ValueDoubleObject,
                         jmethodIDV8ValueDoubleObjectConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsBooleanObject()) {
                     return jniEnv->NewObject(
                         jclassV8ValueBooleanObject,
                         jmethodIDV8ValueBooleanObjectConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsBigIntObject()) {
                     return jniEnv->NewObject(
                         jclassV8ValueLongObject,
                         jmethodIDV8ValueLongObjectConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 if (v8Value->IsName()) {
                     /*
@@ -856,13 +937,13 @@ namespace Javet {
                         jclassV8Module,
                         jmethodIDV8ModuleConstructor,
                         v8Runtime->externalV8Runtime,
-                        ToV8PersistentReference(v8Isolate, v8Value));
+                        ToV8PersistentReference(v8Runtime, v8Value));
                 }
                 return jniEnv->NewObject(
                     jclassV8ValueObject,
                     jmethodIDV8ValueObjectConstructor,
                     v8Runtime->externalV8Runtime,
-                    ToV8PersistentReference(v8Isolate, v8Value));
+                    ToV8PersistentReference(v8Runtime, v8Value));
             }
             // Primitive types
             if (v8Value->IsBoolean()) {
@@ -897,7 +978,7 @@ namespace Javet {
                     jclassV8ValueSymbol,
                     jmethodIDV8ValueSymbolConstructor,
                     v8Runtime->externalV8Runtime,
-                    ToV8PersistentReference(v8Isolate, v8Value));
+                    ToV8PersistentReference(v8Runtime, v8Value));
             }
             if (v8Value->IsBigInt()) {
                 V8LocalBigInt v8LocalBigInt = v8Value->ToBigInt(v8Context).ToLocalChecked();
@@ -1098,6 +1179,48 @@ namespace Javet {
             return V8LocalContext();
         }
 
+        V8LocalPrivate ToV8PrivateKey(
+            JNIEnv* jniEnv,
+            V8Runtime* v8Runtime,
+            const jstring mKey) noexcept {
+            if (v8Runtime->v8PropertyKeyCache->IsEnabled()) {
+                auto v8LocalPrivate = v8Runtime->v8PropertyKeyCache->GetPrivate(jniEnv, v8Runtime->v8Isolate, mKey);
+                if (!v8LocalPrivate.IsEmpty()) {
+                    return v8LocalPrivate;
+                }
+            }
+            return v8::Private::ForApi(v8Runtime->v8Isolate, ToV8String(jniEnv, v8Runtime->v8Isolate, mKey));
+        }
+
+        V8LocalValue ToV8PropertyKey(
+            JNIEnv* jniEnv,
+            V8Runtime* v8Runtime,
+            const V8LocalContext& v8Context,
+            const jobject key) noexcept {
+            if (key != nullptr && v8Runtime->v8PropertyKeyCache->IsEnabled() && IsV8ValueString(jniEnv, key)) {
+                jstring mKey = (jstring)jniEnv->GetObjectField(key, jfieldIDV8ValueStringValue);
+                auto v8LocalString = v8Runtime->v8PropertyKeyCache->GetName(jniEnv, v8Runtime->v8Isolate, mKey);
+                DELETE_LOCAL_REF(jniEnv, mKey);
+                if (!v8LocalString.IsEmpty()) {
+                    return v8LocalString;
+                }
+            }
+            return ToV8Value(jniEnv, v8Runtime->v8Isolate, v8Context, key);
+        }
+
+        V8LocalString ToV8PropertyName(
+            JNIEnv* jniEnv,
+            V8Runtime* v8Runtime,
+            const jstring mName) noexcept {
+            if (v8Runtime->v8PropertyKeyCache->IsEnabled()) {
+                auto v8LocalString = v8Runtime->v8PropertyKeyCache->GetName(jniEnv, v8Runtime->v8Isolate, mName);
+                if (!v8LocalString.IsEmpty()) {
+                    return v8LocalString;
+                }
+            }
+            return ToV8String(jniEnv, v8Runtime->v8Isolate, mName);
+        }
+
         std::unique_ptr<v8::ScriptOrigin> ToV8ScriptOringinPointer(
             JNIEnv* jniEnv,
             V8Isolate* v8Isolate,
@@ -1120,6 +1243,20 @@ namespace Javet {
                 V8LocalPrimitiveArray());
         }
 
+        V8LocalString ToV8SourceString(
+            JNIEnv* jniEnv,
+            V8Isolate* v8Isolate,
+            const jobject mScriptSource) noexcept {
+            if (IsV8ExternalSource(jniEnv, mScriptSource)) {
+                auto handle = jniEnv->CallLongMethod(mScriptSource, jmethodIDV8ExternalSourceGetHandle);
+                if (handle == 0L) {
+                    return V8LocalString();
+                }
+                return reinterpret_cast<Javet::ExternalSource::ExternalSourceData*>(handle)->ToV8String(v8Isolate);
+            }
+            return ToV8String(jniEnv, v8Isolate, (jstring)mScriptSource);
+        }
+
         V8LocalString ToV8String(
             JNIEnv* jniEnv,
             V8Isolate* v8Isolate,
@@ -1127,15 +1264,16 @@ namespace Javet {
             if (mString == nullptr) {
                 return V8LocalString();
             }
-            const uint16_t* unmanagedString = jniEnv->GetStringChars(mString, nullptr);
-            int length = jniEnv->GetStringLength(mString);
-            auto twoByteString = v8::String::NewFromTwoByte(
-                v8Isolate, unmanagedString, v8::NewStringType::kNormal, length);
-            jniEnv->ReleaseStringChars(mString, unmanagedString);
-            if (twoByteString.IsEmpty()) {
+            JavaStringCharacters javaStringCharacters(jniEnv, mString);
+            V8MaybeLocalString v8MaybeLocalString = javaStringCharacters.IsOneByte()
+                ? v8::String::NewFromOneByte(
+                    v8Isolate, javaStringCharacters.GetOneByteData(), v8::NewStringType::kNormal, javaStringCharacters.GetLength())
+                : v8::String::NewFromTwoByte(
+                    v8Isolate, javaStringCharacters.GetTwoByteData(), v8::NewStringType::kNormal, javaStringCharacters.GetLength());
+            if (v8MaybeLocalString.IsEmpty()) {
                 return V8LocalString();
             }
-            return twoByteString.ToLocalChecked();
+            return v8MaybeLocalString.ToLocalChecked();
         }
 
         V8LocalValue ToV8Value(
@@ -1143,90 +1281,71 @@ namespace Javet {
             V8Isolate* v8Isolate,
             const V8LocalContext& v8Context,
             const jobject obj) noexcept {
-            if (obj == nullptr || IsV8ValueNull(jniEnv, obj)) {
+            if (obj == nullptr) {
                 return ToV8Null(v8Isolate);
             }
-            else if (IsV8ValueInteger(jniEnv, obj)) {
-                jint integerObject = ToJavaIntegerFromV8ValueInteger(jniEnv, obj);
-                return ToV8Integer(v8Isolate, integerObject);
+            // One instanceof check guards the field access against arbitrary Java objects.
+            if (!jniEnv->IsInstanceOf(obj, jclassV8Value)) {
+                return ToV8Undefined(v8Isolate);
             }
-            else if (IsV8ValueString(jniEnv, obj)) {
-                jstring stringObject = ToJavaStringFromV8ValueString(jniEnv, obj);
+            switch (jniEnv->GetIntField(obj, jfieldIDV8ValueTypeTag)) {
+            case Javet::Enums::V8ValueTypeTag::Null:
+                return ToV8Null(v8Isolate);
+            case Javet::Enums::V8ValueTypeTag::Integer:
+                return ToV8Integer(v8Isolate, ToJavaIntegerFromV8ValueInteger(jniEnv, obj));
+            case Javet::Enums::V8ValueTypeTag::String: {
+                jstring stringObject = (jstring)jniEnv->GetObjectField(obj, jfieldIDV8ValueStringValue);
                 auto v8String = ToV8String(jniEnv, v8Isolate, stringObject);
                 DELETE_LOCAL_REF(jniEnv, stringObject);
                 return v8String;
             }
-            else if (IsV8ValueBoolean(jniEnv, obj)) {
-                jboolean booleanObject = jniEnv->CallBooleanMethod(obj, jmethodIDV8ValueBooleanToPrimitive);
-                return ToV8Boolean(v8Isolate, booleanObject);
-            }
-            else if (IsV8ValueDouble(jniEnv, obj)) {
-                jdouble doubleObject = jniEnv->CallDoubleMethod(obj, jmethodIDV8ValueDoubleToPrimitive);
-                return ToV8Double(v8Isolate, doubleObject);
-            }
-            else if (IsV8ValueLong(jniEnv, obj)) {
-                jlong longObject = jniEnv->CallLongMethod(obj, jmethodIDV8ValueLongToPrimitive);
-                return ToV8Long(v8Isolate, longObject);
-            }
-            else if (IsV8ValueZonedDateTime(jniEnv, obj)) {
-                jlong longObject = (jlong)jniEnv->CallLongMethod(obj, jmethodIDV8ValueZonedDateTimeToPrimitive);
-                return ToV8Date(v8Context, longObject);
-            }
-            else if (IsV8ValueBigInteger(jniEnv, obj)) {
+            case Javet::Enums::V8ValueTypeTag::Boolean:
+                return ToV8Boolean(v8Isolate, jniEnv->CallBooleanMethod(obj, jmethodIDV8ValueBooleanToPrimitive));
+            case Javet::Enums::V8ValueTypeTag::Double:
+                return ToV8Double(v8Isolate, jniEnv->CallDoubleMethod(obj, jmethodIDV8ValueDoubleToPrimitive));
+            case Javet::Enums::V8ValueTypeTag::Long:
+                return ToV8Long(v8Isolate, jniEnv->CallLongMethod(obj, jmethodIDV8ValueLongToPrimitive));
+            case Javet::Enums::V8ValueTypeTag::ZonedDateTime:
+                return ToV8Date(v8Context, (jlong)jniEnv->CallLongMethod(obj, jmethodIDV8ValueZonedDateTimeToPrimitive));
+            case Javet::Enums::V8ValueTypeTag::BigInteger: {
                 jint signum = jniEnv->CallIntMethod(obj, jmethodIDV8ValueBigIntegerGetSignum);
                 jlongArray longArray = (jlongArray)jniEnv->CallObjectMethod(obj, jmethodIDV8ValueBigIntegerGetLongArray);
                 return ToV8BigInt(jniEnv, v8Isolate, v8Context, signum, longArray);
             }
-            else if (IsV8ValueReference(jniEnv, obj)) {
-                if (IsV8ValueArray(jniEnv, obj)) {
-                    return V8LocalArray::New(v8Isolate, TO_V8_PERSISTENT_ARRAY(
-                        jniEnv->CallLongMethod(obj, jmethodIDV8ValueArrayGetHandle)));
-                }
-                else if (IsV8ValueGlobalObject(jniEnv, obj)) {
-                    // Global object is a tricky one. 
-                    return V8LocalObject::New(v8Isolate, TO_V8_PERSISTENT_OBJECT(
-                        jniEnv->CallLongMethod(obj, jmethodIDV8ValueGlobalObjectGetHandle)));
-                }
-                else if (IsV8ValueMap(jniEnv, obj)) {
-                    return V8LocalMap::New(v8Isolate, TO_V8_PERSISTENT_MAP(
-                        jniEnv->CallLongMethod(obj, jmethodIDV8ValueMapGetHandle)));
-                }
-                else if (IsV8ValuePromise(jniEnv, obj)) {
-                    return V8LocalPromise::New(v8Isolate, TO_V8_PERSISTENT_PROMISE(
-                        jniEnv->CallLongMethod(obj, jmethodIDV8ValuePromiseGetHandle)));
-                }
-                else if (IsV8ValueProxy(jniEnv, obj)) {
-                    return V8LocalProxy::New(v8Isolate, TO_V8_PERSISTENT_PROXY(
-                        jniEnv->CallLongMethod(obj, jmethodIDV8ValueProxyGetHandle)));
-                }
-                else if (IsV8ValueRegExp(jniEnv, obj)) {
-                    return V8LocalRegExp::New(v8Isolate, TO_V8_PERSISTENT_REG_EXP(
-                        jniEnv->CallLongMethod(obj, jmethodIDV8ValueRegExpGetHandle)));
-                }
-                else if (IsV8ValueSet(jniEnv, obj)) {
-                    return V8LocalSet::New(v8Isolate, TO_V8_PERSISTENT_SET(
-                        jniEnv->CallLongMethod(obj, jmethodIDV8ValueSetGetHandle)));
-                }
-                else if (IsV8ValueSymbol(jniEnv, obj)) {
-                    return V8LocalSymbol::New(v8Isolate, TO_V8_PERSISTENT_SYMBOL(
-                        jniEnv->CallLongMethod(obj, jmethodIDV8ValueSymbolGetHandle)));
-                }
-                else if (IsV8ValueSymbolObject(jniEnv, obj)) {
-                    return V8LocalSymbolObject::New(v8Isolate, TO_V8_PERSISTENT_SYMBOL_OBJECT(
-                        jniEnv->CallLongMethod(obj, jmethodIDV8ValueSymbolObjectGetHandle)));
-                }
-                else if (
-                    IsV8ValueArguments(jniEnv, obj) ||
-                    IsV8ValueError(jniEnv, obj) ||
-                    IsV8ValueIterator(jniEnv, obj) ||
-                    IsV8ValueObject(jniEnv, obj) ||
-                    IsV8ValueWeakMap(jniEnv, obj) ||
-                    IsV8ValueWeakSet(jniEnv, obj)) {
-                    return V8LocalObject::New(v8Isolate, TO_V8_PERSISTENT_OBJECT(
-                        jniEnv->CallLongMethod(obj, jmethodIDV8ValueObjectGetHandle)));
-                }
+            case Javet::Enums::V8ValueTypeTag::Array:
+                return V8LocalArray::New(v8Isolate, TO_V8_PERSISTENT_ARRAY(
+                    jniEnv->GetLongField(obj, jfieldIDV8ValueReferenceHandle)));
+            case Javet::Enums::V8ValueTypeTag::GlobalObject:
+                // Global object is a tricky one. 
+                return V8LocalObject::New(v8Isolate, TO_V8_PERSISTENT_OBJECT(
+                    jniEnv->GetLongField(obj, jfieldIDV8ValueReferenceHandle)));
+            case Javet::Enums::V8ValueTypeTag::Map:
+                return V8LocalMap::New(v8Isolate, TO_V8_PERSISTENT_MAP(
+                    jniEnv->GetLongField(obj, jfieldIDV8ValueReferenceHandle)));
+            case Javet::Enums::V8ValueTypeTag::Promise:
+                return V8LocalPromise::New(v8Isolate, TO_V8_PERSISTENT_PROMISE(
+                    jniEnv->GetLongField(obj, jfieldIDV8ValueReferenceHandle)));
+            case Javet::Enums::V8ValueTypeTag::Proxy:
+                return V8LocalProxy::New(v8Isolate, TO_V8_PERSISTENT_PROXY(
+                    jniEnv->GetLongField(obj, jfieldIDV8ValueReferenceHandle)));
+            case Javet::Enums::V8ValueTypeTag::RegExp:
+                return V8LocalRegExp::New(v8Isolate, TO_V8_PERSISTENT_REG_EXP(
+                    jniEnv->GetLongField(obj, jfieldIDV8ValueReferenceHandle)));
+            case Javet::Enums::V8ValueTypeTag::Set:
+                return V8LocalSet::New(v8Isolate, TO_V8_PERSISTENT_SET(
+                    jniEnv->GetLongField(obj, jfieldIDV8ValueReferenceHandle)));
+            case Javet::Enums::V8ValueTypeTag::Symbol:
+                return V8LocalSymbol::New(v8Isolate, TO_V8_PERSISTENT_SYMBOL(
+                    jniEnv->GetLongField(obj, jfieldIDV8ValueReferenceHandle)));
+            case Javet::Enums::V8ValueTypeTag::SymbolObject:
+                return V8LocalSymbolObject::New(v8Isolate, TO_V8_PERSISTENT_SYMBOL_OBJECT(
+                    jniEnv->GetLongField(obj, jfieldIDV8ValueReferenceHandle)));
+            case Javet::Enums::V8ValueTypeTag::Object:
+                return V8LocalObject::New(v8Isolate, TO_V8_PERSISTENT_OBJECT(
+                    jniEnv->GetLongField(obj, jfieldIDV8ValueReferenceHandle)));
+            default:
+                return ToV8Undefined(v8Isolate);
             }
-            return ToV8Undefined(v8Isolate);
         }
 
         std::unique_ptr<V8LocalObject[]> ToV8Objects(
@@ -19,6 +19,8 @@
 #pragma once
 
 #include <jni.h>
+#include <cmath>
+#include <memory>
 #include "javet_constants.h"
 #include "javet_monitor.h"
 #include "javet_native.h"
@@ -38,19 +40,75 @@ namespace Javet {
         extern jclass jclassV8ValueSymbol;
 
         extern jclass jclassByteBuffer;
+        extern jmethodID jmethodIDByteBufferAllocateDirect;
+        extern jmethodID jmethodIDByteBufferPosition;
         extern jclass jclassString;
 
+        extern jclass jclassV8ExternalSource;
+        extern jmethodID jmethodIDV8ExternalSourceGetHandle;
+
         extern jclass jclassIV8ValueFunctionScriptSource;
         extern jmethodID jmethodIDIV8ValueFunctionScriptSourceConstructor;
         extern jmethodID jmethodIDIV8ValueFunctionScriptGetCode;
         extern jmethodID jmethodIDIV8ValueFunctionScriptGetEndPosition;
         extern jmethodID jmethodIDIV8ValueFunctionScriptGetStartPosition;
 
+        /*
+         * The inline buffer keeps short strings on the stack
+         * and only allocates on the heap for long strings.
+         */
+        template<typename T, size_t InlineCapacity = 256>
+        class InlineBuffer {
+        public:
+            InlineBuffer(const size_t capacity) noexcept
+                : heapBuffer(capacity > InlineCapacity ? new T[capacity] : nullptr) {
+            }
+            inline T* Get() noexcept {
+                return heapBuffer ? heapBuffer.get() : inlineBuffer;
+            }
+        private:
+            std::unique_ptr<T[]> heapBuffer;
+            T inlineBuffer[InlineCapacity];
+        };
+
+        /*
+         * The Java string characters classify a Java string once.
+         * A pure ASCII string is copied as one-byte characters, otherwise as UTF-16 code units,
+         * so that V8 strings and inspector string views can be created with a single copy.
+         */
+        class JavaStringCharacters {
+        public:
+            JavaStringCharacters(JNIEnv* jniEnv, const jstring mString) noexcept;
+            inline const uint8_t* GetOneByteData() noexcept {
+                return reinterpret_cast<const uint8_t*>(buffer.Get());
+            }
+            inline int GetLength() const noexcept {
+                return length;
+            }
+            inline const uint16_t* GetTwoByteData() noexcept {
+                return buffer.Get();
+            }
+            inline bool IsOneByte() const noexcept {
+                return oneByte;
+            }
+        private:
+            // The buffer is sized for UTF-16 code units plus the terminator written by GetStringUTFRegion.
+            InlineBuffer<uint16_t> buffer;
+            int length;
+            bool oneByte;
+        };
+
         template<typename T1, typename T2>
         constexpr auto IsJavaByteBuffer(T1 jniEnv, T2 obj) {
             return jniEnv->IsInstanceOf(obj, jclassByteBuffer);
         }
 
+        template<typename T1, typename T2>
+        constexpr auto IsV8ExternalSource(T1 jniEnv, T2 obj) {
+            // IsInstanceOf() is true for null.
+            return obj != nullptr && jniEnv->IsInstanceOf(obj, jclassV8ExternalSource);
+        }
+
         template<typename T1, typename T2>
         constexpr auto IsV8ValueInteger(T1 jniEnv, T2 obj) {
             return jniEnv->IsInstanceOf(obj, jclassV8ValueInteger);
@@ -82,10 +140,52 @@ namespace Javet {
             JNIEnv* jniEnv,
             const jbyteArray mCachedArray) noexcept;
 
+        /*
+         * The primitive converters below are for the typed batch getters.
+         * They never call into JavaScript. A V8 value of another type or a lossy conversion
+         * is reported by valid being false and marked by false, NaN or 0 respectively.
+         */
+        static inline jboolean ToJavaBooleanOrFalse(const V8LocalValue& v8LocalValue, bool& valid) noexcept {
+            valid = v8LocalValue->IsBoolean();
+            return valid && v8LocalValue->IsTrue();
+        }
+
         jbyteArray ToJavaByteArray(
             JNIEnv* jniEnv,
             const V8ScriptCompilerCachedData* cachedDataPointer) noexcept;
 
+        static inline jdouble ToJavaDoubleOrNaN(const V8LocalValue& v8LocalValue, bool& valid) noexcept {
+            valid = v8LocalValue->IsNumber();
+            return valid ? v8LocalValue.As<v8::Number>()->Value() : NAN;
+        }
+
+        static inline jint ToJavaIntegerOrZero(const V8LocalValue& v8LocalValue, bool& valid) noexcept {
+            valid = v8LocalValue->IsInt32();
+            return valid ? v8LocalValue.As<v8::Int32>()->Value() : 0;
+        }
+
+        static inline jlong ToJavaLongOrZero(const V8LocalValue& v8LocalValue, bool& valid) noexcept {
+            valid = true;
+            if (v8LocalValue->IsInt32()) {
+                return v8LocalValue.As<v8::Int32>()->Value();
+            }
+            if (v8LocalValue->IsBigInt()) {
+                // Big integers beyond the range of long are not truncated silently.
+                jlong longValue = v8LocalValue.As<v8::BigInt>()->Int64Value(&valid);
+                return valid ? longValue : 0;
+            }
+            if (v8LocalValue->IsNumber()) {
+                // Only integral numbers within the range of long are accepted.
+                double doubleValue = v8LocalValue.As<v8::Number>()->Value();
+                if (doubleValue >= -9223372036854775808.0 && doubleValue < 9223372036854775808.0
+                    && std::trunc(doubleValue) == doubleValue) {
+                    return static_cast<jlong>(doubleValue);
+                }
+            }
+            valid = false;
+            return 0;
+        }
+
         static inline jstring ToJavaString(
             JNIEnv* jniEnv,
             const char* utfString) noexcept {
@@ -98,18 +198,35 @@ namespace Javet {
             return jniEnv->NewStringUTF(stdString.c_str());
         }
 
+        /*
+         * The one-byte string is treated as Latin-1.
+         * Pure ASCII goes through NewStringUTF which lands in a compact Latin-1 Java string
+         * with a single copy. The rest is widened to UTF-16.
+         */
+        jstring ToJavaString(
+            JNIEnv* jniEnv,
+            const uint8_t* oneByteString,
+            const int length) noexcept;
+
         static inline jstring ToJavaString(
             JNIEnv* jniEnv,
-            V8Isolate* v8Isolate,
-            const V8LocalString& v8LocalString) noexcept {
-            V8StringValue v8StringValue(v8Isolate, v8LocalString);
-            return jniEnv->NewString(*v8StringValue, v8StringValue.length());
+            const uint16_t* twoByteString,
+            const int length) noexcept {
+            return jniEnv->NewString(twoByteString, length);
         }
 
+        jstring ToJavaString(
+            JNIEnv* jniEnv,
+            V8Isolate* v8Isolate,
+            const V8LocalString& v8LocalString) noexcept;
+
         static inline jstring ToJavaString(
             JNIEnv* jniEnv,
             V8Isolate* v8Isolate,
             const V8LocalValue& v8LocalValue) noexcept {
+            if (v8LocalValue->IsString()) {
+                return ToJavaString(jniEnv, v8Isolate, v8LocalValue.As<v8::String>());
+            }
             V8StringUtf8Value v8StringUtf8Value(v8Isolate, v8LocalValue);
             return jniEnv->NewStringUTF(*v8StringUtf8Value);
         }
@@ -266,13 +383,31 @@ namespace Javet {
 
         template<class T>
         static inline jlong ToV8PersistentReference(
-            V8Isolate* v8Isolate,
+            const V8Runtime* v8Runtime,
             const v8::Local<T>& v8Data) noexcept {
-            v8::Persistent<T>* v8PersistentDataPointer = new v8::Persistent<T>(v8Isolate, v8Data);
-            INCREASE_COUNTER(Javet::Monitor::CounterType::NewPersistentReference);
-            return TO_JAVA_LONG(v8PersistentDataPointer);
+            return v8Runtime->v8PersistentReferenceTable->Allocate(v8Runtime->v8Isolate, v8Data);
         }
 
+        /*
+         * The private key, the property key and the property name go through
+         * the per-runtime property key cache if it is enabled.
+         */
+        V8LocalPrivate ToV8PrivateKey(
+            JNIEnv* jniEnv,
+            V8Runtime* v8Runtime,
+            const jstring mKey) noexcept;
+
+        V8LocalValue ToV8PropertyKey(
+            JNIEnv* jniEnv,
+            V8Runtime* v8Runtime,
+            const V8LocalContext& v8Context,
+            const jobject key) noexcept;
+
+        V8LocalString ToV8PropertyName(
+            JNIEnv* jniEnv,
+            V8Runtime* v8Runtime,
+            const jstring mName) noexcept;
+
         std::unique_ptr<v8::ScriptOrigin> ToV8ScriptOringinPointer(
             JNIEnv* jniEnv,
             V8Isolate* v8Isolate,
@@ -289,6 +424,15 @@ namespace Javet {
             return v8::String::NewFromUtf8(v8Isolate, str).ToLocalChecked();
         }
 
+        /*
+         * The script source is either a Java string or a V8 external source.
+         * The latter is exposed to V8 as an external string without copying.
+         */
+        V8LocalString ToV8SourceString(
+            JNIEnv* jniEnv,
+            V8Isolate* v8Isolate,
+            const jobject mScriptSource) noexcept;
+
         V8LocalString ToV8String(
             JNIEnv* jniEnv,
             V8Isolate* v8Isolate,
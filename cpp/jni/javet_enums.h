@@ -19,6 +19,17 @@
 
 namespace Javet {
     namespace Enums {
+        namespace JavetPrimitiveType {
+            enum JavetPrimitiveType {
+                Void = 0,
+                Boolean = 1,
+                Int = 2,
+                Long = 3,
+                Double = 4,
+                String = 5,
+            };
+        };
+
         namespace NodeScriptMode {
             enum NodeScriptMode {
                 String = 0,
@@ -174,6 +185,32 @@ namespace Javet {
             };
         };
 
+        namespace V8ValueTypeTag {
+            enum V8ValueTypeTag {
+                Unknown = 0,
+                Undefined = 1,
+                Null = 2,
+                Boolean = 3,
+                Integer = 4,
+                Long = 5,
+                Double = 6,
+                String = 7,
+                BigInteger = 8,
+                ZonedDateTime = 9,
+                Reference = 10,
+                Object = 11,
+                Array = 12,
+                GlobalObject = 13,
+                Map = 14,
+                Promise = 15,
+                Proxy = 16,
+                RegExp = 17,
+                Set = 18,
+                Symbol = 19,
+                SymbolObject = 20,
+            };
+        };
+
         namespace JSFunctionType {
             enum JSFunctionType {
                 Native = 0,
@@ -33,6 +33,11 @@ namespace Javet {
 
             jclassJavetConverterException = FIND_CLASS(jniEnv, "com/caoccao/javet/exceptions/JavetConverterException");
 
+            jclassJavetError = FIND_CLASS(jniEnv, "com/caoccao/javet/exceptions/JavetError");
+
+            jclassJavetException = FIND_CLASS(jniEnv, "com/caoccao/javet/exceptions/JavetException");
+            jmethodIDJavetExceptionConstructor = jniEnv->GetMethodID(jclassJavetException, "<init>", "(Lcom/caoccao/javet/exceptions/JavetError;)V");
+
             jclassJavetExecutionException = FIND_CLASS(jniEnv, "com/caoccao/javet/exceptions/JavetExecutionException");
             jmethodIDJavetExecutionExceptionConstructor = jniEnv->GetMethodID(jclassJavetExecutionException, "<init>", "(Lcom/caoccao/javet/exceptions/JavetScriptingError;Ljava/lang/Throwable;)V");
 
@@ -114,6 +119,23 @@ namespace Javet {
             return nullptr;
         }
 
+        jobject ThrowJavetException(
+            JNIEnv* jniEnv,
+            const char* javetErrorName) noexcept {
+            LOG_ERROR("Javet exception " << javetErrorName << ".");
+            jfieldID jfieldIDJavetError = jniEnv->GetStaticFieldID(
+                jclassJavetError, javetErrorName, "Lcom/caoccao/javet/exceptions/JavetError;");
+            jobject mJavetError = jniEnv->GetStaticObjectField(jclassJavetError, jfieldIDJavetError);
+            jthrowable javetException = (jthrowable)jniEnv->NewObject(
+                jclassJavetException,
+                jmethodIDJavetExceptionConstructor,
+                mJavetError);
+            jniEnv->DeleteLocalRef(mJavetError);
+            jniEnv->Throw(javetException);
+            jniEnv->DeleteLocalRef(javetException);
+            return nullptr;
+        }
+
         jobject ThrowJavetExecutionException(
             JNIEnv* jniEnv,
             V8Runtime* v8Runtime,
@@ -30,6 +30,11 @@ namespace Javet {
 
         static jclass jclassJavetConverterException;
 
+        static jclass jclassJavetError;
+
+        static jclass jclassJavetException;
+        static jmethodID jmethodIDJavetExceptionConstructor;
+
         static jclass jclassJavetExecutionException;
         static jmethodID jmethodIDJavetExecutionExceptionConstructor;
 
@@ -71,6 +76,14 @@ namespace Javet {
             return nullptr;
         }
 
+        /*
+         * The JavetException is thrown with the JavetError of the given name,
+         * e.g. RuntimeExternalSourceInvalid.
+         */
+        jobject ThrowJavetException(
+            JNIEnv* jniEnv,
+            const char* javetErrorName) noexcept;
+
         jobject ThrowJavetExecutionException(
             JNIEnv* jniEnv,
             V8Runtime* v8Runtime,
@@ -0,0 +1,106 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include "javet_external_source.h"
+#include "javet_monitor.h"
+#include "javet_native.h"
+
+namespace Javet {
+    namespace ExternalSource {
+        ExternalSourceData::ExternalSourceData(JNIEnv* jniEnv, const jobject mByteBuffer, const bool oneByte) noexcept
+            : oneByte(oneByte), referenceCount(1) {
+            this->mByteBuffer = jniEnv->NewGlobalRef(mByteBuffer);
+            INCREASE_COUNTER(Javet::Monitor::CounterType::NewGlobalRef);
+            data = jniEnv->GetDirectBufferAddress(mByteBuffer);
+            auto capacity = static_cast<size_t>(jniEnv->GetDirectBufferCapacity(mByteBuffer));
+            length = oneByte ? capacity : capacity / sizeof(uint16_t);
+        }
+
+        void ExternalSourceData::Release() noexcept {
+            if (referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete this;
+            }
+        }
+
+        V8LocalString ExternalSourceData::ToV8String(V8Isolate* v8Isolate) noexcept {
+            V8MaybeLocalString v8MaybeLocalString;
+            // V8 disposes the resource once the string is collected, or immediately if the source is empty.
+            Retain();
+            if (oneByte) {
+                auto resource = new ExternalOneByteSourceResource(this);
+                v8MaybeLocalString = v8::String::NewExternalOneByte(v8Isolate, resource);
+                if (v8MaybeLocalString.IsEmpty()) {
+                    resource->Dispose();
+                }
+            }
+            else {
+                auto resource = new ExternalTwoByteSourceResource(this);
+                v8MaybeLocalString = v8::String::NewExternalTwoByte(v8Isolate, resource);
+                if (v8MaybeLocalString.IsEmpty()) {
+                    resource->Dispose();
+                }
+            }
+            if (v8MaybeLocalString.IsEmpty()) {
+                return V8LocalString();
+            }
+            return v8MaybeLocalString.ToLocalChecked();
+        }
+
+        ExternalSourceData::~ExternalSourceData() {
+            FETCH_JNI_ENV(GlobalJavaVM);
+            if (jniEnv != nullptr) {
+                jniEnv->DeleteGlobalRef(mByteBuffer);
+                INCREASE_COUNTER(Javet::Monitor::CounterType::DeleteGlobalRef);
+            }
+            mByteBuffer = nullptr;
+        }
+
+        ExternalOneByteSourceResource::ExternalOneByteSourceResource(ExternalSourceData* externalSourceData) noexcept
+            : externalSourceData(externalSourceData) {
+        }
+
+        const char* ExternalOneByteSourceResource::data() const {
+            return static_cast<const char*>(externalSourceData->GetData());
+        }
+
+        size_t ExternalOneByteSourceResource::length() const {
+            return externalSourceData->GetLength();
+        }
+
+        void ExternalOneByteSourceResource::Dispose() {
+            externalSourceData->Release();
+            delete this;
+        }
+
+        ExternalTwoByteSourceResource::ExternalTwoByteSourceResource(ExternalSourceData* externalSourceData) noexcept
+            : externalSourceData(externalSourceData) {
+        }
+
+        const uint16_t* ExternalTwoByteSourceResource::data() const {
+            return static_cast<const uint16_t*>(externalSourceData->GetData());
+        }
+
+        size_t ExternalTwoByteSourceResource::length() const {
+            return externalSourceData->GetLength();
+        }
+
+        void ExternalTwoByteSourceResource::Dispose() {
+            externalSourceData->Release();
+            delete this;
+        }
+    }
+}
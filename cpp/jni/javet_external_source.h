@@ -0,0 +1,86 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#pragma once
+
+#include <jni.h>
+#include <atomic>
+#include "javet_v8.h"
+
+namespace Javet {
+    namespace ExternalSource {
+        /*
+         * The external source data keeps a Java direct byte buffer alive
+         * and lends its memory to V8 external strings in any isolate of the process.
+         * It is reference counted: one reference is held by the Java side
+         * and one reference is held by every V8 string created from it,
+         * so that the byte buffer is released only after the last user is gone.
+         */
+        class ExternalSourceData {
+        public:
+            ExternalSourceData(JNIEnv* jniEnv, const jobject mByteBuffer, const bool oneByte) noexcept;
+
+            inline const void* GetData() const noexcept {
+                return data;
+            }
+
+            inline size_t GetLength() const noexcept {
+                return length;
+            }
+
+            inline bool IsOneByte() const noexcept {
+                return oneByte;
+            }
+
+            inline void Retain() noexcept {
+                referenceCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void Release() noexcept;
+            V8LocalString ToV8String(V8Isolate* v8Isolate) noexcept;
+
+        private:
+            const void* data;
+            size_t length;
+            jobject mByteBuffer;
+            bool oneByte;
+            std::atomic<int> referenceCount;
+
+            ~ExternalSourceData();
+        };
+
+        class ExternalOneByteSourceResource final : public v8::String::ExternalOneByteStringResource {
+        public:
+            ExternalOneByteSourceResource(ExternalSourceData* externalSourceData) noexcept;
+            const char* data() const override;
+            size_t length() const override;
+            void Dispose() override;
+        private:
+            ExternalSourceData* externalSourceData;
+        };
+
+        class ExternalTwoByteSourceResource final : public v8::String::ExternalStringResource {
+        public:
+            ExternalTwoByteSourceResource(ExternalSourceData* externalSourceData) noexcept;
+            const uint16_t* data() const override;
+            size_t length() const override;
+            void Dispose() override;
+        private:
+            ExternalSourceData* externalSourceData;
+        };
+    }
+}
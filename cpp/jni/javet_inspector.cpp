@@ -32,24 +32,33 @@ namespace Javet {
                 stdString.length());
         }
 
-        static inline std::unique_ptr<std::string> ConvertFromStringBufferToStdStringPointer(
+        static inline jstring ConvertFromStringViewToJavaString(
+            JNIEnv* jniEnv,
+            const v8_inspector::StringView& stringView) {
+            int length = static_cast<int>(stringView.length());
+            if (stringView.is8Bit()) {
+                return Javet::Converter::ToJavaString(jniEnv, stringView.characters8(), length);
+            }
+            return Javet::Converter::ToJavaString(jniEnv, stringView.characters16(), length);
+        }
+
+        static inline std::string ConvertFromStringViewToStdString(
             v8::Isolate* v8Isolate,
-            v8_inspector::StringBuffer* stringBuffer) {
-            auto stringViewMessage = stringBuffer->string();
-            int length = static_cast<int>(stringViewMessage.length());
+            const v8_inspector::StringView& stringView) {
+            int length = static_cast<int>(stringView.length());
             V8LocalString v8StringMessage;
             if (length > 0) {
-                if (stringViewMessage.is8Bit()) {
-                    v8StringMessage = v8::String::NewFromOneByte(v8Isolate, reinterpret_cast<const uint8_t*>(
-                        stringViewMessage.characters8()), v8::NewStringType::kNormal, length).ToLocalChecked();
+                if (stringView.is8Bit()) {
+                    v8StringMessage = v8::String::NewFromOneByte(
+                        v8Isolate, stringView.characters8(), v8::NewStringType::kNormal, length).ToLocalChecked();
                 }
                 else {
-                    v8StringMessage = v8::String::NewFromTwoByte(v8Isolate, reinterpret_cast<const uint16_t*>(
-                        stringViewMessage.characters16()), v8::NewStringType::kNormal, length).ToLocalChecked();
+                    v8StringMessage = v8::String::NewFromTwoByte(
+                        v8Isolate, stringView.characters16(), v8::NewStringType::kNormal, length).ToLocalChecked();
                 }
             }
             V8StringUtf8Value v8Utf8Value(v8Isolate, v8StringMessage);
-            return std::make_unique<std::string>(*v8Utf8Value);
+            return std::string(*v8Utf8Value);
         }
 
         void Initialize(JNIEnv* jniEnv) noexcept {
@@ -73,10 +82,9 @@ namespace Javet {
             jniEnv->ReleaseStringUTFChars(mName, umName);
         }
 
-        void JavetInspector::send(const std::string& message) noexcept {
-            LOG_DEBUG("Sending request: " << message);
-            auto stringViewMessagePointer = ConvertFromStdStringToStringViewPointer(message);
-            client->dispatchProtocolMessage(*stringViewMessagePointer.get());
+        void JavetInspector::send(const v8_inspector::StringView& message) noexcept {
+            LOG_DEBUG("Sending request: " << ConvertFromStringViewToStdString(v8Runtime->v8Isolate, message));
+            client->dispatchProtocolMessage(message);
         }
 
         JavetInspector::~JavetInspector() {
@@ -153,10 +161,10 @@ namespace Javet {
         void JavetInspectorChannel::sendNotification(std::unique_ptr<v8_inspector::StringBuffer> message) {
             // The lock is not required.
             V8HandleScope v8HandleScope(v8Runtime->v8Isolate);
-            auto stdStringMessagePointer = ConvertFromStringBufferToStdStringPointer(v8Runtime->v8Isolate, message.get());
-            LOG_DEBUG("Sending notification: " << *stdStringMessagePointer.get());
+            auto stringViewMessage = message->string();
+            LOG_DEBUG("Sending notification: " << ConvertFromStringViewToStdString(v8Runtime->v8Isolate, stringViewMessage));
             FETCH_JNI_ENV(GlobalJavaVM);
-            jstring jMessage = Javet::Converter::ToJavaString(jniEnv, stdStringMessagePointer->c_str());
+            jstring jMessage = ConvertFromStringViewToJavaString(jniEnv, stringViewMessage);
             jniEnv->CallVoidMethod(mV8Inspector, jmethodIDV8InspectorReceiveNotification, jMessage);
             jniEnv->DeleteLocalRef(jMessage);
         }
@@ -164,10 +172,10 @@ namespace Javet {
         void JavetInspectorChannel::sendResponse(int callId, std::unique_ptr<v8_inspector::StringBuffer> message) {
             // The lock is not required.
             V8HandleScope v8HandleScope(v8Runtime->v8Isolate);
-            auto stdStringMessagePointer = ConvertFromStringBufferToStdStringPointer(v8Runtime->v8Isolate, message.get());
-            LOG_DEBUG("Sending response: " << *stdStringMessagePointer.get());
+            auto stringViewMessage = message->string();
+            LOG_DEBUG("Sending response: " << ConvertFromStringViewToStdString(v8Runtime->v8Isolate, stringViewMessage));
             FETCH_JNI_ENV(GlobalJavaVM);
-            jstring jMessage = Javet::Converter::ToJavaString(jniEnv, stdStringMessagePointer->c_str());
+            jstring jMessage = ConvertFromStringViewToJavaString(jniEnv, stringViewMessage);
             jniEnv->CallVoidMethod(mV8Inspector, jmethodIDV8InspectorReceiveResponse, jMessage);
             jniEnv->DeleteLocalRef(jMessage);
         }
@@ -39,7 +39,7 @@ namespace Javet {
         class JavetInspector {
         public:
             JavetInspector(V8Runtime* v8Runtime, const jobject mV8Inspector) noexcept;
-            void send(const std::string& message) noexcept;
+            void send(const v8_inspector::StringView& message) noexcept;
             virtual ~JavetInspector();
         private:
             jobject mV8Inspector;
@@ -18,13 +18,16 @@
 #include "com_caoccao_javet_interop_V8Native.h"
 #include "com_caoccao_javet_interop_NodeNative.h"
 #include "javet_callbacks.h"
+#include "javet_compile_hints.h"
 #include "javet_converter.h"
 #include "javet_enums.h"
 #include "javet_exceptions.h"
+#include "javet_external_source.h"
 #include "javet_inspector.h"
 #include "javet_monitor.h"
 #include "javet_logging.h"
 #include "javet_native.h"
 #include "javet_node.h"
+#include "javet_script_streaming.h"
 #include "javet_v8.h"
 #include "javet_v8_runtime.h"
@@ -27,6 +27,89 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayCreate
     return Javet::Converter::ToExternalV8ValueUndefined(jniEnv, v8Runtime);
 }
 
+/*
+ * Create an array from a Java primitive array in one call.
+ * The Java array is copied into a native buffer by a single region call,
+ * and the array is created with all its elements at once instead of growing element by element.
+ * v8::Array::New() always builds generic PACKED_ELEMENTS with the numbers boxed as heap numbers or smis,
+ * so numeric data that needs unboxed storage should go to a typed array instead.
+ */
+template<typename T, typename TArray, typename TConverter>
+static jobject ArrayCreateFromPrimitives(
+    JNIEnv* jniEnv, V8Runtime* v8Runtime, V8Isolate* v8Isolate, const V8LocalContext& v8Context,
+    TArray mValues, void (JNIEnv::* getArrayRegion)(TArray, jsize, jsize, T*), TConverter converter) {
+    jsize length = jniEnv->GetArrayLength(mValues);
+    std::unique_ptr<T[]> buffer(new T[length > 0 ? length : 1]);
+    (jniEnv->*getArrayRegion)(mValues, 0, length, buffer.get());
+    std::vector<V8LocalValue> v8LocalValues(length);
+    for (jsize i = 0; i < length; ++i) {
+        v8LocalValues[i] = converter(v8Isolate, buffer[i]);
+    }
+    auto v8LocalArray = v8::Array::New(v8Isolate, v8LocalValues.data(), length);
+    return v8Runtime->SafeToExternalV8Value(jniEnv, v8Isolate, v8Context, v8LocalArray);
+}
+
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayCreateFromBooleans
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jbooleanArray mValues) {
+    RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
+    return ArrayCreateFromPrimitives(
+        jniEnv, v8Runtime, v8Isolate, v8Context, mValues, &JNIEnv::GetBooleanArrayRegion,
+        [](V8Isolate* v8Isolate, jboolean value) -> V8LocalValue { return v8::Boolean::New(v8Isolate, value); });
+}
+
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayCreateFromDoubles
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jdoubleArray mValues) {
+    RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
+    return ArrayCreateFromPrimitives(
+        jniEnv, v8Runtime, v8Isolate, v8Context, mValues, &JNIEnv::GetDoubleArrayRegion,
+        [](V8Isolate* v8Isolate, jdouble value) -> V8LocalValue { return v8::Number::New(v8Isolate, value); });
+}
+
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayCreateFromIntegers
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jintArray mValues) {
+    RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
+    return ArrayCreateFromPrimitives(
+        jniEnv, v8Runtime, v8Isolate, v8Context, mValues, &JNIEnv::GetIntArrayRegion,
+        [](V8Isolate* v8Isolate, jint value) -> V8LocalValue { return v8::Integer::New(v8Isolate, value); });
+}
+
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayCreateFromLongs
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlongArray mValues) {
+    RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
+    // Long is mapped to BigInt as V8ValueLong is.
+    return ArrayCreateFromPrimitives(
+        jniEnv, v8Runtime, v8Isolate, v8Context, mValues, &JNIEnv::GetLongArrayRegion,
+        [](V8Isolate* v8Isolate, jlong value) -> V8LocalValue { return v8::BigInt::New(v8Isolate, value); });
+}
+
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayCreateFromStrings
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jobjectArray mValues) {
+    RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
+    jsize length = jniEnv->GetArrayLength(mValues);
+    std::vector<V8LocalValue> v8LocalValues(length);
+    for (jsize i = 0; i < length; ++i) {
+        jstring mString = (jstring)jniEnv->GetObjectArrayElement(mValues, i);
+        if (mString == nullptr) {
+            v8LocalValues[i] = v8::Null(v8Isolate);
+        }
+        else {
+            auto v8LocalString = Javet::Converter::ToV8String(jniEnv, v8Isolate, mString);
+            DELETE_LOCAL_REF(jniEnv, mString);
+            if (v8LocalString.IsEmpty()) {
+                // The string exceeds the maximum string length of V8.
+                if (Javet::Exceptions::HandlePendingException(jniEnv, v8Runtime, v8Context)) {
+                    return nullptr;
+                }
+                return Javet::Exceptions::ThrowJavetOutOfMemoryException(
+                    jniEnv, v8Isolate, "String creation failed");
+            }
+            v8LocalValues[i] = v8LocalString;
+        }
+    }
+    auto v8LocalArray = v8::Array::New(v8Isolate, v8LocalValues.data(), length);
+    return v8Runtime->SafeToExternalV8Value(jniEnv, v8Isolate, v8Context, v8LocalArray);
+}
+
 JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_arrayGetLength
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType) {
     RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
@@ -55,3 +138,236 @@ JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGet
     }
     return 0;
 }
+
+/*
+ * Get the item count of a typed batch get clipped by the array length and the Java array length.
+ */
+static jint GetBatchArrayGetLength(
+    JNIEnv* jniEnv, const V8LocalValue& v8LocalValue, jarray mValues, jint startIndex, jint endIndex) {
+    if (mValues == nullptr || startIndex < 0) {
+        return 0;
+    }
+    jint arrayLength;
+    if (v8LocalValue->IsArray()) {
+        arrayLength = (jint)v8LocalValue.As<v8::Array>()->Length();
+    }
+    else if (v8LocalValue->IsTypedArray()) {
+        arrayLength = (jint)v8LocalValue.As<v8::TypedArray>()->Length();
+    }
+    else {
+        return 0;
+    }
+    jint length = (endIndex > arrayLength ? arrayLength : endIndex) - startIndex;
+    jint valueLength = jniEnv->GetArrayLength(mValues);
+    return length > valueLength ? valueLength : length;
+}
+
+/*
+ * Batch get the given range of items from the array into a Java primitive array.
+ * The items are converted into a native buffer which is copied to Java by a single region call.
+ * Items of another type are marked by the converter and reported in the optional validity array.
+ */
+template<typename T, typename TArray, typename TConverter>
+static jint BatchArrayGetPrimitives(
+    JNIEnv* jniEnv, V8Runtime* v8Runtime, const V8LocalContext& v8Context, const V8LocalValue& v8LocalValue,
+    TArray mValues, jbooleanArray mValidities, jint startIndex, jint endIndex,
+    void (JNIEnv::* setArrayRegion)(TArray, jsize, jsize, const T*), TConverter converter) {
+    jint length = GetBatchArrayGetLength(jniEnv, v8LocalValue, mValues, startIndex, endIndex);
+    if (mValidities != nullptr) {
+        jint validityLength = jniEnv->GetArrayLength(mValidities);
+        length = length > validityLength ? validityLength : length;
+    }
+    if (length <= 0) {
+        return 0;
+    }
+    auto v8LocalObject = v8LocalValue.As<v8::Object>();
+    std::unique_ptr<T[]> buffer(new T[length]);
+    std::unique_ptr<jboolean[]> validityBuffer(new jboolean[length]);
+    jint i = 0;
+    for (; i < length; ++i) {
+        bool valid = false;
+        auto v8MaybeLocalValue = v8LocalObject->Get(v8Context, (uint32_t)(i + startIndex));
+        if (v8MaybeLocalValue.IsEmpty()) {
+            if (Javet::Exceptions::HandlePendingException(jniEnv, v8Runtime, v8Context)) {
+                break;
+            }
+            buffer[i] = converter(v8::Undefined(v8Runtime->v8Isolate), valid);
+        }
+        else {
+            buffer[i] = converter(v8MaybeLocalValue.ToLocalChecked(), valid);
+        }
+        validityBuffer[i] = valid;
+    }
+    if (i > 0) {
+        // JNI region calls are not allowed with a pending Java exception,
+        // so the exception raised by the getter is set aside while the read prefix is copied.
+        jthrowable mThrowable = jniEnv->ExceptionOccurred();
+        if (mThrowable != nullptr) {
+            jniEnv->ExceptionClear();
+        }
+        (jniEnv->*setArrayRegion)(mValues, 0, i, buffer.get());
+        if (mValidities != nullptr) {
+            jniEnv->SetBooleanArrayRegion(mValidities, 0, i, validityBuffer.get());
+        }
+        if (mThrowable != nullptr) {
+            jniEnv->Throw(mThrowable);
+            DELETE_LOCAL_REF(jniEnv, mThrowable);
+        }
+    }
+    return i;
+}
+
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGetBooleans
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jbooleanArray mValues, jbooleanArray mValidities, jint startIndex, jint endIndex) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    return BatchArrayGetPrimitives<jboolean>(
+        jniEnv, v8Runtime, v8Context, v8LocalValue, mValues, mValidities, startIndex, endIndex,
+        &JNIEnv::SetBooleanArrayRegion, Javet::Converter::ToJavaBooleanOrFalse);
+}
+
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGetDoubles
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jdoubleArray mValues, jbooleanArray mValidities, jint startIndex, jint endIndex) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    return BatchArrayGetPrimitives<jdouble>(
+        jniEnv, v8Runtime, v8Context, v8LocalValue, mValues, mValidities, startIndex, endIndex,
+        &JNIEnv::SetDoubleArrayRegion, Javet::Converter::ToJavaDoubleOrNaN);
+}
+
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGetIntegers
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jintArray mValues, jbooleanArray mValidities, jint startIndex, jint endIndex) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    return BatchArrayGetPrimitives<jint>(
+        jniEnv, v8Runtime, v8Context, v8LocalValue, mValues, mValidities, startIndex, endIndex,
+        &JNIEnv::SetIntArrayRegion, Javet::Converter::ToJavaIntegerOrZero);
+}
+
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGetLongs
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jlongArray mValues, jbooleanArray mValidities, jint startIndex, jint endIndex) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    return BatchArrayGetPrimitives<jlong>(
+        jniEnv, v8Runtime, v8Context, v8LocalValue, mValues, mValidities, startIndex, endIndex,
+        &JNIEnv::SetLongArrayRegion, Javet::Converter::ToJavaLongOrZero);
+}
+
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchArrayGetStrings
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jobjectArray mValues, jint startIndex, jint endIndex) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    jint length = GetBatchArrayGetLength(jniEnv, v8LocalValue, mValues, startIndex, endIndex);
+    if (length <= 0) {
+        return 0;
+    }
+    auto v8LocalObject = v8LocalValue.As<v8::Object>();
+    for (jint i = 0; i < length; ++i) {
+        auto v8MaybeLocalValue = v8LocalObject->Get(v8Context, (uint32_t)(i + startIndex));
+        jstring mString = nullptr;
+        if (v8MaybeLocalValue.IsEmpty()) {
+            if (Javet::Exceptions::HandlePendingException(jniEnv, v8Runtime, v8Context)) {
+                return i;
+            }
+        }
+        else {
+            auto v8LocalValueItem = v8MaybeLocalValue.ToLocalChecked();
+            if (v8LocalValueItem->IsString()) {
+                mString = Javet::Converter::ToJavaString(jniEnv, v8Isolate, v8LocalValueItem.As<v8::String>());
+            }
+        }
+        // Items other than strings are marked by null.
+        jniEnv->SetObjectArrayElement(mValues, i, mString);
+        DELETE_LOCAL_REF(jniEnv, mString);
+    }
+    return length;
+}
+
+/*
+ * Copy a region between a typed array and a Java primitive array without any intermediate buffer.
+ * The caller guarantees the Java array type matches the typed array element type
+ * and the Java array range is valid. The typed array range is validated here
+ * because the typed array may have been detached or shrunk since it was converted.
+ */
+static jboolean TypedArrayCopyRegion(
+    JNIEnv* jniEnv, const V8LocalValue& v8LocalValue, jarray mArray,
+    jint index, jint arrayOffset, jint length, bool toJava) {
+    if (!v8LocalValue->IsTypedArray() || index < 0 || length < 0) {
+        return false;
+    }
+    auto v8LocalTypedArray = v8LocalValue.As<v8::TypedArray>();
+    size_t typedArrayLength = v8LocalTypedArray->Length();
+    if ((size_t)index + (size_t)length > typedArrayLength) {
+        return false;
+    }
+    if (length == 0) {
+        return true;
+    }
+    size_t elementSize = v8LocalTypedArray->ByteLength() / typedArrayLength;
+    auto data = static_cast<uint8_t*>(v8LocalTypedArray->Buffer()->Data())
+        + v8LocalTypedArray->ByteOffset() + (size_t)index * elementSize;
+#define COPY_TYPED_ARRAY_REGION(jType, Type) \
+    if (toJava) { \
+        jniEnv->Set##Type##ArrayRegion((jType##Array)mArray, arrayOffset, length, reinterpret_cast<const jType*>(data)); \
+    } else { \
+        jniEnv->Get##Type##ArrayRegion((jType##Array)mArray, arrayOffset, length, reinterpret_cast<jType*>(data)); \
+    }
+    switch (elementSize) {
+    case 1:
+        COPY_TYPED_ARRAY_REGION(jbyte, Byte);
+        break;
+    case 2:
+        COPY_TYPED_ARRAY_REGION(jshort, Short);
+        break;
+    case 4:
+        if (v8LocalTypedArray->IsFloat32Array()) {
+            COPY_TYPED_ARRAY_REGION(jfloat, Float);
+        }
+        else {
+            COPY_TYPED_ARRAY_REGION(jint, Int);
+        }
+        break;
+    case 8:
+        if (v8LocalTypedArray->IsFloat64Array()) {
+            COPY_TYPED_ARRAY_REGION(jdouble, Double);
+        }
+        else {
+            COPY_TYPED_ARRAY_REGION(jlong, Long);
+        }
+        break;
+    default:
+        return false;
+    }
+#undef COPY_TYPED_ARRAY_REGION
+    return !jniEnv->ExceptionCheck();
+}
+
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_typedArrayGetByteBuffer
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    if (v8LocalValue->IsTypedArray()) {
+        // The view is rebuilt per call because the backing store may have been detached, transferred or resized.
+        auto v8LocalTypedArray = v8LocalValue.As<v8::TypedArray>();
+        auto v8LocalArrayBuffer = v8LocalTypedArray->Buffer();
+        auto byteLength = v8LocalTypedArray->ByteLength();
+        auto data = static_cast<uint8_t*>(v8LocalArrayBuffer->Data());
+        if (!v8LocalArrayBuffer->WasDetached() && data != nullptr && byteLength > 0) {
+            return jniEnv->NewDirectByteBuffer(data + v8LocalTypedArray->ByteOffset(), byteLength);
+        }
+    }
+    return nullptr;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_typedArrayGetRegion
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jobject mArray, jint index, jint arrayOffset, jint length) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    return TypedArrayCopyRegion(jniEnv, v8LocalValue, (jarray)mArray, index, arrayOffset, length, true);
+}
+
+JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_typedArraySetRegion
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jobject mArray, jint index, jint arrayOffset, jint length) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    return TypedArrayCopyRegion(jniEnv, v8LocalValue, (jarray)mArray, index, arrayOffset, length, false);
+}
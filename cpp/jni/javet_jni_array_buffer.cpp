@@ -15,13 +15,38 @@
  *   limitations under the License.
  */
 
+#include <cstdlib>
 #include "javet_jni.h"
 
+/*
+ * The backing store deleters run on whichever thread V8 releases the last reference,
+ * so the JNI environment is fetched instead of being captured.
+ */
+static void BackingStoreDeleteGlobalRef(void* data, size_t length, void* deleterData) noexcept {
+    FETCH_JNI_ENV(GlobalJavaVM);
+    jniEnv->DeleteGlobalRef(static_cast<jobject>(deleterData));
+    INCREASE_COUNTER(Javet::Monitor::CounterType::DeleteGlobalRef);
+}
+
+static void BackingStoreFree(void* data, size_t length, void* deleterData) noexcept {
+    std::free(data);
+}
+
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayBufferCreate__JI
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jint length) {
     RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
     if (length >= 0) {
-        auto v8LocalArrayBuffer = v8::ArrayBuffer::New(v8Isolate, length);
+        // The allocation failure is reported to Java instead of being a fatal out of memory in V8.
+        std::unique_ptr<v8::BackingStore> v8BackingStorePointer = v8::ArrayBuffer::NewBackingStore(
+            v8Isolate,
+            static_cast<size_t>(length),
+            v8::BackingStoreInitializationMode::kZeroInitialized,
+            v8::BackingStoreOnFailureMode::kReturnNull);
+        if (!v8BackingStorePointer) {
+            return Javet::Exceptions::ThrowJavetOutOfMemoryException(
+                jniEnv, v8Isolate, "Array buffer allocation failed");
+        }
+        auto v8LocalArrayBuffer = v8::ArrayBuffer::New(v8Isolate, std::move(v8BackingStorePointer));
         if (!v8LocalArrayBuffer.IsEmpty()) {
             return v8Runtime->SafeToExternalV8Value(jniEnv, v8Isolate, v8Context, v8LocalArrayBuffer);
         }
@@ -32,14 +57,100 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayBufferCre
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_arrayBufferCreate__JLjava_nio_ByteBuffer_2
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jobject mByteBuffer) {
     RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
+    // The byte buffer is kept alive until V8 releases the backing store.
+    jobject mGlobalByteBuffer = jniEnv->NewGlobalRef(mByteBuffer);
+    INCREASE_COUNTER(Javet::Monitor::CounterType::NewGlobalRef);
     std::unique_ptr<v8::BackingStore> v8BackingStorePointer = v8::ArrayBuffer::NewBackingStore(
         jniEnv->GetDirectBufferAddress(mByteBuffer),
         static_cast<size_t>(jniEnv->GetDirectBufferCapacity(mByteBuffer)),
-        [](void*, size_t, void*) {},
-        nullptr);
+        BackingStoreDeleteGlobalRef,
+        mGlobalByteBuffer);
     auto v8LocalArrayBuffer = v8::ArrayBuffer::New(v8Isolate, std::move(v8BackingStorePointer));
     if (!v8LocalArrayBuffer.IsEmpty()) {
         return v8Runtime->SafeToExternalV8Value(jniEnv, v8Isolate, v8Context, v8LocalArrayBuffer);
     }
     return Javet::Converter::ToExternalV8ValueUndefined(jniEnv, v8Runtime);
 }
+
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_backingStoreAttach
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong backingStoreHandle) {
+    if (backingStoreHandle == 0L) {
+        return Javet::Exceptions::ThrowJavetException(jniEnv, "RuntimeBackingStoreInvalid");
+    }
+    RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
+    // The reference is copied first so that the backing store outlives the attachment.
+    auto v8BackingStore = *reinterpret_cast<std::shared_ptr<v8::BackingStore>*>(backingStoreHandle);
+    if (v8BackingStore->IsShared()) {
+        auto v8LocalSharedArrayBuffer = v8::SharedArrayBuffer::New(v8Isolate, v8BackingStore);
+        if (!v8LocalSharedArrayBuffer.IsEmpty()) {
+            return v8Runtime->SafeToExternalV8Value(jniEnv, v8Isolate, v8Context, v8LocalSharedArrayBuffer);
+        }
+    }
+    else {
+        auto v8LocalArrayBuffer = v8::ArrayBuffer::New(v8Isolate, v8BackingStore);
+        if (!v8LocalArrayBuffer.IsEmpty()) {
+            return v8Runtime->SafeToExternalV8Value(jniEnv, v8Isolate, v8Context, v8LocalArrayBuffer);
+        }
+    }
+    return Javet::Converter::ToExternalV8ValueUndefined(jniEnv, v8Runtime);
+}
+
+/*
+ * The backing store is owned by a heap allocated shared pointer.
+ * Every array buffer attached in any isolate holds another reference,
+ * so the memory is released only after the Java side and all the isolates have let it go.
+ */
+JNIEXPORT jlong JNICALL Java_com_caoccao_javet_interop_V8Native_backingStoreCreate
+(JNIEnv* jniEnv, jobject caller, jobject mByteBuffer, jint length, jboolean shared) {
+    void* data;
+    size_t byteLength;
+    v8::BackingStore::DeleterCallback deleter;
+    void* deleterData;
+    if (mByteBuffer != nullptr) {
+        data = jniEnv->GetDirectBufferAddress(mByteBuffer);
+        if (data == nullptr) {
+            return 0L;
+        }
+        byteLength = static_cast<size_t>(jniEnv->GetDirectBufferCapacity(mByteBuffer));
+        deleter = BackingStoreDeleteGlobalRef;
+        deleterData = jniEnv->NewGlobalRef(mByteBuffer);
+        INCREASE_COUNTER(Javet::Monitor::CounterType::NewGlobalRef);
+    }
+    else {
+        if (length < 0) {
+            return 0L;
+        }
+        byteLength = static_cast<size_t>(length);
+        data = std::calloc(byteLength > 0 ? byteLength : 1, 1);
+        if (data == nullptr) {
+            return 0L;
+        }
+        deleter = BackingStoreFree;
+        deleterData = nullptr;
+    }
+    std::unique_ptr<v8::BackingStore> v8BackingStoreUniquePointer = shared
+        ? v8::SharedArrayBuffer::NewBackingStore(data, byteLength, deleter, deleterData)
+        : v8::ArrayBuffer::NewBackingStore(data, byteLength, deleter, deleterData);
+    auto v8BackingStorePointer = new std::shared_ptr<v8::BackingStore>(std::move(v8BackingStoreUniquePointer));
+    INCREASE_COUNTER(Javet::Monitor::CounterType::New);
+    return TO_JAVA_LONG(v8BackingStorePointer);
+}
+
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_backingStoreGetByteBuffer
+(JNIEnv* jniEnv, jobject caller, jlong backingStoreHandle) {
+    if (backingStoreHandle == 0L) {
+        return nullptr;
+    }
+    auto v8BackingStorePointer = reinterpret_cast<std::shared_ptr<v8::BackingStore>*>(backingStoreHandle);
+    return jniEnv->NewDirectByteBuffer(
+        v8BackingStorePointer->get()->Data(),
+        static_cast<jlong>(v8BackingStorePointer->get()->ByteLength()));
+}
+
+JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_backingStoreRelease
+(JNIEnv* jniEnv, jobject caller, jlong backingStoreHandle) {
+    if (backingStoreHandle != 0L) {
+        delete reinterpret_cast<std::shared_ptr<v8::BackingStore>*>(backingStoreHandle);
+        INCREASE_COUNTER(Javet::Monitor::CounterType::Delete);
+    }
+}
@@ -124,9 +124,7 @@ JNIEXPORT jlong JNICALL Java_com_caoccao_javet_interop_V8Native_createV8Runtime
         Javet::V8Native::GlobalV8Platform.get(),
         Javet::NodeNative::GlobalNodeArrayBufferAllocator);
 #else
-    auto v8Runtime = new Javet::V8Runtime(
-        Javet::V8Native::GlobalV8Platform.get(),
-        Javet::V8Native::GlobalV8ArrayBufferAllocator);
+    auto v8Runtime = new Javet::V8Runtime(Javet::V8Native::GlobalV8Platform.get());
 #endif
     INCREASE_COUNTER(Javet::Monitor::CounterType::NewV8Runtime);
     v8Runtime->CreateV8Isolate(jniEnv, mRuntimeOptions);
@@ -145,6 +143,22 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_equals
     return v8MaybeBool.FromMaybe(false);
 }
 
+JNIEXPORT jlong JNICALL Java_com_caoccao_javet_interop_V8Native_externalSourceCreate
+(JNIEnv* jniEnv, jobject caller, jobject mByteBuffer, jboolean mOneByte) {
+    if (jniEnv->GetDirectBufferAddress(mByteBuffer) == nullptr) {
+        return 0L;
+    }
+    auto externalSourceDataPointer = new Javet::ExternalSource::ExternalSourceData(jniEnv, mByteBuffer, mOneByte);
+    return TO_JAVA_LONG(externalSourceDataPointer);
+}
+
+JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_externalSourceRelease
+(JNIEnv* jniEnv, jobject caller, jlong externalSourceHandle) {
+    if (externalSourceHandle != 0L) {
+        reinterpret_cast<Javet::ExternalSource::ExternalSourceData*>(externalSourceHandle)->Release();
+    }
+}
+
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getGlobalObject
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle) {
     RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
@@ -167,6 +181,12 @@ JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_getPriority
     return static_cast<jint>(v8InternalIsolate->priority());
 }
 
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8ArrayBufferStatistics
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle) {
+    auto v8Runtime = Javet::V8Runtime::FromHandle(v8RuntimeHandle);
+    return v8Runtime->GetV8ArrayBufferStatistics(jniEnv);
+}
+
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8HeapSpaceStatistics
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jobject allocationSpace) {
     auto v8Runtime = Javet::V8Runtime::FromHandle(v8RuntimeHandle);
@@ -179,11 +199,23 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8HeapStati
     return Javet::Monitor::GetHeapStatistics(jniEnv, v8Runtime->v8Isolate);
 }
 
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8PropertyKeyCacheStatistics
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle) {
+    auto v8Runtime = Javet::V8Runtime::FromHandle(v8RuntimeHandle);
+    return v8Runtime->GetV8PropertyKeyCacheStatistics(jniEnv);
+}
+
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8SharedMemoryStatistics
 (JNIEnv* jniEnv, jobject caller) {
     return Javet::Monitor::GetV8SharedMemoryStatistics(jniEnv);
 }
 
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_getV8UnboundScriptCacheStatistics
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle) {
+    auto v8Runtime = Javet::V8Runtime::FromHandle(v8RuntimeHandle);
+    return v8Runtime->GetV8UnboundScriptCacheStatistics(jniEnv);
+}
+
 JNIEXPORT jstring JNICALL Java_com_caoccao_javet_interop_V8Native_getVersion
 (JNIEnv* jniEnv, jobject caller) {
     return Javet::Converter::ToJavaString(jniEnv, v8::V8::GetVersion());
@@ -382,10 +414,25 @@ JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_removeReferenceHa
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong referenceHandle, jint referenceType) {
     auto v8Runtime = Javet::V8Runtime::FromHandle(v8RuntimeHandle);
     auto v8Locker = v8Runtime->GetSharedV8Locker();
-    auto v8PersistentDataPointer = TO_V8_PERSISTENT_DATA_POINTER(referenceHandle);
-    v8PersistentDataPointer->Reset();
-    delete v8PersistentDataPointer;
-    INCREASE_COUNTER(Javet::Monitor::CounterType::DeletePersistentReference);
+    v8Runtime->v8PersistentReferenceTable->Release(referenceHandle);
+}
+
+JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_removeReferenceHandles
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlongArray mReferenceHandles, jint length) {
+    if (length <= 0) {
+        return;
+    }
+    // The handles are copied out because releasing a handle may log.
+    std::vector<jlong> referenceHandles(length);
+    jniEnv->GetLongArrayRegion(mReferenceHandles, 0, length, referenceHandles.data());
+    if (jniEnv->ExceptionCheck()) {
+        return;
+    }
+    auto v8Runtime = Javet::V8Runtime::FromHandle(v8RuntimeHandle);
+    auto v8Locker = v8Runtime->GetSharedV8Locker();
+    for (auto referenceHandle : referenceHandles) {
+        v8Runtime->v8PersistentReferenceTable->Release(referenceHandle);
+    }
 }
 
 JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_requestGarbageCollectionForTesting
@@ -518,8 +565,12 @@ JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_unregisterNearHea
 JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_v8InspectorSend
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jstring mMessage) {
     RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE_WITH_UNIQUE_LOCKER(v8RuntimeHandle);
-    char const* umMessage = jniEnv->GetStringUTFChars(mMessage, nullptr);
-    std::string message(umMessage, jniEnv->GetStringUTFLength(mMessage));
-    v8Runtime->v8Inspector->send(message);
-    jniEnv->ReleaseStringUTFChars(mMessage, umMessage);
+    Javet::Converter::JavaStringCharacters javaStringCharacters(jniEnv, mMessage);
+    const size_t length = static_cast<size_t>(javaStringCharacters.GetLength());
+    if (javaStringCharacters.IsOneByte()) {
+        v8Runtime->v8Inspector->send(v8_inspector::StringView(javaStringCharacters.GetOneByteData(), length));
+    }
+    else {
+        v8Runtime->v8Inspector->send(v8_inspector::StringView(javaStringCharacters.GetTwoByteData(), length));
+    }
 }
@@ -80,12 +80,15 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_functionCanDi
 }
 
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_functionCompile
-(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jstring mScript, jbyteArray mCachedData,
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jobject mScript, jbyteArray mCachedData,
     jstring mResourceName, jint mResourceLineOffset, jint mResourceColumnOffset, jint mScriptId, jboolean mIsWASM,
     jobjectArray mArguments, jobjectArray mContextExtensions) {
     RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
     V8TryCatch v8TryCatch(v8Isolate);
-    auto umScript = Javet::Converter::ToV8String(jniEnv, v8Isolate, mScript);
+    auto umScript = Javet::Converter::ToV8SourceString(jniEnv, v8Isolate, mScript);
+    if (umScript.IsEmpty() && Javet::Converter::IsV8ExternalSource(jniEnv, mScript)) {
+        return Javet::Exceptions::ThrowJavetException(jniEnv, "RuntimeExternalSourceInvalid");
+    }
     jboolean isModule = false;
     auto scriptOriginPointer = Javet::Converter::ToV8ScriptOringinPointer(
         jniEnv, v8Isolate, mResourceName, mResourceLineOffset, mResourceColumnOffset, mScriptId, mIsWASM, isModule);
@@ -114,7 +117,8 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_functionCompil
             argumentCount, argumentsPointer.get(),
             contextExtensionCount, contextExtensionsPointer.get(),
             v8::ScriptCompiler::kConsumeCodeCache);
-        LOG_DEBUG("Function cache is " << (scriptSource.GetCachedData()->rejected ? "rejected" : "accepted") << ".");
+        Javet::Callback::JavetReportCodeCacheConsumption(
+            jniEnv, v8Runtime->externalV8Runtime, scriptSource.GetCachedData(), "Function");
     }
     else {
         V8ScriptCompilerSource scriptSource(umScript, *scriptOriginPointer.get());
@@ -164,13 +168,29 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_functionCreate
     auto javetCallbackContextReferencePointer =
         new Javet::Callback::JavetCallbackContextReference(jniEnv, mCallbackContext);
     INCREASE_COUNTER(Javet::Monitor::CounterType::NewJavetCallbackContextReference);
-    auto v8LocalContextHandle =
-        v8::BigInt::New(v8Isolate, TO_NATIVE_INT_64(javetCallbackContextReferencePointer));
-    javetCallbackContextReferencePointer->v8PersistentCallbackContextHandlePointer =
-        new V8PersistentBigInt(v8Isolate, v8LocalContextHandle);
-    INCREASE_COUNTER(Javet::Monitor::CounterType::NewPersistentCallbackContextReference);
-    auto v8MaybeLocalFunction =
-        v8::Function::New(v8Context, Javet::Callback::JavetFunctionCallback, v8LocalContextHandle);
+    auto v8LocalContextHandle = javetCallbackContextReferencePointer->BindV8External(v8Isolate);
+    V8MaybeLocalFunction v8MaybeLocalFunction;
+    auto cFunctionPointer = javetCallbackContextReferencePointer->GetFastApiCFunction();
+    if (cFunctionPointer == nullptr) {
+        v8MaybeLocalFunction = v8::Function::New(v8Context, Javet::Callback::JavetFunctionCallback, v8LocalContextHandle);
+    }
+    else {
+        // The fast API call is registered as an overload next to the regular function callback.
+        // V8 only passes the template data to the fast API call, so each callback context needs its own template.
+        auto v8LocalFunctionTemplate = v8::FunctionTemplate::New(
+            v8Isolate,
+            Javet::Callback::JavetFunctionCallback,
+            v8LocalContextHandle,
+            v8::Local<v8::Signature>(),
+            0,
+            v8::ConstructorBehavior::kThrow,
+            v8::SideEffectType::kHasSideEffect,
+            cFunctionPointer);
+        // Like v8::Function::New(), the template is not cached in the context,
+        // otherwise the context would pin the callback context reference after it is closed.
+        v8::Utils::OpenHandle(*v8LocalFunctionTemplate)->set_serial_number(V8InternalTemplateInfo::kDoNotCache);
+        v8MaybeLocalFunction = v8LocalFunctionTemplate->GetFunction(v8Context);
+    }
     if (v8MaybeLocalFunction.IsEmpty()) {
         if (Javet::Exceptions::HandlePendingException(jniEnv, v8Runtime, v8Context, "Function allocation failed")) {
             return nullptr;
@@ -179,10 +199,6 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_functionCreate
     else {
         auto v8LocalFunction = v8MaybeLocalFunction.ToLocalChecked();
         if (!v8LocalFunction.IsEmpty()) {
-            javetCallbackContextReferencePointer->v8PersistentCallbackContextHandlePointer->SetWeak(
-                javetCallbackContextReferencePointer,
-                Javet::Callback::JavetCloseWeakCallbackContextHandle,
-                v8::WeakCallbackType::kParameter);
             return v8Runtime->SafeToExternalV8Value(jniEnv, v8Isolate, v8Context, v8LocalFunction);
         }
     }
@@ -0,0 +1,119 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "javet_jni.h"
+
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_jsonParse
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jobject mByteBuffer, jint position, jint length) {
+    RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
+    auto bufferPointer = static_cast<const char*>(jniEnv->GetDirectBufferAddress(mByteBuffer));
+    auto bufferCapacity = jniEnv->GetDirectBufferCapacity(mByteBuffer);
+    if (bufferPointer == nullptr || position < 0 || length < 0 || position + static_cast<jlong>(length) > bufferCapacity) {
+        return Javet::Exceptions::ThrowJavetException(jniEnv, "RuntimeByteBufferInvalid");
+    }
+    V8TryCatch v8TryCatch(v8Isolate);
+    // V8 decodes the UTF-8 bytes straight into a one-byte string when they are Latin-1.
+    auto v8MaybeLocalString = v8::String::NewFromUtf8(
+        v8Isolate, bufferPointer + position, v8::NewStringType::kNormal, length);
+    V8MaybeLocalValue v8MaybeLocalValue;
+    if (!v8MaybeLocalString.IsEmpty()) {
+        v8MaybeLocalValue = v8::JSON::Parse(v8Context, v8MaybeLocalString.ToLocalChecked());
+    }
+    if (v8TryCatch.HasCaught()) {
+        return Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
+    }
+    if (!v8MaybeLocalValue.IsEmpty()) {
+        return v8Runtime->SafeToExternalV8Value(jniEnv, v8Isolate, v8Context, v8MaybeLocalValue.ToLocalChecked());
+    }
+    return Javet::Converter::ToExternalV8ValueUndefined(jniEnv, v8Runtime);
+}
+
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_jsonStringify
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType, jobject mByteBuffer, jint position, jint limit) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    auto bufferPointer = static_cast<char*>(jniEnv->GetDirectBufferAddress(mByteBuffer));
+    if (bufferPointer == nullptr || position < 0 || position > limit || limit > jniEnv->GetDirectBufferCapacity(mByteBuffer)) {
+        Javet::Exceptions::ThrowJavetException(jniEnv, "RuntimeByteBufferInvalid");
+        return -1;
+    }
+    V8TryCatch v8TryCatch(v8Isolate);
+    auto v8MaybeLocalString = v8::JSON::Stringify(v8Context, v8LocalValue);
+    if (v8TryCatch.HasCaught()) {
+        Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
+        return -1;
+    }
+    if (v8MaybeLocalString.IsEmpty()) {
+        return -1;
+    }
+    auto v8LocalString = v8MaybeLocalString.ToLocalChecked();
+    auto utf8Length = v8LocalString->Utf8LengthV2(v8Isolate);
+    // The UTF-8 bytes are only written when they fit before the limit, otherwise the caller resumes with a larger buffer.
+    if (static_cast<size_t>(position) + utf8Length <= static_cast<size_t>(limit)) {
+        v8LocalString->WriteUtf8V2(
+            v8Isolate, bufferPointer + position, utf8Length, v8::String::WriteFlags::kReplaceInvalidUtf8);
+    }
+    return static_cast<jint>(utf8Length);
+}
+
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_jsonStringifyGrowable
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType, jobject mByteBuffer, jint position, jint limit) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    auto bufferPointer = static_cast<char*>(jniEnv->GetDirectBufferAddress(mByteBuffer));
+    if (bufferPointer == nullptr || position < 0 || position > limit || limit > jniEnv->GetDirectBufferCapacity(mByteBuffer)) {
+        return Javet::Exceptions::ThrowJavetException(jniEnv, "RuntimeByteBufferInvalid");
+    }
+    V8TryCatch v8TryCatch(v8Isolate);
+    auto v8MaybeLocalString = v8::JSON::Stringify(v8Context, v8LocalValue);
+    if (v8TryCatch.HasCaught()) {
+        return Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
+    }
+    if (v8MaybeLocalString.IsEmpty()) {
+        return nullptr;
+    }
+    // Only the bytes before the limit are writable.
+    auto bufferLimit = static_cast<size_t>(limit);
+    auto v8LocalString = v8MaybeLocalString.ToLocalChecked();
+    auto utf8Length = v8LocalString->Utf8LengthV2(v8Isolate);
+    auto requiredCapacity = static_cast<size_t>(position) + utf8Length;
+    jobject mTargetByteBuffer = mByteBuffer;
+    auto targetPointer = bufferPointer;
+    // The JSON is stringified only once. A larger byte buffer takes over the written bytes if it doesn't fit.
+    if (requiredCapacity > bufferLimit) {
+        auto newCapacity = std::max(bufferLimit * 2, requiredCapacity);
+        if (newCapacity > static_cast<size_t>(INT32_MAX)) {
+            newCapacity = requiredCapacity;
+        }
+        if (newCapacity > static_cast<size_t>(INT32_MAX)) {
+            return Javet::Exceptions::ThrowJavetOutOfMemoryException(jniEnv, v8Isolate, "JSON is too large for a byte buffer");
+        }
+        mTargetByteBuffer = jniEnv->CallStaticObjectMethod(
+            Javet::Converter::jclassByteBuffer, Javet::Converter::jmethodIDByteBufferAllocateDirect, static_cast<jint>(newCapacity));
+        if (mTargetByteBuffer == nullptr) {
+            return nullptr;
+        }
+        targetPointer = static_cast<char*>(jniEnv->GetDirectBufferAddress(mTargetByteBuffer));
+        std::memcpy(targetPointer, bufferPointer, position);
+    }
+    v8LocalString->WriteUtf8V2(
+        v8Isolate, targetPointer + position, utf8Length, v8::String::WriteFlags::kReplaceInvalidUtf8);
+    jobject mBuffer = jniEnv->CallObjectMethod(
+        mTargetByteBuffer, Javet::Converter::jmethodIDByteBufferPosition, static_cast<jint>(requiredCapacity));
+    DELETE_LOCAL_REF(jniEnv, mBuffer);
+    return mTargetByteBuffer;
+}
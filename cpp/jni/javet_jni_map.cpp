@@ -84,6 +84,7 @@ namespace Javet {
                 }
                 return true;
             }
+            Javet::Exceptions::HandlePendingException(jniEnv, v8Runtime, v8Context);
             return false;
         }
     }
@@ -308,37 +309,43 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_mapHas
     return false;
 }
 
-JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_mapSet
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_mapSet
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType, jobjectArray keysAndValues) {
     RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
     if (IS_V8_MAP(v8ValueType)) {
         auto length = jniEnv->GetArrayLength(keysAndValues);
         if (length == 0 || length % 2 != 0) {
-            return false;
+            return 0;
         }
+        // The first failure stops the batch and the count of the applied pairs is returned.
         V8TryCatch v8TryCatch(v8Isolate);
         auto v8LocalMap = v8LocalValue.As<v8::Map>();
         for (int i = 0; i < length; i += 2) {
+            // The handles of each pair are released per iteration so that large batches do not pile them up.
+            V8HandleScope v8HandleScope(v8Isolate);
             auto jobjectValue = jniEnv->GetObjectArrayElement(keysAndValues, i + 1);
             auto v8LocalValueValue = Javet::Converter::ToV8Value(jniEnv, v8Isolate, v8Context, jobjectValue);
+            DELETE_LOCAL_REF(jniEnv, jobjectValue);
             if (v8TryCatch.HasCaught()) {
                 Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
-                return false;
+                return i >> 1;
             }
             auto jobjectKey = jniEnv->GetObjectArrayElement(keysAndValues, i);
-            if (!Javet::V8ValueMap::mapSet(
+            bool success = Javet::V8ValueMap::mapSet(
                 jniEnv,
                 v8Runtime,
                 v8Context,
                 v8LocalMap,
                 jobjectKey,
-                v8LocalValueValue)) {
-                return false;
+                v8LocalValueValue);
+            DELETE_LOCAL_REF(jniEnv, jobjectKey);
+            if (!success) {
+                return i >> 1;
             }
         }
-        return true;
+        return length >> 1;
     }
-    return false;
+    return 0;
 }
 
 JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_mapSetBoolean
@@ -18,12 +18,15 @@
 #include "javet_jni.h"
 
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_moduleCompile
-(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jstring mScript, jbyteArray mCachedData, jboolean mResultRequired,
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jobject mScript, jbyteArray mCachedData, jboolean mResultRequired,
     jstring mResourceName, jint mResourceLineOffset, jint mResourceColumnOffset, jint mScriptId, jboolean mIsWASM, jboolean mIsModule) {
     if (mIsModule) {
         RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
         V8TryCatch v8TryCatch(v8Isolate);
-        auto umScript = Javet::Converter::ToV8String(jniEnv, v8Isolate, mScript);
+        auto umScript = Javet::Converter::ToV8SourceString(jniEnv, v8Isolate, mScript);
+        if (umScript.IsEmpty() && Javet::Converter::IsV8ExternalSource(jniEnv, mScript)) {
+            return Javet::Exceptions::ThrowJavetException(jniEnv, "RuntimeExternalSourceInvalid");
+        }
         auto scriptOriginPointer = Javet::Converter::ToV8ScriptOringinPointer(
             jniEnv, v8Isolate, mResourceName, mResourceLineOffset, mResourceColumnOffset, mScriptId, mIsWASM, mIsModule);
         v8::MaybeLocal<v8::Module> v8MaybeLocalCompiledModule;
@@ -36,7 +39,8 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_moduleCompile
                 v8Isolate,
                 &scriptSource,
                 v8::ScriptCompiler::kConsumeCodeCache);
-            LOG_DEBUG("Module cache is " << (scriptSource.GetCachedData()->rejected ? "rejected" : "accepted") << ".");
+            Javet::Callback::JavetReportCodeCacheConsumption(
+                jniEnv, v8Runtime->externalV8Runtime, scriptSource.GetCachedData(), "Module");
         }
         else {
             V8ScriptCompilerSource scriptSource(umScript, *scriptOriginPointer.get());
@@ -117,11 +121,14 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_moduleEvaluate
 }
 
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_moduleExecute
-(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jstring mScript, jbyteArray mCachedData, jboolean mResultRequired,
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jobject mScript, jbyteArray mCachedData, jboolean mResultRequired,
     jstring mResourceName, jint mResourceLineOffset, jint mResourceColumnOffset, jint mScriptId, jboolean mIsWASM) {
     RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
     V8TryCatch v8TryCatch(v8Isolate);
-    auto umScript = Javet::Converter::ToV8String(jniEnv, v8Isolate, mScript);
+    auto umScript = Javet::Converter::ToV8SourceString(jniEnv, v8Isolate, mScript);
+    if (umScript.IsEmpty() && Javet::Converter::IsV8ExternalSource(jniEnv, mScript)) {
+        return Javet::Exceptions::ThrowJavetException(jniEnv, "RuntimeExternalSourceInvalid");
+    }
     auto scriptOriginPointer = Javet::Converter::ToV8ScriptOringinPointer(
         jniEnv, v8Isolate, mResourceName, mResourceLineOffset, mResourceColumnOffset, mScriptId, mIsWASM, true);
     v8::MaybeLocal<v8::Module> v8MaybeLocalCompiledModule;
@@ -130,7 +137,8 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_moduleExecute
             umScript, *scriptOriginPointer.get(), Javet::Converter::ToCachedDataPointer(jniEnv, mCachedData));
         v8MaybeLocalCompiledModule = v8::ScriptCompiler::CompileModule(
             v8Isolate, &scriptSource, v8::ScriptCompiler::kConsumeCodeCache);
-        LOG_DEBUG("Module cache is " << (scriptSource.GetCachedData()->rejected ? "rejected" : "accepted") << ".");
+        Javet::Callback::JavetReportCodeCacheConsumption(
+            jniEnv, v8Runtime->externalV8Runtime, scriptSource.GetCachedData(), "Module");
     }
     else {
         V8ScriptCompilerSource scriptSource(umScript, *scriptOriginPointer.get());
@@ -51,7 +51,7 @@ namespace Javet {
             }
             if (v8LocalValue->IsObject()) {
                 V8TryCatch v8TryCatch(v8Runtime->v8Isolate);
-                auto v8LocalValueKey = Javet::Converter::ToV8Value(jniEnv, v8Runtime->v8Isolate, v8Context, key);
+                auto v8LocalValueKey = Javet::Converter::ToV8PropertyKey(jniEnv, v8Runtime, v8Context, key);
                 if (v8LocalValueKey.IsEmpty()) {
                     if (Javet::Exceptions::HandlePendingException(jniEnv, v8Runtime, v8Context)) {
                         return except(jniEnv, v8Runtime, v8Context);
@@ -98,7 +98,7 @@ namespace Javet {
                 v8MaybeBool = v8LocalObject->Set(v8Context, integerKey, v8LocalValueValue);
             }
             else {
-                auto v8ValueKey = Javet::Converter::ToV8Value(jniEnv, v8Runtime->v8Isolate, v8Context, key);
+                auto v8ValueKey = Javet::Converter::ToV8PropertyKey(jniEnv, v8Runtime, v8Context, key);
                 if (v8TryCatch.HasCaught()) {
                     Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
                     return false;
@@ -138,7 +138,7 @@ JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGet
                     v8MaybeLocalValueResult = v8LocalObject->Get(v8Context, integerKey);
                 }
                 else {
-                    auto v8LocalValueKey = Javet::Converter::ToV8Value(jniEnv, v8Isolate, v8Context, key);
+                    auto v8LocalValueKey = Javet::Converter::ToV8PropertyKey(jniEnv, v8Runtime, v8Context, key);
                     v8MaybeLocalValueResult = v8LocalObject->Get(v8Context, v8LocalValueKey);
                 }
                 if (v8TryCatch.HasCaught()) {
@@ -165,6 +165,171 @@ JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGet
     return 0;
 }
 
+/*
+ * Get the property of a typed batch get.
+ * It returns an empty handle with the Java exception thrown if the getter throws.
+ */
+static V8LocalValue BatchObjectGetValue(
+    JNIEnv* jniEnv, V8Runtime* v8Runtime, const V8LocalContext& v8Context, const V8LocalObject& v8LocalObject,
+    V8TryCatch& v8TryCatch, jobjectArray v8ValueKeys, jint index) {
+    V8MaybeLocalValue v8MaybeLocalValueResult;
+    auto key = jniEnv->GetObjectArrayElement(v8ValueKeys, index);
+    if (Javet::Converter::IsV8ValueInteger(jniEnv, key)) {
+        jint integerKey = Javet::Converter::ToJavaIntegerFromV8ValueInteger(jniEnv, key);
+        v8MaybeLocalValueResult = v8LocalObject->Get(v8Context, integerKey);
+    }
+    else {
+        auto v8LocalValueKey = Javet::Converter::ToV8PropertyKey(jniEnv, v8Runtime, v8Context, key);
+        v8MaybeLocalValueResult = v8LocalObject->Get(v8Context, v8LocalValueKey);
+    }
+    DELETE_LOCAL_REF(jniEnv, key);
+    if (v8TryCatch.HasCaught()) {
+        Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
+        return V8LocalValue();
+    }
+    if (v8MaybeLocalValueResult.IsEmpty()) {
+        if (Javet::Exceptions::HandlePendingException(jniEnv, v8Runtime, v8Context)) {
+            return V8LocalValue();
+        }
+        return v8::Undefined(v8Runtime->v8Isolate);
+    }
+    return v8MaybeLocalValueResult.ToLocalChecked();
+}
+
+/*
+ * Get the item count of a typed batch get clipped by the key length and the Java array length.
+ */
+static jint GetBatchObjectGetLength(
+    JNIEnv* jniEnv, jobjectArray v8ValueKeys, jarray mValues, jint length) {
+    if (v8ValueKeys == nullptr || mValues == nullptr) {
+        return 0;
+    }
+    jint keyLength = jniEnv->GetArrayLength(v8ValueKeys);
+    jint valueLength = jniEnv->GetArrayLength(mValues);
+    length = length > keyLength ? keyLength : length;
+    return length > valueLength ? valueLength : length;
+}
+
+/*
+ * Batch get the properties of the given keys into a Java primitive array.
+ * The properties are converted into a native buffer which is copied to Java by a single region call.
+ * Properties of another type are marked by the converter and reported in the optional validity array.
+ */
+template<typename T, typename TArray, typename TConverter>
+static jint BatchObjectGetPrimitives(
+    JNIEnv* jniEnv, V8Runtime* v8Runtime, const V8LocalContext& v8Context, const V8LocalValue& v8LocalValue,
+    jobjectArray v8ValueKeys, TArray mValues, jbooleanArray mValidities, jint length,
+    void (JNIEnv::* setArrayRegion)(TArray, jsize, jsize, const T*), TConverter converter) {
+    if (!v8LocalValue->IsObject()) {
+        return 0;
+    }
+    length = GetBatchObjectGetLength(jniEnv, v8ValueKeys, mValues, length);
+    if (mValidities != nullptr) {
+        jint validityLength = jniEnv->GetArrayLength(mValidities);
+        length = length > validityLength ? validityLength : length;
+    }
+    if (length <= 0) {
+        return 0;
+    }
+    auto v8LocalObject = v8LocalValue.As<v8::Object>();
+    V8TryCatch v8TryCatch(v8Runtime->v8Isolate);
+    std::unique_ptr<T[]> buffer(new T[length]);
+    std::unique_ptr<jboolean[]> validityBuffer(new jboolean[length]);
+    jint i = 0;
+    for (; i < length; ++i) {
+        auto v8LocalValueValue = BatchObjectGetValue(
+            jniEnv, v8Runtime, v8Context, v8LocalObject, v8TryCatch, v8ValueKeys, i);
+        if (v8LocalValueValue.IsEmpty()) {
+            break;
+        }
+        bool valid = false;
+        buffer[i] = converter(v8LocalValueValue, valid);
+        validityBuffer[i] = valid;
+    }
+    if (i > 0) {
+        // JNI region calls are not allowed with a pending Java exception,
+        // so the exception raised by the getter is set aside while the read prefix is copied.
+        jthrowable mThrowable = jniEnv->ExceptionOccurred();
+        if (mThrowable != nullptr) {
+            jniEnv->ExceptionClear();
+        }
+        (jniEnv->*setArrayRegion)(mValues, 0, i, buffer.get());
+        if (mValidities != nullptr) {
+            jniEnv->SetBooleanArrayRegion(mValidities, 0, i, validityBuffer.get());
+        }
+        if (mThrowable != nullptr) {
+            jniEnv->Throw(mThrowable);
+            DELETE_LOCAL_REF(jniEnv, mThrowable);
+        }
+    }
+    return i;
+}
+
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGetBooleans
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jobjectArray v8ValueKeys, jbooleanArray mValues, jbooleanArray mValidities, jint length) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    return BatchObjectGetPrimitives<jboolean>(
+        jniEnv, v8Runtime, v8Context, v8LocalValue, v8ValueKeys, mValues, mValidities, length,
+        &JNIEnv::SetBooleanArrayRegion, Javet::Converter::ToJavaBooleanOrFalse);
+}
+
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGetDoubles
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jobjectArray v8ValueKeys, jdoubleArray mValues, jbooleanArray mValidities, jint length) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    return BatchObjectGetPrimitives<jdouble>(
+        jniEnv, v8Runtime, v8Context, v8LocalValue, v8ValueKeys, mValues, mValidities, length,
+        &JNIEnv::SetDoubleArrayRegion, Javet::Converter::ToJavaDoubleOrNaN);
+}
+
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGetIntegers
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jobjectArray v8ValueKeys, jintArray mValues, jbooleanArray mValidities, jint length) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    return BatchObjectGetPrimitives<jint>(
+        jniEnv, v8Runtime, v8Context, v8LocalValue, v8ValueKeys, mValues, mValidities, length,
+        &JNIEnv::SetIntArrayRegion, Javet::Converter::ToJavaIntegerOrZero);
+}
+
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGetLongs
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jobjectArray v8ValueKeys, jlongArray mValues, jbooleanArray mValidities, jint length) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    return BatchObjectGetPrimitives<jlong>(
+        jniEnv, v8Runtime, v8Context, v8LocalValue, v8ValueKeys, mValues, mValidities, length,
+        &JNIEnv::SetLongArrayRegion, Javet::Converter::ToJavaLongOrZero);
+}
+
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchObjectGetStrings
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jobjectArray v8ValueKeys, jobjectArray mValues, jint length) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    if (!v8LocalValue->IsObject()) {
+        return 0;
+    }
+    length = GetBatchObjectGetLength(jniEnv, v8ValueKeys, mValues, length);
+    if (length <= 0) {
+        return 0;
+    }
+    auto v8LocalObject = v8LocalValue.As<v8::Object>();
+    V8TryCatch v8TryCatch(v8Isolate);
+    for (jint i = 0; i < length; ++i) {
+        auto v8LocalValueValue = BatchObjectGetValue(
+            jniEnv, v8Runtime, v8Context, v8LocalObject, v8TryCatch, v8ValueKeys, i);
+        if (v8LocalValueValue.IsEmpty()) {
+            return i;
+        }
+        // Properties other than strings are marked by null.
+        jstring mString = v8LocalValueValue->IsString()
+            ? Javet::Converter::ToJavaString(jniEnv, v8Isolate, v8LocalValueValue.As<v8::String>())
+            : nullptr;
+        jniEnv->SetObjectArrayElement(mValues, i, mString);
+        DELETE_LOCAL_REF(jniEnv, mString);
+    }
+    return length;
+}
+
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_objectCreate
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle) {
     RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
@@ -186,7 +351,7 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_objectDelete
             v8MaybeBool = v8LocalObject->Delete(v8Context, integerKey);
         }
         else {
-            auto v8ValueKey = Javet::Converter::ToV8Value(jniEnv, v8Isolate, v8Context, key);
+            auto v8ValueKey = Javet::Converter::ToV8PropertyKey(jniEnv, v8Runtime, v8Context, key);
             v8MaybeBool = v8LocalObject->Delete(v8Context, v8ValueKey);
         }
         if (v8MaybeBool.IsNothing()) {
@@ -203,8 +368,7 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_objectDeleteP
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType, jstring mKey) {
     RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
     if (v8LocalValue->IsObject()) {
-        auto v8LocalStringKey = Javet::Converter::ToV8String(jniEnv, v8Isolate, mKey);
-        auto v8LocalPrivateKey = v8::Private::ForApi(v8Isolate, v8LocalStringKey);
+        auto v8LocalPrivateKey = Javet::Converter::ToV8PrivateKey(jniEnv, v8Runtime, mKey);
         auto v8MaybeBool = v8LocalValue.As<v8::Object>()->DeletePrivate(v8Context, v8LocalPrivateKey);
         if (v8MaybeBool.IsNothing()) {
             Javet::Exceptions::HandlePendingException(jniEnv, v8Runtime, v8Context);
@@ -348,8 +512,7 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_objectGetPriva
     RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
     if (v8LocalValue->IsObject()) {
         V8TryCatch v8TryCatch(v8Isolate);
-        auto v8LocalStringKey = Javet::Converter::ToV8String(jniEnv, v8Isolate, mKey);
-        auto v8LocalPrivateKey = v8::Private::ForApi(v8Isolate, v8LocalStringKey);
+        auto v8LocalPrivateKey = Javet::Converter::ToV8PrivateKey(jniEnv, v8Runtime, mKey);
         auto v8MaybeLocalValue = v8LocalValue.As<v8::Object>()->GetPrivate(v8Context, v8LocalPrivateKey);
         if (v8TryCatch.HasCaught()) {
             return Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
@@ -389,7 +552,7 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_objectGetPrope
             v8MaybeLocalValueValue = v8LocalObject->Get(v8Context, integerKey);
         }
         else {
-            auto v8ValueKey = Javet::Converter::ToV8Value(jniEnv, v8Isolate, v8Context, key);
+            auto v8ValueKey = Javet::Converter::ToV8PropertyKey(jniEnv, v8Runtime, v8Context, key);
             if (v8ValueKey.IsEmpty()) {
                 if (Javet::Exceptions::HandlePendingException(jniEnv, v8Runtime, v8Context)) {
                     return nullptr;
@@ -516,7 +679,7 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_objectHas
             v8MaybeBool = v8LocalObject->Has(v8Context, integerKey);
         }
         else {
-            auto v8LocalValueKey = Javet::Converter::ToV8Value(jniEnv, v8Isolate, v8Context, value);
+            auto v8LocalValueKey = Javet::Converter::ToV8PropertyKey(jniEnv, v8Runtime, v8Context, value);
             if (v8TryCatch.HasCaught()) {
                 Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
                 return false;
@@ -576,8 +739,7 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_objectHasPriv
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType, jstring mKey) {
     RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
     if (v8LocalValue->IsObject()) {
-        auto v8LocalStringKey = Javet::Converter::ToV8String(jniEnv, v8Isolate, mKey);
-        auto v8LocalPrivateKey = v8::Private::ForApi(v8Isolate, v8LocalStringKey);
+        auto v8LocalPrivateKey = Javet::Converter::ToV8PrivateKey(jniEnv, v8Runtime, mKey);
         auto v8MaybeBool = v8LocalValue.As<v8::Object>()->HasPrivate(v8Context, v8LocalPrivateKey);
         if (v8MaybeBool.IsNothing()) {
             Javet::Exceptions::HandlePendingException(jniEnv, v8Runtime, v8Context);
@@ -603,7 +765,7 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_objectInvoke
     }
     if (v8LocalValue->IsObject()) {
         auto v8LocalObject = v8LocalValue.As<v8::Object>();
-        auto v8MaybeLocalValue = v8LocalObject->Get(v8Context, Javet::Converter::ToV8String(jniEnv, v8Isolate, mFunctionName));
+        auto v8MaybeLocalValue = v8LocalObject->Get(v8Context, Javet::Converter::ToV8PropertyName(jniEnv, v8Runtime, mFunctionName));
         if (v8MaybeLocalValue.IsEmpty()) {
             if (Javet::Exceptions::HandlePendingException(jniEnv, v8Runtime, v8Context)) {
                 return nullptr;
@@ -660,37 +822,43 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_objectIsSeale
     return false;
 }
 
-JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_objectSet
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_objectSet
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType, jobjectArray keysAndValues) {
     RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
     if (v8LocalValue->IsObject()) {
         auto length = jniEnv->GetArrayLength(keysAndValues);
         if (length == 0 || length % 2 != 0) {
-            return false;
+            return 0;
         }
+        // The first failure stops the batch and the count of the applied pairs is returned.
         V8TryCatch v8TryCatch(v8Isolate);
         auto v8LocalObject = v8LocalValue.As<v8::Object>();
         for (int i = 0; i < length; i += 2) {
+            // The handles of each pair are released per iteration so that large batches do not pile them up.
+            V8HandleScope v8HandleScope(v8Isolate);
             auto jobjectValue = jniEnv->GetObjectArrayElement(keysAndValues, i + 1);
             auto v8LocalValueValue = Javet::Converter::ToV8Value(jniEnv, v8Isolate, v8Context, jobjectValue);
+            DELETE_LOCAL_REF(jniEnv, jobjectValue);
             if (v8TryCatch.HasCaught()) {
                 Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
-                return false;
+                return i >> 1;
             }
             auto jobjectKey = jniEnv->GetObjectArrayElement(keysAndValues, i);
-            if (!Javet::V8ValueObject::objectSet(
+            bool success = Javet::V8ValueObject::objectSet(
                 jniEnv,
                 v8Runtime,
                 v8Context,
                 v8LocalObject,
                 jobjectKey,
-                v8LocalValueValue)) {
-                return false;
+                v8LocalValueValue);
+            DELETE_LOCAL_REF(jniEnv, jobjectKey);
+            if (!success) {
+                return i >> 1;
             }
         }
-        return true;
+        return length >> 1;
     }
-    return false;
+    return 0;
 }
 
 JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_objectSetAccessor
@@ -716,24 +884,14 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_objectSetAcce
             auto v8LocalArrayContext = v8::Array::New(v8Isolate, 2);
             auto javetCallbackContextReferencePointer = new Javet::Callback::JavetCallbackContextReference(jniEnv, mContextGetter);
             INCREASE_COUNTER(Javet::Monitor::CounterType::NewJavetCallbackContextReference);
-            auto v8LocalContextGetterHandle = v8::BigInt::New(v8Isolate, TO_NATIVE_INT_64(javetCallbackContextReferencePointer));
-            javetCallbackContextReferencePointer->v8PersistentCallbackContextHandlePointer =
-                new V8PersistentBigInt(v8Isolate, v8LocalContextGetterHandle);
-            INCREASE_COUNTER(Javet::Monitor::CounterType::NewPersistentCallbackContextReference);
-            javetCallbackContextReferencePointer->v8PersistentCallbackContextHandlePointer->SetWeak(
-                javetCallbackContextReferencePointer, Javet::Callback::JavetCloseWeakCallbackContextHandle, v8::WeakCallbackType::kParameter);
+            auto v8LocalContextGetterHandle = javetCallbackContextReferencePointer->BindV8External(v8Isolate);
             auto maybeResult = v8LocalArrayContext->Set(v8Context, 0, v8LocalContextGetterHandle);
             v8::AccessorNameGetterCallback getter = Javet::Callback::JavetPropertyGetterCallback;
             v8::AccessorNameSetterCallback setter = nullptr;
             if (mContextSetter != nullptr) {
                 javetCallbackContextReferencePointer = new Javet::Callback::JavetCallbackContextReference(jniEnv, mContextSetter);
                 INCREASE_COUNTER(Javet::Monitor::CounterType::NewJavetCallbackContextReference);
-                auto v8LocalContextSetterHandle = v8::BigInt::New(v8Isolate, TO_NATIVE_INT_64(javetCallbackContextReferencePointer));
-                javetCallbackContextReferencePointer->v8PersistentCallbackContextHandlePointer =
-                    new V8PersistentBigInt(v8Isolate, v8LocalContextSetterHandle);
-                INCREASE_COUNTER(Javet::Monitor::CounterType::NewPersistentCallbackContextReference);
-                javetCallbackContextReferencePointer->v8PersistentCallbackContextHandlePointer->SetWeak(
-                    javetCallbackContextReferencePointer, Javet::Callback::JavetCloseWeakCallbackContextHandle, v8::WeakCallbackType::kParameter);
+                auto v8LocalContextSetterHandle = javetCallbackContextReferencePointer->BindV8External(v8Isolate);
                 maybeResult = v8LocalArrayContext->Set(v8Context, 1, v8LocalContextSetterHandle);
                 setter = Javet::Callback::JavetPropertySetterCallback;
             }
@@ -805,8 +963,7 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_objectSetPriv
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType, jstring mKey, jobject mValue) {
     RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
     if (v8LocalValue->IsObject()) {
-        auto v8LocalStringKey = Javet::Converter::ToV8String(jniEnv, v8Isolate, mKey);
-        auto v8LocalPrivateKey = v8::Private::ForApi(v8Isolate, v8LocalStringKey);
+        auto v8LocalPrivateKey = Javet::Converter::ToV8PrivateKey(jniEnv, v8Runtime, mKey);
         auto v8LocalPrivateValue = Javet::Converter::ToV8Value(jniEnv, v8Isolate, v8Context, mValue);
         auto v8MaybeBool = v8LocalValue.As<v8::Object>()->SetPrivate(v8Context, v8LocalPrivateKey, v8LocalPrivateValue);
         if (v8MaybeBool.IsNothing()) {
@@ -829,7 +986,7 @@ JNIEXPORT jboolean JNICALL Java_com_caoccao_javet_interop_V8Native_objectSetProp
             v8MaybeBool = v8LocalObject->Set(v8Context, integerKey, v8ValueValue);
         }
         else {
-            auto v8ValueKey = Javet::Converter::ToV8Value(jniEnv, v8Isolate, v8Context, key);
+            auto v8ValueKey = Javet::Converter::ToV8PropertyKey(jniEnv, v8Runtime, v8Context, key);
             if (!v8ValueKey.IsEmpty()) {
                 v8MaybeBool = v8LocalObject->Set(v8Context, v8ValueKey, v8ValueValue);
             }
@@ -18,26 +18,46 @@
 #include "javet_jni.h"
 
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_scriptCompile
-(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jstring mScript, jbyteArray mCachedData, jboolean mResultRequired,
-    jstring mResourceName, jint mResourceLineOffset, jint mResourceColumnOffset, jint mScriptId, jboolean mIsWASM, jboolean mIsModule) {
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jobject mScript, jbyteArray mCachedData, jboolean mResultRequired,
+    jstring mResourceName, jint mResourceLineOffset, jint mResourceColumnOffset, jint mScriptId, jboolean mIsWASM, jboolean mIsModule,
+    jint mCompileOptions, jintArray mCompileHints) {
     RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
     if (!mIsModule) {
         V8TryCatch v8TryCatch(v8Isolate);
-        auto umScript = Javet::Converter::ToV8String(jniEnv, v8Isolate, mScript);
+        auto umScript = Javet::Converter::ToV8SourceString(jniEnv, v8Isolate, mScript);
+        if (umScript.IsEmpty() && Javet::Converter::IsV8ExternalSource(jniEnv, mScript)) {
+            return Javet::Exceptions::ThrowJavetException(jniEnv, "RuntimeExternalSourceInvalid");
+        }
         auto scriptOriginPointer = Javet::Converter::ToV8ScriptOringinPointer(
             jniEnv, v8Isolate, mResourceName, mResourceLineOffset, mResourceColumnOffset, mScriptId, mIsWASM, mIsModule);
         v8::MaybeLocal<v8::Script> v8MaybeLocalScript;
-        if (mCachedData) {
-            V8ScriptCompilerSource scriptSource(
-                umScript, *scriptOriginPointer.get(), Javet::Converter::ToCachedDataPointer(jniEnv, mCachedData));
-            auto v8InternalIsolate = reinterpret_cast<V8InternalIsolate*>(v8Isolate);
-            V8InternalDisallowCompilation v8InternalDisallowCompilation(v8InternalIsolate);
-            v8MaybeLocalScript = v8::ScriptCompiler::Compile(v8Context, &scriptSource, v8::ScriptCompiler::kConsumeCodeCache);
-            LOG_DEBUG("Script cache is " << (scriptSource.GetCachedData()->rejected ? "rejected" : "accepted") << ".");
+        auto v8UnboundScriptCache = v8Runtime->v8UnboundScriptCache.get();
+        // The compile options and the compile hints only take effect when V8 compiles the script.
+        const bool unboundScriptCacheEnabled = v8UnboundScriptCache->IsEnabled() && !mIsWASM
+            && mCompileOptions == 0 && mCompileHints == nullptr;
+        if (unboundScriptCacheEnabled) {
+            // The script compiled in a previous context is bound to the current context.
+            v8MaybeLocalScript = v8UnboundScriptCache->Find(v8Context, umScript, *scriptOriginPointer.get());
         }
-        else {
-            V8ScriptCompilerSource scriptSource(umScript, *scriptOriginPointer.get());
-            v8MaybeLocalScript = v8::ScriptCompiler::Compile(v8Context, &scriptSource);
+        if (v8MaybeLocalScript.IsEmpty()) {
+            if (mCachedData) {
+                V8ScriptCompilerSource scriptSource(
+                    umScript, *scriptOriginPointer.get(), Javet::Converter::ToCachedDataPointer(jniEnv, mCachedData));
+                auto v8InternalIsolate = reinterpret_cast<V8InternalIsolate*>(v8Isolate);
+                V8InternalDisallowCompilation v8InternalDisallowCompilation(v8InternalIsolate);
+                v8MaybeLocalScript = v8::ScriptCompiler::Compile(v8Context, &scriptSource, v8::ScriptCompiler::kConsumeCodeCache);
+                Javet::Callback::JavetReportCodeCacheConsumption(
+                    jniEnv, v8Runtime->externalV8Runtime, scriptSource.GetCachedData(), "Script");
+            }
+            else {
+                Javet::CompileHints::CompileHints compileHints(jniEnv, mCompileOptions, mCompileHints);
+                V8ScriptCompilerSource scriptSource(
+                    umScript, *scriptOriginPointer.get(), compileHints.GetCallback(), compileHints.GetCallbackData());
+                v8MaybeLocalScript = v8::ScriptCompiler::Compile(v8Context, &scriptSource, compileHints.GetCompileOptions());
+            }
+            if (unboundScriptCacheEnabled && !v8MaybeLocalScript.IsEmpty()) {
+                v8UnboundScriptCache->Put(v8Isolate, umScript, *scriptOriginPointer.get(), v8MaybeLocalScript.ToLocalChecked());
+            }
         }
         if (v8TryCatch.HasCaught()) {
             return Javet::Exceptions::ThrowJavetCompilationException(jniEnv, v8Runtime, v8Context, v8TryCatch);
@@ -50,25 +70,45 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_scriptCompile
 }
 
 JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_scriptExecute
-(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jstring mScript, jbyteArray mCachedData, jboolean mResultRequired,
-    jstring mResourceName, jint mResourceLineOffset, jint mResourceColumnOffset, jint mScriptId, jboolean mIsWASM) {
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jobject mScript, jbyteArray mCachedData, jboolean mResultRequired,
+    jstring mResourceName, jint mResourceLineOffset, jint mResourceColumnOffset, jint mScriptId, jboolean mIsWASM,
+    jint mCompileOptions, jintArray mCompileHints) {
     RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
     V8TryCatch v8TryCatch(v8Isolate);
-    auto umScript = Javet::Converter::ToV8String(jniEnv, v8Isolate, mScript);
+    auto umScript = Javet::Converter::ToV8SourceString(jniEnv, v8Isolate, mScript);
+    if (umScript.IsEmpty() && Javet::Converter::IsV8ExternalSource(jniEnv, mScript)) {
+        return Javet::Exceptions::ThrowJavetException(jniEnv, "RuntimeExternalSourceInvalid");
+    }
     auto scriptOriginPointer = Javet::Converter::ToV8ScriptOringinPointer(
         jniEnv, v8Isolate, mResourceName, mResourceLineOffset, mResourceColumnOffset, mScriptId, mIsWASM, false);
     v8::MaybeLocal<v8::Script> v8MaybeLocalScript;
-    if (mCachedData) {
-        V8ScriptCompilerSource scriptSource(
-            umScript, *scriptOriginPointer.get(), Javet::Converter::ToCachedDataPointer(jniEnv, mCachedData));
-        auto v8InternalIsolate = reinterpret_cast<V8InternalIsolate*>(v8Isolate);
-        V8InternalDisallowCompilation v8InternalDisallowCompilation(v8InternalIsolate);
-        v8MaybeLocalScript = v8::ScriptCompiler::Compile(v8Context, &scriptSource, v8::ScriptCompiler::kConsumeCodeCache);
-        LOG_DEBUG("Script cache is " << (scriptSource.GetCachedData()->rejected ? "rejected" : "accepted") << ".");
+    auto v8UnboundScriptCache = v8Runtime->v8UnboundScriptCache.get();
+    // The compile options and the compile hints only take effect when V8 compiles the script.
+    const bool unboundScriptCacheEnabled = v8UnboundScriptCache->IsEnabled() && !mIsWASM
+        && mCompileOptions == 0 && mCompileHints == nullptr;
+    if (unboundScriptCacheEnabled) {
+        // The script compiled in a previous context is bound to the current context.
+        v8MaybeLocalScript = v8UnboundScriptCache->Find(v8Context, umScript, *scriptOriginPointer.get());
     }
-    else {
-        V8ScriptCompilerSource scriptSource(umScript, *scriptOriginPointer.get());
-        v8MaybeLocalScript = v8::ScriptCompiler::Compile(v8Context, &scriptSource);
+    if (v8MaybeLocalScript.IsEmpty()) {
+        if (mCachedData) {
+            V8ScriptCompilerSource scriptSource(
+                umScript, *scriptOriginPointer.get(), Javet::Converter::ToCachedDataPointer(jniEnv, mCachedData));
+            auto v8InternalIsolate = reinterpret_cast<V8InternalIsolate*>(v8Isolate);
+            V8InternalDisallowCompilation v8InternalDisallowCompilation(v8InternalIsolate);
+            v8MaybeLocalScript = v8::ScriptCompiler::Compile(v8Context, &scriptSource, v8::ScriptCompiler::kConsumeCodeCache);
+            Javet::Callback::JavetReportCodeCacheConsumption(
+                jniEnv, v8Runtime->externalV8Runtime, scriptSource.GetCachedData(), "Script");
+        }
+        else {
+            Javet::CompileHints::CompileHints compileHints(jniEnv, mCompileOptions, mCompileHints);
+            V8ScriptCompilerSource scriptSource(
+                umScript, *scriptOriginPointer.get(), compileHints.GetCallback(), compileHints.GetCallbackData());
+            v8MaybeLocalScript = v8::ScriptCompiler::Compile(v8Context, &scriptSource, compileHints.GetCompileOptions());
+        }
+        if (unboundScriptCacheEnabled && !v8MaybeLocalScript.IsEmpty()) {
+            v8UnboundScriptCache->Put(v8Isolate, umScript, *scriptOriginPointer.get(), v8MaybeLocalScript.ToLocalChecked());
+        }
     }
     if (v8TryCatch.HasCaught()) {
         return Javet::Exceptions::ThrowJavetCompilationException(jniEnv, v8Runtime, v8Context, v8TryCatch);
@@ -108,6 +148,19 @@ JNIEXPORT jbyteArray JNICALL Java_com_caoccao_javet_interop_V8Native_scriptGetCa
     return nullptr;
 }
 
+JNIEXPORT jintArray JNICALL Java_com_caoccao_javet_interop_V8Native_scriptGetCompileHints
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType) {
+    if (IS_V8_SCRIPT(v8ValueType)) {
+        RUNTIME_AND_SCRIPT_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+        if (!v8LocalScript.IsEmpty()) {
+            // The collector is empty unless the script was compiled with kProduceCompileHints.
+            auto compileHints = v8LocalScript->GetCompileHintsCollector()->GetCompileHints(v8Isolate);
+            return Javet::CompileHints::ToJavaIntArray(jniEnv, compileHints);
+        }
+    }
+    return nullptr;
+}
+
 JNIEXPORT jstring JNICALL Java_com_caoccao_javet_interop_V8Native_scriptGetResourceName
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType) {
     if (IS_V8_SCRIPT(v8ValueType)) {
@@ -139,3 +192,50 @@ JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_scriptRun
     Javet::Exceptions::ClearJNIException(jniEnv);
     return Javet::Converter::ToExternalV8ValueUndefined(jniEnv, v8Runtime);
 }
+
+JNIEXPORT jlong JNICALL Java_com_caoccao_javet_interop_V8Native_scriptStreamingCreate
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jobject mInputStream, jint bufferSize,
+    jint mCompileOptions, jintArray mCompileHints) {
+    RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
+    auto scriptStreamingPointer = new Javet::ScriptStreaming::ScriptStreaming(
+        jniEnv, v8Isolate, mInputStream, bufferSize, mCompileOptions, mCompileHints);
+    INCREASE_COUNTER(Javet::Monitor::CounterType::New);
+    return TO_JAVA_LONG(scriptStreamingPointer);
+}
+
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_scriptStreamingFinish
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong scriptStreamingHandle,
+    jstring mResourceName, jint mResourceLineOffset, jint mResourceColumnOffset, jint mScriptId) {
+    RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE_WITH_UNIQUE_LOCKER(v8RuntimeHandle);
+    auto scriptStreamingPointer = reinterpret_cast<Javet::ScriptStreaming::ScriptStreaming*>(scriptStreamingHandle);
+    V8TryCatch v8TryCatch(v8Isolate);
+    auto scriptOriginPointer = Javet::Converter::ToV8ScriptOringinPointer(
+        jniEnv, v8Isolate, mResourceName, mResourceLineOffset, mResourceColumnOffset, mScriptId, false, false);
+    auto v8MaybeLocalScript = scriptStreamingPointer->Finish(v8Context, *scriptOriginPointer.get());
+    if (v8TryCatch.HasCaught()) {
+        return Javet::Exceptions::ThrowJavetCompilationException(jniEnv, v8Runtime, v8Context, v8TryCatch);
+    }
+    else if (!v8MaybeLocalScript.IsEmpty()) {
+        return Javet::Converter::ToExternalV8Script(jniEnv, v8Runtime, v8MaybeLocalScript.ToLocalChecked());
+    }
+    return nullptr;
+}
+
+JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_scriptStreamingRelease
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong scriptStreamingHandle) {
+    RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE_WITH_UNIQUE_LOCKER(v8RuntimeHandle);
+    auto scriptStreamingPointer = reinterpret_cast<Javet::ScriptStreaming::ScriptStreaming*>(scriptStreamingHandle);
+    scriptStreamingPointer->Release(jniEnv);
+    delete scriptStreamingPointer;
+    INCREASE_COUNTER(Javet::Monitor::CounterType::Delete);
+}
+
+/*
+ * The streaming task runs without the V8 isolate lock on the calling thread,
+ * so that the parsing overlaps the I/O and does not block the V8 runtime.
+ */
+JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_scriptStreamingRun
+(JNIEnv* jniEnv, jobject caller, jlong scriptStreamingHandle) {
+    auto scriptStreamingPointer = reinterpret_cast<Javet::ScriptStreaming::ScriptStreaming*>(scriptStreamingHandle);
+    scriptStreamingPointer->Run(jniEnv);
+}
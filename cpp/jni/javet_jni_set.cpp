@@ -17,6 +17,42 @@
 
 #include "javet_jni.h"
 
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_batchSetAdd
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType,
+    jobjectArray v8Values, jint length) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    if (IS_V8_SET(v8ValueType)) {
+        int valueLength = jniEnv->GetArrayLength(v8Values);
+        length = length > valueLength ? valueLength : length;
+        if (length > 0) {
+            auto v8LocalSet = v8LocalValue.As<v8::Set>();
+            // One try-catch covers the whole batch. The first failure stops the batch.
+            V8TryCatch v8TryCatch(v8Isolate);
+            for (int i = 0; i < length; ++i) {
+                V8HandleScope v8HandleScope(v8Isolate);
+                auto value = jniEnv->GetObjectArrayElement(v8Values, i);
+                auto v8LocalValueValue = Javet::Converter::ToV8Value(jniEnv, v8Isolate, v8Context, value);
+                jniEnv->DeleteLocalRef(value);
+                if (v8TryCatch.HasCaught()) {
+                    Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
+                    return i;
+                }
+                auto v8MaybeLocalSet = v8LocalSet->Add(v8Context, v8LocalValueValue);
+                if (v8TryCatch.HasCaught()) {
+                    Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
+                    return i;
+                }
+                if (v8MaybeLocalSet.IsEmpty()) {
+                    Javet::Exceptions::HandlePendingException(jniEnv, v8Runtime, v8Context);
+                    return i;
+                }
+            }
+        }
+        return length;
+    }
+    return 0;
+}
+
 JNIEXPORT void JNICALL Java_com_caoccao_javet_interop_V8Native_setAdd
 (JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType, jobject value) {
     RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
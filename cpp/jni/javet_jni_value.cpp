@@ -0,0 +1,129 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include "javet_jni.h"
+
+namespace Javet {
+    namespace V8ValueSerialization {
+        /*
+         * The serializer delegate writes directly into the memory of a Java direct byte buffer.
+         * Once the serialized data outgrows the byte buffer, it moves to the native heap
+         * so that the serializer can complete and report the required length.
+         */
+        class DirectByteBufferSerializerDelegate : public v8::ValueSerializer::Delegate {
+        public:
+            DirectByteBufferSerializerDelegate(V8Isolate* v8Isolate, uint8_t* bufferPointer, size_t bufferCapacity) noexcept
+                : bufferCapacity(bufferCapacity), bufferPointer(bufferPointer), v8Isolate(v8Isolate) {
+            }
+
+            void FreeBufferMemory(void* buffer) override {
+                if (buffer != bufferPointer) {
+                    free(buffer);
+                }
+            }
+
+            bool IsDirect(const uint8_t* buffer) const noexcept {
+                return buffer == bufferPointer;
+            }
+
+            void* ReallocateBufferMemory(void* oldBuffer, size_t size, size_t* actualSize) override {
+                if (size <= bufferCapacity && (oldBuffer == nullptr || oldBuffer == bufferPointer)) {
+                    *actualSize = bufferCapacity;
+                    return bufferPointer;
+                }
+                void* newBuffer;
+                if (oldBuffer != nullptr && oldBuffer == bufferPointer) {
+                    newBuffer = malloc(size);
+                    if (newBuffer != nullptr) {
+                        memcpy(newBuffer, bufferPointer, bufferCapacity);
+                    }
+                }
+                else {
+                    newBuffer = realloc(oldBuffer, size);
+                }
+                if (newBuffer != nullptr) {
+                    *actualSize = size;
+                }
+                return newBuffer;
+            }
+
+            void ThrowDataCloneError(V8LocalString message) override {
+                v8Isolate->ThrowException(v8::Exception::Error(message));
+            }
+
+        private:
+            size_t bufferCapacity;
+            uint8_t* bufferPointer;
+            V8Isolate* v8Isolate;
+        };
+    }
+}
+
+JNIEXPORT jobject JNICALL Java_com_caoccao_javet_interop_V8Native_valueDeserialize
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jobject mByteBuffer, jint length) {
+    RUNTIME_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle);
+    auto bufferPointer = static_cast<const uint8_t*>(jniEnv->GetDirectBufferAddress(mByteBuffer));
+    auto bufferCapacity = jniEnv->GetDirectBufferCapacity(mByteBuffer);
+    if (bufferPointer == nullptr || length <= 0 || length > bufferCapacity) {
+        return Javet::Exceptions::ThrowJavetException(jniEnv, "RuntimeByteBufferInvalid");
+    }
+    V8TryCatch v8TryCatch(v8Isolate);
+    v8::ValueDeserializer v8ValueDeserializer(v8Isolate, bufferPointer, static_cast<size_t>(length));
+    V8MaybeLocalValue v8MaybeLocalValue;
+    if (v8ValueDeserializer.ReadHeader(v8Context).FromMaybe(false)) {
+        v8MaybeLocalValue = v8ValueDeserializer.ReadValue(v8Context);
+    }
+    if (v8TryCatch.HasCaught()) {
+        return Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
+    }
+    if (v8MaybeLocalValue.IsEmpty()) {
+        // A failed read must not be mistaken for a legitimate undefined.
+        return Javet::Exceptions::ThrowJavetException(jniEnv, "RuntimeSerializedDataInvalid");
+    }
+    return v8Runtime->SafeToExternalV8Value(jniEnv, v8Isolate, v8Context, v8MaybeLocalValue.ToLocalChecked());
+}
+
+JNIEXPORT jint JNICALL Java_com_caoccao_javet_interop_V8Native_valueSerialize
+(JNIEnv* jniEnv, jobject caller, jlong v8RuntimeHandle, jlong v8ValueHandle, jint v8ValueType, jobject mByteBuffer) {
+    RUNTIME_AND_VALUE_HANDLES_TO_OBJECTS_WITH_SCOPE(v8RuntimeHandle, v8ValueHandle);
+    auto bufferPointer = static_cast<uint8_t*>(jniEnv->GetDirectBufferAddress(mByteBuffer));
+    auto bufferCapacity = jniEnv->GetDirectBufferCapacity(mByteBuffer);
+    if (bufferPointer == nullptr || bufferCapacity < 0) {
+        Javet::Exceptions::ThrowJavetException(jniEnv, "RuntimeByteBufferInvalid");
+        return -1;
+    }
+    Javet::V8ValueSerialization::DirectByteBufferSerializerDelegate delegate(
+        v8Isolate, bufferPointer, static_cast<size_t>(bufferCapacity));
+    v8::ValueSerializer v8ValueSerializer(v8Isolate, &delegate);
+    V8TryCatch v8TryCatch(v8Isolate);
+    v8ValueSerializer.WriteHeader();
+    auto v8MaybeBool = v8ValueSerializer.WriteValue(v8Context, v8LocalValue);
+    auto [buffer, length] = v8ValueSerializer.Release();
+    if (!delegate.IsDirect(buffer)) {
+        delegate.FreeBufferMemory(buffer);
+    }
+    if (v8TryCatch.HasCaught() || v8MaybeBool.IsNothing() || !v8MaybeBool.FromJust()) {
+        if (v8TryCatch.HasTerminated()) {
+            Javet::Exceptions::ThrowJavetExecutionException(jniEnv, v8Runtime, v8Context, v8TryCatch);
+        }
+        // The data clone error is swallowed so that the caller can fall back silently.
+        return -1;
+    }
+    return static_cast<jint>(length);
+}
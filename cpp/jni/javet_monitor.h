@@ -80,7 +80,12 @@ namespace Javet {
                 DeletePersistentReference = 12,
                 DeletePersistentCallbackContextReference = 13,
                 DeleteV8Runtime = 14,
-                Max = 15,
+                AttachCurrentThread = 15,
+                JNIEnvCacheHit = 16,
+                CodeCacheAccepted = 17,
+                CodeCacheRejected = 18,
+                FastApiCall = 19,
+                Max = 20,
             };
         };
 
@@ -15,6 +15,7 @@
  *   limitations under the License.
  */
 
+#include "javet_array_buffer_allocator.h"
 #include "javet_callbacks.h"
 #include "javet_constants.h"
 #include "javet_converter.h"
@@ -22,7 +23,11 @@
 #include "javet_exceptions.h"
 #include "javet_inspector.h"
 #include "javet_logging.h"
+#include "javet_monitor.h"
 #include "javet_native.h"
+#include "javet_property_key_cache.h"
+#include "javet_script_streaming.h"
+#include "javet_unbound_script_cache.h"
 #include "javet_v8_runtime.h"
 
 JavaVM* GlobalJavaVM;
@@ -44,11 +49,15 @@ jint JNI_OnLoad(JavaVM* javaVM, void* reserved) {
 #ifdef ENABLE_NODE
     Javet::NodeNative::Initialize(jniEnv);
 #endif
+    Javet::ArrayBufferAllocator::Initialize(jniEnv);
     Javet::Callback::Initialize(jniEnv);
     Javet::Converter::Initialize(jniEnv);
     Javet::Exceptions::Initialize(jniEnv);
     Javet::Inspector::Initialize(jniEnv);
     Javet::Monitor::Initialize(jniEnv);
+    Javet::PropertyKeyCache::Initialize(jniEnv);
+    Javet::ScriptStreaming::Initialize(jniEnv);
+    Javet::UnboundScriptCache::Initialize(jniEnv);
     LOG_INFO("JNI_Onload() ends.");
     return SUPPORTED_JNI_VERSION;
 }
@@ -72,6 +81,53 @@ void JNI_OnUnload(JavaVM* javaVM, void* reserved) {
 }
 
 namespace Javet {
+    class JNIEnvCache {
+    public:
+        bool attached;
+        JavaVM* javaVM;
+        JNIEnv* jniEnv;
+
+        JNIEnvCache() noexcept : attached(false), javaVM(nullptr), jniEnv(nullptr) {
+        }
+
+        ~JNIEnvCache() {
+            // Only the threads attached by Javet are detached by Javet.
+            if (attached && javaVM != nullptr && javaVM == GlobalJavaVM) {
+                JNIEnv* currentJNIEnv = nullptr;
+                if (javaVM->GetEnv((void**)&currentJNIEnv, SUPPORTED_JNI_VERSION) == JNI_OK) {
+                    javaVM->DetachCurrentThread();
+                }
+            }
+            attached = false;
+            javaVM = nullptr;
+            jniEnv = nullptr;
+        }
+    };
+
+    thread_local JNIEnvCache threadLocalJNIEnvCache;
+
+    JNIEnv* GetJNIEnv(JavaVM* javaVM) noexcept {
+        auto& jniEnvCache = threadLocalJNIEnvCache;
+        if (jniEnvCache.jniEnv != nullptr && jniEnvCache.javaVM == javaVM) {
+            INCREASE_COUNTER(Javet::Monitor::CounterType::JNIEnvCacheHit);
+            return jniEnvCache.jniEnv;
+        }
+        JNIEnv* jniEnv = nullptr;
+        if (javaVM->GetEnv((void**)&jniEnv, SUPPORTED_JNI_VERSION) == JNI_EDETACHED) {
+            if (javaVM->AttachCurrentThreadAsDaemon((void**)&jniEnv, nullptr) == JNI_OK) {
+                jniEnvCache.attached = true;
+                INCREASE_COUNTER(Javet::Monitor::CounterType::AttachCurrentThread);
+            }
+            else {
+                LOG_ERROR("Failed to call JavaVM.AttachCurrentThreadAsDaemon().");
+                return nullptr;
+            }
+        }
+        jniEnvCache.javaVM = javaVM;
+        jniEnvCache.jniEnv = jniEnv;
+        return jniEnv;
+    }
+
 #ifdef ENABLE_NODE
     namespace NodeNative {
         jclass jclassV8Host;
@@ -101,7 +157,6 @@ namespace Javet {
         std::unique_ptr<node::MultiIsolatePlatform> GlobalV8Platform;
 #else
         std::unique_ptr<V8Platform> GlobalV8Platform;
-        std::shared_ptr<V8ArrayBufferAllocator> GlobalV8ArrayBufferAllocator;
 #endif
 
         jclass jclassV8Host;
@@ -119,9 +174,6 @@ namespace Javet {
                 node::TearDownOncePerProcess();
 #endif
                 GlobalV8Platform.reset();
-#ifndef ENABLE_NODE
-                GlobalV8ArrayBufferAllocator.reset();
-#endif
             }
         }
 
@@ -205,12 +257,6 @@ namespace Javet {
 #endif
                 v8::V8::Initialize();
             }
-#ifndef ENABLE_NODE
-            if (!GlobalV8ArrayBufferAllocator) {
-                GlobalV8ArrayBufferAllocator = std::shared_ptr<V8ArrayBufferAllocator>();
-                GlobalV8ArrayBufferAllocator.reset(V8ArrayBufferAllocator::NewDefaultAllocator());
-            }
-#endif
             LOG_INFO("V8::Initialize() ends.");
         }
     }
@@ -28,9 +28,7 @@
 #endif
 
 #define FETCH_JNI_ENV(javaVMPointer) \
-    JNIEnv* jniEnv; \
-    javaVMPointer->GetEnv((void**)&jniEnv, SUPPORTED_JNI_VERSION); \
-    javaVMPointer->AttachCurrentThread((void**)&jniEnv, nullptr);
+    JNIEnv* jniEnv = Javet::GetJNIEnv(javaVMPointer);
 
 #define DELETE_LOCAL_REF(jniEnv, localRef) if (localRef != nullptr) { jniEnv->DeleteLocalRef(localRef); }
 
@@ -122,6 +120,13 @@
 extern JavaVM* GlobalJavaVM;
 
 namespace Javet {
+    /*
+     * The JNIEnv is cached per thread so that native callbacks do not need to call
+     * GetEnv and AttachCurrentThread every time.
+     * Threads not created by JVM, e.g. V8 platform workers, are attached as daemons once
+     * and detached automatically when the threads exit.
+     */
+    JNIEnv* GetJNIEnv(JavaVM* javaVM) noexcept;
 
 #ifdef ENABLE_NODE
     namespace NodeNative {
@@ -137,7 +142,6 @@ namespace Javet {
         extern std::unique_ptr<node::MultiIsolatePlatform> GlobalV8Platform;
 #else
         extern std::unique_ptr<V8Platform> GlobalV8Platform;
-        extern std::shared_ptr<V8ArrayBufferAllocator> GlobalV8ArrayBufferAllocator;
 #endif
 
         void Dispose(JNIEnv* jniEnv) noexcept;
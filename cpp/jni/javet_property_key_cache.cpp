@@ -0,0 +1,138 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include "javet_constants.h"
+#include "javet_converter.h"
+#include "javet_property_key_cache.h"
+
+namespace Javet {
+    namespace PropertyKeyCache {
+        static jclass jclassV8PropertyKeyCacheStatistics;
+        static jmethodID jmethodIDV8PropertyKeyCacheStatisticsConstructor;
+
+        void Initialize(JNIEnv* jniEnv) noexcept {
+            jclassV8PropertyKeyCacheStatistics = FIND_CLASS(jniEnv, "com/caoccao/javet/interop/monitoring/V8PropertyKeyCacheStatistics");
+            jmethodIDV8PropertyKeyCacheStatisticsConstructor = jniEnv->GetMethodID(jclassV8PropertyKeyCacheStatistics, "<init>", "(JJJJJ)V");
+        }
+
+        PropertyKeyCache::PropertyKeyCache(const size_t capacity) noexcept
+            : capacity(capacity), evictionCount(0), hitCount(0), missCount(0), size(0) {
+        }
+
+        void PropertyKeyCache::Clear() noexcept {
+            for (auto& entry : entries) {
+                entry.v8GlobalName.Reset();
+                entry.v8GlobalPrivate.Reset();
+            }
+            entries.clear();
+            index.clear();
+            size = 0;
+        }
+
+        PropertyKeyCache::Entry* PropertyKeyCache::Find(JNIEnv* jniEnv, V8Isolate* v8Isolate, const jstring mKey) noexcept {
+            if (mKey == nullptr) {
+                return nullptr;
+            }
+            Javet::Converter::JavaStringCharacters javaStringCharacters(jniEnv, mKey);
+            const int length = javaStringCharacters.GetLength();
+            // The leading tag keeps a one-byte key from colliding with a two-byte key of the same bytes.
+            lookupKey.clear();
+            if (javaStringCharacters.IsOneByte()) {
+                lookupKey.push_back('1');
+                lookupKey.append(reinterpret_cast<const char*>(javaStringCharacters.GetOneByteData()), length);
+            }
+            else {
+                lookupKey.push_back('2');
+                lookupKey.append(reinterpret_cast<const char*>(javaStringCharacters.GetTwoByteData()), length * sizeof(uint16_t));
+            }
+            auto it = index.find(lookupKey);
+            if (it != index.end()) {
+                ++hitCount;
+                entries.splice(entries.begin(), entries, it->second);
+                return &entries.front();
+            }
+            ++missCount;
+            V8MaybeLocalString v8MaybeLocalString = javaStringCharacters.IsOneByte()
+                ? v8::String::NewFromOneByte(
+                    v8Isolate, javaStringCharacters.GetOneByteData(), v8::NewStringType::kInternalized, length)
+                : v8::String::NewFromTwoByte(
+                    v8Isolate, javaStringCharacters.GetTwoByteData(), v8::NewStringType::kInternalized, length);
+            if (v8MaybeLocalString.IsEmpty()) {
+                return nullptr;
+            }
+            if (index.size() >= capacity) {
+                auto& evictedEntry = entries.back();
+                evictedEntry.v8GlobalName.Reset();
+                evictedEntry.v8GlobalPrivate.Reset();
+                index.erase(evictedEntry.key);
+                entries.pop_back();
+                ++evictionCount;
+            }
+            entries.emplace_front();
+            auto& entry = entries.front();
+            entry.key = lookupKey;
+            entry.v8GlobalName.Reset(v8Isolate, v8MaybeLocalString.ToLocalChecked());
+            index.emplace(entry.key, entries.begin());
+            size = index.size();
+            return &entry;
+        }
+
+        V8LocalString PropertyKeyCache::GetName(JNIEnv* jniEnv, V8Isolate* v8Isolate, const jstring mKey) noexcept {
+            auto entry = Find(jniEnv, v8Isolate, mKey);
+            if (entry == nullptr) {
+                return V8LocalString();
+            }
+            return entry->v8GlobalName.Get(v8Isolate);
+        }
+
+        V8LocalPrivate PropertyKeyCache::GetPrivate(JNIEnv* jniEnv, V8Isolate* v8Isolate, const jstring mKey) noexcept {
+            auto entry = Find(jniEnv, v8Isolate, mKey);
+            if (entry == nullptr) {
+                return V8LocalPrivate();
+            }
+            if (entry->v8GlobalPrivate.IsEmpty()) {
+                auto v8LocalPrivate = v8::Private::ForApi(v8Isolate, entry->v8GlobalName.Get(v8Isolate));
+                entry->v8GlobalPrivate.Reset(v8Isolate, v8LocalPrivate);
+                return v8LocalPrivate;
+            }
+            return entry->v8GlobalPrivate.Get(v8Isolate);
+        }
+
+        jobject PropertyKeyCache::GetStatistics(JNIEnv* jniEnv) const noexcept {
+            return jniEnv->NewObject(
+                jclassV8PropertyKeyCacheStatistics,
+                jmethodIDV8PropertyKeyCacheStatisticsConstructor,
+                static_cast<jlong>(capacity.load()),
+                static_cast<jlong>(evictionCount.load()),
+                static_cast<jlong>(hitCount.load()),
+                static_cast<jlong>(missCount.load()),
+                static_cast<jlong>(size.load()));
+        }
+
+        void PropertyKeyCache::Reset(const size_t capacity) noexcept {
+            Clear();
+            this->capacity = capacity;
+            evictionCount = 0;
+            hitCount = 0;
+            missCount = 0;
+        }
+
+        PropertyKeyCache::~PropertyKeyCache() {
+            Clear();
+        }
+    }
+}
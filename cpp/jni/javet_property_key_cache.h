@@ -0,0 +1,80 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#pragma once
+
+#include <jni.h>
+#include <atomic>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include "javet_v8.h"
+
+namespace Javet {
+    namespace PropertyKeyCache {
+        void Initialize(JNIEnv* jniEnv) noexcept;
+
+        /*
+         * The property key cache is created per V8 runtime.
+         * It maps the content of Java strings to internalized V8 strings and private symbols,
+         * so that hot property keys are neither copied nor internalized again on every lookup.
+         * The least recently used key is evicted when the capacity is reached.
+         * It must be called with the V8 isolate locked, except for the statistics.
+         */
+        class PropertyKeyCache final {
+        public:
+            PropertyKeyCache(const size_t capacity) noexcept;
+
+            void Clear() noexcept;
+
+            V8LocalString GetName(JNIEnv* jniEnv, V8Isolate* v8Isolate, const jstring mKey) noexcept;
+            V8LocalPrivate GetPrivate(JNIEnv* jniEnv, V8Isolate* v8Isolate, const jstring mKey) noexcept;
+            jobject GetStatistics(JNIEnv* jniEnv) const noexcept;
+
+            inline bool IsEnabled() const noexcept {
+                return capacity > 0;
+            }
+
+            /*
+             * The cache object lives as long as the V8 runtime, so that the statistics
+             * can be read without the lock while the V8 isolate is being reset.
+             */
+            void Reset(const size_t capacity) noexcept;
+
+            ~PropertyKeyCache();
+
+        private:
+            struct Entry {
+                std::string key;
+                V8GlobalString v8GlobalName;
+                V8GlobalPrivate v8GlobalPrivate;
+            };
+
+            std::atomic<size_t> capacity;
+            std::list<Entry> entries;
+            std::atomic<size_t> evictionCount;
+            std::atomic<size_t> hitCount;
+            std::unordered_map<std::string, std::list<Entry>::iterator> index;
+            // The lookup key is reused to avoid an allocation per lookup.
+            std::string lookupKey;
+            std::atomic<size_t> missCount;
+            std::atomic<size_t> size;
+
+            Entry* Find(JNIEnv* jniEnv, V8Isolate* v8Isolate, const jstring mKey) noexcept;
+        };
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ *   Copyright (c) 2021-2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+#include "javet_logging.h"
+#include "javet_reference_table.h"
+
+namespace Javet {
+    V8PersistentReferenceTable::V8PersistentReferenceTable() noexcept
+        : freeSlotPointer(nullptr), size(0), slabs() {
+    }
+
+    void V8PersistentReferenceTable::Grow() noexcept {
+        std::unique_ptr<Slot[]> slab(new Slot[SLAB_SIZE]);
+        // The slots are chained in the natural order so that adjacent references stay close.
+        for (size_t i = 0; i < SLAB_SIZE; ++i) {
+            slab[i].generation = 0;
+            slab[i].nextFreeSlotPointer = i + 1 < SLAB_SIZE ? &slab[i + 1] : freeSlotPointer;
+        }
+        freeSlotPointer = &slab[0];
+        slabs.push_back(std::move(slab));
+    }
+
+    bool V8PersistentReferenceTable::Release(const jlong handle) noexcept {
+        auto slotPointer = reinterpret_cast<Slot*>(TO_V8_PERSISTENT_DATA_POINTER(handle));
+        if (slotPointer == nullptr || !IsInUse(slotPointer)) {
+            LOG_ERROR("Persistent reference " << handle << " is not in use.");
+            return false;
+        }
+        slotPointer->v8PersistentData.Reset();
+        ++slotPointer->generation;
+        slotPointer->nextFreeSlotPointer = freeSlotPointer;
+        freeSlotPointer = slotPointer;
+        --size;
+        INCREASE_COUNTER(Javet::Monitor::CounterType::DeletePersistentReference);
+        return true;
+    }
+
+    size_t V8PersistentReferenceTable::ReleaseAll() noexcept {
+        size_t releasedCount = 0;
+        if (size > 0) {
+            for (auto& slab : slabs) {
+                for (size_t i = 0; i < SLAB_SIZE; ++i) {
+                    auto slotPointer = &slab[i];
+                    if (IsInUse(slotPointer)) {
+                        Release(TO_JAVA_LONG(&slotPointer->v8PersistentData));
+                        ++releasedCount;
+                    }
+                }
+            }
+        }
+        return releasedCount;
+    }
+
+    V8PersistentReferenceTable::~V8PersistentReferenceTable() {
+        // The persistent handles must have been released before the isolate is disposed.
+        freeSlotPointer = nullptr;
+        size = 0;
+        slabs.clear();
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ *   Copyright (c) 2021-2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "javet_monitor.h"
+#include "javet_v8.h"
+
+namespace Javet {
+    /*
+     * The persistent reference table allocates the persistent handles referenced by Java
+     * from slabs with a freelist, so that creating or releasing a reference doesn't hit malloc / free.
+     * The slabs never move, so the address of a slot is still the Java handle.
+     * Every slot carries a generation which is odd when the slot is in use,
+     * so that a stale or duplicated release is rejected cheaply.
+     * All the methods must be called with the V8 locker held.
+     */
+    class V8PersistentReferenceTable {
+    public:
+        V8PersistentReferenceTable() noexcept;
+
+        template<class T>
+        inline jlong Allocate(V8Isolate* v8Isolate, const v8::Local<T>& v8Data) noexcept {
+            if (freeSlotPointer == nullptr) {
+                Grow();
+            }
+            auto slotPointer = freeSlotPointer;
+            freeSlotPointer = slotPointer->nextFreeSlotPointer;
+            slotPointer->nextFreeSlotPointer = nullptr;
+            ++slotPointer->generation;
+            ++size;
+            reinterpret_cast<v8::Persistent<T>*>(&slotPointer->v8PersistentData)->Reset(v8Isolate, v8Data);
+            INCREASE_COUNTER(Javet::Monitor::CounterType::NewPersistentReference);
+            return TO_JAVA_LONG(&slotPointer->v8PersistentData);
+        }
+
+        inline size_t GetCapacity() const noexcept {
+            return slabs.size() * SLAB_SIZE;
+        }
+
+        inline size_t GetSize() const noexcept {
+            return size;
+        }
+
+        bool Release(const jlong handle) noexcept;
+        size_t ReleaseAll() noexcept;
+
+        virtual ~V8PersistentReferenceTable();
+
+    private:
+        static constexpr size_t SLAB_SIZE = 1024;
+
+        struct Slot {
+            // The persistent handle must be the first member because its address is the Java handle.
+            V8PersistentData v8PersistentData;
+            uint32_t generation;
+            Slot* nextFreeSlotPointer;
+        };
+
+        Slot* freeSlotPointer;
+        size_t size;
+        std::vector<std::unique_ptr<Slot[]>> slabs;
+
+        void Grow() noexcept;
+
+        static inline bool IsInUse(const Slot* slotPointer) noexcept {
+            return (slotPointer->generation & 1) == 1;
+        }
+    };
+}
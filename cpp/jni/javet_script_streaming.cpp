@@ -0,0 +1,123 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include "javet_constants.h"
+#include "javet_monitor.h"
+#include "javet_native.h"
+#include "javet_script_streaming.h"
+
+namespace Javet {
+    namespace ScriptStreaming {
+        static jclass jclassInputStream;
+        static jmethodID jmethodIDInputStreamRead;
+
+        void Initialize(JNIEnv* jniEnv) noexcept {
+            jclassInputStream = FIND_CLASS(jniEnv, "java/io/InputStream");
+            jmethodIDInputStreamRead = jniEnv->GetMethodID(jclassInputStream, "read", "([B)I");
+        }
+
+        JavaSourceStream::JavaSourceStream(JNIEnv* jniEnv, const jobject mInputStream, const jint bufferSize) noexcept
+            : jniEnv(nullptr) {
+            auto mLocalBuffer = jniEnv->NewByteArray(bufferSize);
+            mBuffer = (jbyteArray)jniEnv->NewGlobalRef(mLocalBuffer);
+            INCREASE_COUNTER(Javet::Monitor::CounterType::NewGlobalRef);
+            DELETE_LOCAL_REF(jniEnv, mLocalBuffer);
+            this->mInputStream = jniEnv->NewGlobalRef(mInputStream);
+            INCREASE_COUNTER(Javet::Monitor::CounterType::NewGlobalRef);
+        }
+
+        size_t JavaSourceStream::GetMoreData(const uint8_t** src) {
+            if (jniEnv == nullptr || mInputStream == nullptr) {
+                return 0;
+            }
+            jint length;
+            do {
+                length = jniEnv->CallIntMethod(mInputStream, jmethodIDInputStreamRead, mBuffer);
+                // The Java exception is left pending and surfaces when Run() returns to Java.
+                if (jniEnv->ExceptionCheck() || length < 0) {
+                    return 0;
+                }
+            } while (length == 0);
+            // V8 takes the ownership of the chunk and deletes it with delete[].
+            auto chunk = new uint8_t[length];
+            jniEnv->GetByteArrayRegion(mBuffer, 0, length, reinterpret_cast<jbyte*>(chunk));
+            source.append(reinterpret_cast<const char*>(chunk), length);
+            *src = chunk;
+            return static_cast<size_t>(length);
+        }
+
+        void JavaSourceStream::Release(JNIEnv* jniEnv) noexcept {
+            if (mBuffer != nullptr) {
+                jniEnv->DeleteGlobalRef(mBuffer);
+                INCREASE_COUNTER(Javet::Monitor::CounterType::DeleteGlobalRef);
+                mBuffer = nullptr;
+            }
+            if (mInputStream != nullptr) {
+                jniEnv->DeleteGlobalRef(mInputStream);
+                INCREASE_COUNTER(Javet::Monitor::CounterType::DeleteGlobalRef);
+                mInputStream = nullptr;
+            }
+        }
+
+        ScriptStreaming::ScriptStreaming(
+            JNIEnv* jniEnv,
+            V8Isolate* v8Isolate,
+            const jobject mInputStream,
+            const jint bufferSize,
+            const jint mCompileOptions,
+            const jintArray mCompileHints) noexcept
+            : compileHints(jniEnv, mCompileOptions, mCompileHints) {
+            auto javaSourceStreamPointer = std::make_unique<JavaSourceStream>(jniEnv, mInputStream, bufferSize);
+            javaSourceStream = javaSourceStreamPointer.get();
+            v8StreamedSource = std::make_unique<V8StreamedSource>(
+                std::move(javaSourceStreamPointer), V8StreamedSource::UTF8);
+            v8ScriptStreamingTask.reset(v8::ScriptCompiler::StartStreaming(
+                v8Isolate,
+                v8StreamedSource.get(),
+                v8::ScriptType::kClassic,
+                compileHints.GetCompileOptions(),
+                compileHints.GetCallback(),
+                compileHints.GetCallbackData()));
+        }
+
+        V8MaybeLocalScript ScriptStreaming::Finish(
+            const V8LocalContext& v8Context,
+            const v8::ScriptOrigin& scriptOrigin) noexcept {
+            auto v8Isolate = v8Context->GetIsolate();
+            const auto& source = javaSourceStream->GetSource();
+            auto v8MaybeLocalString = v8::String::NewFromUtf8(
+                v8Isolate, source.data(), v8::NewStringType::kNormal, static_cast<int>(source.size()));
+            if (v8MaybeLocalString.IsEmpty()) {
+                return V8MaybeLocalScript();
+            }
+            return v8::ScriptCompiler::Compile(
+                v8Context, v8StreamedSource.get(), v8MaybeLocalString.ToLocalChecked(), scriptOrigin);
+        }
+
+        void ScriptStreaming::Release(JNIEnv* jniEnv) noexcept {
+            javaSourceStream->Release(jniEnv);
+        }
+
+        void ScriptStreaming::Run(JNIEnv* jniEnv) noexcept {
+            javaSourceStream->SetJNIEnv(jniEnv);
+            v8ScriptStreamingTask->Run();
+            javaSourceStream->SetJNIEnv(nullptr);
+            // The input stream is no longer needed once the source is fully received.
+            javaSourceStream->Release(jniEnv);
+        }
+    }
+}
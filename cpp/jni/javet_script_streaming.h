@@ -0,0 +1,90 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#pragma once
+
+#include <jni.h>
+#include <memory>
+#include <string>
+#include "javet_compile_hints.h"
+#include "javet_v8.h"
+
+namespace Javet {
+    namespace ScriptStreaming {
+        void Initialize(JNIEnv* jniEnv) noexcept;
+
+        /*
+         * The Java source stream pulls UTF-8 chunks from a Java input stream.
+         * It is only called within Run() on the thread that runs the streaming task,
+         * so the JNI environment of that thread is set for the duration of Run().
+         * The received bytes are kept because the full source string is required to finish the compilation.
+         */
+        class JavaSourceStream final : public v8::ScriptCompiler::ExternalSourceStream {
+        public:
+            JavaSourceStream(JNIEnv* jniEnv, const jobject mInputStream, const jint bufferSize) noexcept;
+
+            size_t GetMoreData(const uint8_t** src) override;
+
+            inline const std::string& GetSource() const noexcept {
+                return source;
+            }
+
+            void Release(JNIEnv* jniEnv) noexcept;
+
+            inline void SetJNIEnv(JNIEnv* jniEnv) noexcept {
+                this->jniEnv = jniEnv;
+            }
+
+        private:
+            jbyteArray mBuffer;
+            jobject mInputStream;
+            JNIEnv* jniEnv;
+            std::string source;
+        };
+
+        /*
+         * The script streaming is created under the V8 isolate lock,
+         * runs the parsing without the lock on a background thread,
+         * and is finished under the lock again.
+         */
+        class ScriptStreaming final {
+        public:
+            ScriptStreaming(
+                JNIEnv* jniEnv,
+                V8Isolate* v8Isolate,
+                const jobject mInputStream,
+                const jint bufferSize,
+                const jint mCompileOptions,
+                const jintArray mCompileHints) noexcept;
+
+            V8MaybeLocalScript Finish(
+                const V8LocalContext& v8Context,
+                const v8::ScriptOrigin& scriptOrigin) noexcept;
+
+            void Release(JNIEnv* jniEnv) noexcept;
+
+            void Run(JNIEnv* jniEnv) noexcept;
+
+        private:
+            // The compile hints are consulted by the background parsing, so they live as long as the streaming.
+            Javet::CompileHints::CompileHints compileHints;
+            JavaSourceStream* javaSourceStream;
+            std::unique_ptr<V8StreamedSource> v8StreamedSource;
+            std::unique_ptr<V8ScriptStreamingTask> v8ScriptStreamingTask;
+        };
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include <functional>
+#include <string_view>
+#include "javet_constants.h"
+#include "javet_unbound_script_cache.h"
+
+namespace Javet {
+    namespace UnboundScriptCache {
+        static jclass jclassV8UnboundScriptCacheStatistics;
+        static jmethodID jmethodIDV8UnboundScriptCacheStatisticsConstructor;
+
+        void Initialize(JNIEnv* jniEnv) noexcept {
+            jclassV8UnboundScriptCacheStatistics = FIND_CLASS(jniEnv, "com/caoccao/javet/interop/monitoring/V8UnboundScriptCacheStatistics");
+            jmethodIDV8UnboundScriptCacheStatisticsConstructor = jniEnv->GetMethodID(jclassV8UnboundScriptCacheStatistics, "<init>", "(JJJJJ)V");
+        }
+
+        UnboundScriptCache::UnboundScriptCache(const size_t capacity) noexcept
+            : capacity(capacity), evictionCount(0), hitCount(0), missCount(0), size(0) {
+        }
+
+        void UnboundScriptCache::Clear() noexcept {
+            for (auto& entry : entries) {
+                entry.v8GlobalResourceName.Reset();
+                entry.v8GlobalSource.Reset();
+                entry.v8GlobalUnboundScript.Reset();
+            }
+            entries.clear();
+            index.clear();
+            size = 0;
+        }
+
+        V8MaybeLocalScript UnboundScriptCache::Find(
+            const V8LocalContext& v8Context,
+            const V8LocalString& v8LocalSource,
+            const v8::ScriptOrigin& scriptOrigin) noexcept {
+            auto v8Isolate = v8Context->GetIsolate();
+            const size_t hash = Hash(v8Isolate, v8LocalSource, scriptOrigin);
+            auto range = index.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                auto& entry = *it->second;
+                // The hash only narrows down the candidates. The source and the origin must match exactly.
+                if (entry.lineOffset == scriptOrigin.LineOffset()
+                    && entry.columnOffset == scriptOrigin.ColumnOffset()
+                    && entry.v8GlobalResourceName.Get(v8Isolate)->StrictEquals(scriptOrigin.ResourceName())
+                    && entry.v8GlobalSource.Get(v8Isolate)->StringEquals(v8LocalSource)) {
+                    ++hitCount;
+                    entries.splice(entries.begin(), entries, it->second);
+                    return entry.v8GlobalUnboundScript.Get(v8Isolate)->BindToCurrentContext();
+                }
+            }
+            ++missCount;
+            return V8MaybeLocalScript();
+        }
+
+        jobject UnboundScriptCache::GetStatistics(JNIEnv* jniEnv) const noexcept {
+            return jniEnv->NewObject(
+                jclassV8UnboundScriptCacheStatistics,
+                jmethodIDV8UnboundScriptCacheStatisticsConstructor,
+                static_cast<jlong>(capacity.load()),
+                static_cast<jlong>(evictionCount.load()),
+                static_cast<jlong>(hitCount.load()),
+                static_cast<jlong>(missCount.load()),
+                static_cast<jlong>(size.load()));
+        }
+
+        size_t UnboundScriptCache::Hash(
+            V8Isolate* v8Isolate,
+            const V8LocalString& v8LocalSource,
+            const v8::ScriptOrigin& scriptOrigin) noexcept {
+            size_t hash;
+            {
+                // The value view reads the flat source in place without copying it.
+                v8::String::ValueView valueView(v8Isolate, v8LocalSource);
+                hash = valueView.is_one_byte()
+                    ? std::hash<std::string_view>{}(std::string_view(
+                        reinterpret_cast<const char*>(valueView.data8()), valueView.length()))
+                    : std::hash<std::string_view>{}(std::string_view(
+                        reinterpret_cast<const char*>(valueView.data16()), valueView.length() * sizeof(uint16_t)));
+            }
+            hash ^= std::hash<int>{}(scriptOrigin.LineOffset()) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<int>{}(scriptOrigin.ColumnOffset()) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+
+        void UnboundScriptCache::Put(
+            V8Isolate* v8Isolate,
+            const V8LocalString& v8LocalSource,
+            const v8::ScriptOrigin& scriptOrigin,
+            const V8LocalScript& v8LocalScript) noexcept {
+            if (entries.size() >= capacity) {
+                auto& evictedEntry = entries.back();
+                auto range = index.equal_range(evictedEntry.hash);
+                for (auto it = range.first; it != range.second; ++it) {
+                    if (&*it->second == &evictedEntry) {
+                        index.erase(it);
+                        break;
+                    }
+                }
+                evictedEntry.v8GlobalResourceName.Reset();
+                evictedEntry.v8GlobalSource.Reset();
+                evictedEntry.v8GlobalUnboundScript.Reset();
+                entries.pop_back();
+                ++evictionCount;
+            }
+            entries.emplace_front();
+            auto& entry = entries.front();
+            entry.columnOffset = scriptOrigin.ColumnOffset();
+            entry.hash = Hash(v8Isolate, v8LocalSource, scriptOrigin);
+            entry.lineOffset = scriptOrigin.LineOffset();
+            entry.v8GlobalResourceName.Reset(v8Isolate, scriptOrigin.ResourceName());
+            entry.v8GlobalSource.Reset(v8Isolate, v8LocalSource);
+            entry.v8GlobalUnboundScript.Reset(v8Isolate, v8LocalScript->GetUnboundScript());
+            index.emplace(entry.hash, entries.begin());
+            size = entries.size();
+        }
+
+        void UnboundScriptCache::Reset(const size_t capacity) noexcept {
+            Clear();
+            this->capacity = capacity;
+            evictionCount = 0;
+            hitCount = 0;
+            missCount = 0;
+        }
+
+        UnboundScriptCache::~UnboundScriptCache() {
+            Clear();
+        }
+    }
+}
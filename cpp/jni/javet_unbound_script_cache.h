@@ -0,0 +1,91 @@
+/*
+ *   Copyright (c) 2026. caoccao.com Sam Cao
+ *   All rights reserved.
+
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+
+ *   http://www.apache.org/licenses/LICENSE-2.0
+
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#pragma once
+
+#include <jni.h>
+#include <atomic>
+#include <list>
+#include <unordered_map>
+#include "javet_v8.h"
+
+namespace Javet {
+    namespace UnboundScriptCache {
+        void Initialize(JNIEnv* jniEnv) noexcept;
+
+        /*
+         * The unbound script cache is created per V8 isolate and survives the context resets.
+         * It maps the source and the origin of a script to the context independent unbound script,
+         * so that a script compiled once is bound to every new context without being compiled again.
+         * The least recently used script is evicted when the capacity is reached.
+         * It must be called with the V8 isolate locked, except for the statistics.
+         */
+        class UnboundScriptCache final {
+        public:
+            UnboundScriptCache(const size_t capacity) noexcept;
+
+            void Clear() noexcept;
+
+            V8MaybeLocalScript Find(
+                const V8LocalContext& v8Context,
+                const V8LocalString& v8LocalSource,
+                const v8::ScriptOrigin& scriptOrigin) noexcept;
+            jobject GetStatistics(JNIEnv* jniEnv) const noexcept;
+
+            inline bool IsEnabled() const noexcept {
+                return capacity > 0;
+            }
+
+            void Put(
+                V8Isolate* v8Isolate,
+                const V8LocalString& v8LocalSource,
+                const v8::ScriptOrigin& scriptOrigin,
+                const V8LocalScript& v8LocalScript) noexcept;
+
+            /*
+             * Drop the scripts and the counters, and apply the capacity of the new V8 isolate.
+             * The object itself is never replaced because its statistics are read without the lock.
+             */
+            void Reset(const size_t capacity) noexcept;
+
+            ~UnboundScriptCache();
+
+        private:
+            struct Entry {
+                int columnOffset;
+                size_t hash;
+                int lineOffset;
+                V8GlobalValue v8GlobalResourceName;
+                V8GlobalString v8GlobalSource;
+                V8GlobalUnboundScript v8GlobalUnboundScript;
+            };
+
+            std::atomic<size_t> capacity;
+            std::list<Entry> entries;
+            std::atomic<size_t> evictionCount;
+            std::atomic<size_t> hitCount;
+            std::unordered_multimap<size_t, std::list<Entry>::iterator> index;
+            std::atomic<size_t> missCount;
+            std::atomic<size_t> size;
+
+            static size_t Hash(
+                V8Isolate* v8Isolate,
+                const V8LocalString& v8LocalSource,
+                const v8::ScriptOrigin& scriptOrigin) noexcept;
+        };
+    }
+}
@@ -21,6 +21,7 @@
 #pragma warning(disable: 4244)
 #include <libplatform/libplatform.h>
 #include <v8.h>
+#include <v8-fast-api-calls.h>
 #include <v8-inspector.h>
 #pragma warning(default: 4018)
 #pragma warning(default: 4244)
@@ -51,6 +52,7 @@ using V8LocalBoolean = v8::Local<v8::Boolean>;
 using V8LocalBooleanObject = v8::Local<v8::BooleanObject>;
 using V8LocalContext = v8::Local<v8::Context>;
 using V8LocalData = v8::Local<v8::Data>;
+using V8LocalExternal = v8::Local<v8::External>;
 using V8LocalFixedArray = v8::Local<v8::FixedArray>;
 using V8LocalFunction = v8::Local<v8::Function>;
 using V8LocalInteger = v8::Local<v8::Integer>;
@@ -62,6 +64,7 @@ using V8LocalNumberObject = v8::Local<v8::NumberObject>;
 using V8LocalObject = v8::Local<v8::Object>;
 using V8LocalPrimitive = v8::Local<v8::Primitive>;
 using V8LocalPrimitiveArray = v8::Local<v8::PrimitiveArray>;
+using V8LocalPrivate = v8::Local<v8::Private>;
 using V8LocalPromise = v8::Local<v8::Promise>;
 using V8LocalProxy = v8::Local<v8::Proxy>;
 using V8LocalRegExp = v8::Local<v8::RegExp>;
@@ -84,6 +87,7 @@ using V8MaybeLocalModule = v8::MaybeLocal<v8::Module>;
 using V8MaybeLocalPromise = v8::MaybeLocal<v8::Promise>;
 using V8MaybeLocalPromiseResolver = v8::MaybeLocal<v8::Promise::Resolver>;
 using V8MaybeLocalProxy = v8::MaybeLocal<v8::Proxy>;
+using V8MaybeLocalScript = v8::MaybeLocal<v8::Script>;
 using V8MaybeLocalString = v8::MaybeLocal<v8::String>;
 using V8MaybeLocalValue = v8::MaybeLocal<v8::Value>;
 
@@ -91,13 +95,17 @@ using V8MaybeLocalValue = v8::MaybeLocal<v8::Value>;
 
 using V8GlobalContext = v8::Global<v8::Context>;
 using V8GlobalObject = v8::Global<v8::Object>;
+using V8GlobalPrivate = v8::Global<v8::Private>;
+using V8GlobalString = v8::Global<v8::String>;
+using V8GlobalUnboundScript = v8::Global<v8::UnboundScript>;
+using V8GlobalValue = v8::Global<v8::Value>;
 
 // Persistent
 
 using V8PersistentArray = v8::Persistent<v8::Array>;
-using V8PersistentBigInt = v8::Persistent<v8::BigInt>;
 using V8PersistentContext = v8::Persistent<v8::Context>;
 using V8PersistentData = v8::Persistent<v8::Data>;
+using V8PersistentExternal = v8::Persistent<v8::External>;
 using V8PersistentFunction = v8::Persistent<v8::Function>;
 using V8PersistentMap = v8::Persistent<v8::Map>;
 using V8PersistentModule = v8::Persistent<v8::Module>;
@@ -116,7 +124,10 @@ using V8Isolate = v8::Isolate;
 using V8Platform = v8::Platform;
 using V8ScriptCompilerCachedData = v8::ScriptCompiler::CachedData;
 using V8ScriptCompilerCachedDataBufferPolicy = v8::ScriptCompiler::CachedData::BufferPolicy;
+using V8ScriptCompilerCompileOptions = v8::ScriptCompiler::CompileOptions;
 using V8ScriptCompilerSource = v8::ScriptCompiler::Source;
+using V8ScriptStreamingTask = v8::ScriptCompiler::ScriptStreamingTask;
+using V8StreamedSource = v8::ScriptCompiler::StreamedSource;
 using V8StringUtf8Value = v8::String::Utf8Value;
 using V8StringValue = v8::String::Value;
 using V8TryCatch = v8::TryCatch;
@@ -40,6 +40,7 @@
 #include <src/objects/string-set-inl.h>
 #include <src/objects/source-text-module-inl.h>
 #include <src/objects/synthetic-module-inl.h>
+#include <src/objects/templates-inl.h>
 #include <src/strings/string-builder-inl.h>
 #include <src/handles/handles-inl.h>
 #include <src/flags/flags.h>
@@ -79,6 +80,7 @@ using V8InternalString = v8::internal::String;
 using V8InternalStringSet = v8::internal::StringSet;
 using V8InternalSourceTextModule = v8::internal::SourceTextModule;
 using V8InternalSyntheticModule = v8::internal::SyntheticModule;
+using V8InternalTemplateInfo = v8::internal::TemplateInfo;
 using V8InternalWriteBarrierMode = v8::internal::WriteBarrierMode;
 
 template<typename T>
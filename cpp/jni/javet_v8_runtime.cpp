@@ -27,13 +27,17 @@
 namespace Javet {
     jclass jclassRuntimeOptions;
     jmethodID jmethodRuntimeOptionsIsCreateSnapshotEnabled;
+    jmethodID jmethodRuntimeOptionsGetPropertyKeyCacheSize;
     jmethodID jmethodRuntimeOptionsGetSnapshotBlob;
+    jmethodID jmethodRuntimeOptionsGetUnboundScriptCacheSize;
 #ifdef ENABLE_NODE
     jmethodID jmethodNodeRuntimeOptionsGetConsoleArguments;
     std::mutex mutexForNodeResetEnvrironment;
     auto oneMillisecond = std::chrono::milliseconds(1);
 #else
+    jmethodID jmethodV8RuntimeOptionsGetArrayBufferPoolSize;
     jmethodID jmethodV8RuntimeOptionsGetGlobalName;
+    jmethodID jmethodV8RuntimeOptionsGetMaxArrayBufferSize;
 #endif
 
     void Initialize(JNIEnv* jniEnv) noexcept {
@@ -42,10 +46,14 @@ namespace Javet {
         jmethodNodeRuntimeOptionsGetConsoleArguments = jniEnv->GetMethodID(jclassRuntimeOptions, "getConsoleArguments", "()[Ljava/lang/String;");
 #else
         jclassRuntimeOptions = FIND_CLASS(jniEnv, "com/caoccao/javet/interop/options/V8RuntimeOptions");
+        jmethodV8RuntimeOptionsGetArrayBufferPoolSize = jniEnv->GetMethodID(jclassRuntimeOptions, "getArrayBufferPoolSize", "()J");
         jmethodV8RuntimeOptionsGetGlobalName = jniEnv->GetMethodID(jclassRuntimeOptions, "getGlobalName", "()Ljava/lang/String;");
+        jmethodV8RuntimeOptionsGetMaxArrayBufferSize = jniEnv->GetMethodID(jclassRuntimeOptions, "getMaxArrayBufferSize", "()J");
 #endif
         jmethodRuntimeOptionsIsCreateSnapshotEnabled = jniEnv->GetMethodID(jclassRuntimeOptions, "isCreateSnapshotEnabled", "()Z");
+        jmethodRuntimeOptionsGetPropertyKeyCacheSize = jniEnv->GetMethodID(jclassRuntimeOptions, "getPropertyKeyCacheSize", "()I");
         jmethodRuntimeOptionsGetSnapshotBlob = jniEnv->GetMethodID(jclassRuntimeOptions, "getSnapshotBlob", "()[B");
+        jmethodRuntimeOptionsGetUnboundScriptCacheSize = jniEnv->GetMethodID(jclassRuntimeOptions, "getUnboundScriptCacheSize", "()I");
         // Set V8 flags
         bool isFrozen = V8InternalFlagList::IsFrozen(); // Since V8 v10.5
         if (!isFrozen) {
@@ -77,20 +85,19 @@ namespace Javet {
         std::shared_ptr<node::ArrayBufferAllocator> nodeArrayBufferAllocator) noexcept
         : nodeEnvironment(nullptr, node::FreeEnvironment), nodeIsolateData(nullptr, node::FreeIsolateData), nodeStopping(false), uvLoop(),
 #else
-    V8Runtime::V8Runtime(
-        V8Platform* v8PlatformPointer,
-        std::shared_ptr<V8ArrayBufferAllocator> v8ArrayBufferAllocator) noexcept
+    V8Runtime::V8Runtime(V8Platform* v8PlatformPointer) noexcept
         :
 #endif
         v8SnapshotCreator(nullptr), v8StartupData(nullptr, [](v8::StartupData* x) { if (x->raw_size > 0) { delete[] x->data; } }), v8Locker(nullptr) {
 #ifdef ENABLE_NODE
         this->nodeArrayBufferAllocator = nodeArrayBufferAllocator;
-#else
-        this->v8ArrayBufferAllocator = v8ArrayBufferAllocator;
 #endif
         externalV8Runtime = nullptr;
         externalException = nullptr;
         v8Isolate = nullptr;
+        v8PersistentReferenceTable.reset(new V8PersistentReferenceTable());
+        v8PropertyKeyCache.reset(new Javet::PropertyKeyCache::PropertyKeyCache(0));
+        v8UnboundScriptCache.reset(new Javet::UnboundScriptCache::UnboundScriptCache(0));
         this->v8PlatformPointer = v8PlatformPointer;
     }
 
@@ -155,6 +162,8 @@ namespace Javet {
             auto v8LocalContext = GetV8LocalContext();
             Unregister(v8LocalContext);
             v8GlobalObject.Reset();
+            // The cached keys are dropped on every context reset.
+            v8PropertyKeyCache->Clear();
         }
 #ifdef ENABLE_NODE
         int errorCode = 0;
@@ -193,6 +202,20 @@ namespace Javet {
             auto internalV8Locker = GetSharedV8Locker();
             v8Inspector.reset();
         }
+        if (v8Isolate != nullptr && v8PersistentReferenceTable->GetSize() > 0) {
+            // The persistent references leaked by the application are released in bulk.
+            auto internalV8Locker = GetSharedV8Locker();
+            v8PersistentReferenceTable->ReleaseAll();
+        }
+        if (v8Isolate != nullptr && v8PropertyKeyCache->IsEnabled()) {
+            auto internalV8Locker = GetSharedV8Locker();
+            v8PropertyKeyCache->Clear();
+        }
+        if (v8Isolate != nullptr && v8UnboundScriptCache->IsEnabled()) {
+            // The unbound scripts survive the context resets, but not the isolate.
+            auto internalV8Locker = GetSharedV8Locker();
+            v8UnboundScriptCache->Clear();
+        }
         v8GlobalObject.Reset();
         v8GlobalContext.Reset();
         v8Locker.reset();
@@ -331,10 +354,14 @@ namespace Javet {
 
     void V8Runtime::CreateV8Isolate(JNIEnv* jniEnv, const jobject mRuntimeOptions) noexcept {
         bool createSnapshotEnabled = false;
+        jint propertyKeyCacheSize = 0;
         jbyteArray snapshotBlob = nullptr;
+        jint unboundScriptCacheSize = 0;
         if (mRuntimeOptions != nullptr) {
             createSnapshotEnabled = jniEnv->CallBooleanMethod(mRuntimeOptions, jmethodRuntimeOptionsIsCreateSnapshotEnabled);
+            propertyKeyCacheSize = jniEnv->CallIntMethod(mRuntimeOptions, jmethodRuntimeOptionsGetPropertyKeyCacheSize);
             snapshotBlob = (jbyteArray)jniEnv->CallObjectMethod(mRuntimeOptions, jmethodRuntimeOptionsGetSnapshotBlob);
+            unboundScriptCacheSize = jniEnv->CallIntMethod(mRuntimeOptions, jmethodRuntimeOptionsGetUnboundScriptCacheSize);
             if (snapshotBlob) {
                 jsize snapshotBlobSize = jniEnv->GetArrayLength(snapshotBlob);
                 jboolean isCopy;
@@ -346,6 +373,10 @@ namespace Javet {
                 jniEnv->ReleaseByteArrayElements(snapshotBlob, snapshotBlobElements, JNI_ABORT);
             }
         }
+        v8PropertyKeyCache->Reset(
+            static_cast<size_t>(propertyKeyCacheSize > 0 ? propertyKeyCacheSize : 0));
+        v8UnboundScriptCache->Reset(
+            static_cast<size_t>(unboundScriptCacheSize > 0 ? unboundScriptCacheSize : 0));
 #ifdef ENABLE_NODE
         int errorCode = uv_loop_init(&uvLoop);
         if (errorCode != 0) {
@@ -379,8 +410,17 @@ namespace Javet {
             v8SnapshotCreator.reset(new v8::SnapshotCreator(v8Isolate, nullptr, v8StartupData.get(), true));
         }
         else {
+            jlong arrayBufferPoolSize = 0;
+            jlong maxArrayBufferSize = 0;
+            if (mRuntimeOptions != nullptr) {
+                arrayBufferPoolSize = jniEnv->CallLongMethod(mRuntimeOptions, jmethodV8RuntimeOptionsGetArrayBufferPoolSize);
+                maxArrayBufferSize = jniEnv->CallLongMethod(mRuntimeOptions, jmethodV8RuntimeOptionsGetMaxArrayBufferSize);
+            }
+            v8ArrayBufferAllocator = std::make_shared<Javet::ArrayBufferAllocator::JavetArrayBufferAllocator>(
+                static_cast<size_t>(maxArrayBufferSize > 0 ? maxArrayBufferSize : 0),
+                static_cast<size_t>(arrayBufferPoolSize > 0 ? arrayBufferPoolSize : 0));
             v8::Isolate::CreateParams createParams;
-            createParams.array_buffer_allocator = v8ArrayBufferAllocator.get();
+            createParams.array_buffer_allocator_shared = v8ArrayBufferAllocator;
             createParams.oom_error_callback = Javet::Callback::OOMErrorCallback;
             createParams.snapshot_blob = v8StartupData.get();
             v8Isolate = v8::Isolate::New(createParams);
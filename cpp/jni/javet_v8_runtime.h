@@ -18,9 +18,13 @@
 #pragma once
 
 #include <mutex>
+#include "javet_array_buffer_allocator.h"
 #include "javet_enums.h"
 #include "javet_logging.h"
 #include "javet_native.h"
+#include "javet_property_key_cache.h"
+#include "javet_reference_table.h"
+#include "javet_unbound_script_cache.h"
 
 namespace Javet {
     class V8Runtime;
@@ -44,15 +48,16 @@ namespace Javet {
         jthrowable externalException;
         V8GlobalObject v8GlobalObject;
         std::unique_ptr<Javet::Inspector::JavetInspector> v8Inspector;
+        std::unique_ptr<V8PersistentReferenceTable> v8PersistentReferenceTable;
+        std::unique_ptr<Javet::PropertyKeyCache::PropertyKeyCache> v8PropertyKeyCache;
+        std::unique_ptr<Javet::UnboundScriptCache::UnboundScriptCache> v8UnboundScriptCache;
 
 #ifdef ENABLE_NODE
         V8Runtime(
             node::MultiIsolatePlatform* v8PlatformPointer,
             std::shared_ptr<node::ArrayBufferAllocator> nodeArrayBufferAllocator) noexcept;
 #else
-        V8Runtime(
-            V8Platform* v8PlatformPointer,
-            std::shared_ptr<V8ArrayBufferAllocator> v8ArrayBufferAllocator) noexcept;
+        V8Runtime(V8Platform* v8PlatformPointer) noexcept;
 #endif
 
         bool Await(const Javet::Enums::V8AwaitMode::V8AwaitMode awaitMode) noexcept;
@@ -111,6 +116,22 @@ namespace Javet {
             return std::make_unique<v8::Locker>(v8Isolate);
         }
 
+        inline jobject GetV8ArrayBufferStatistics(JNIEnv* jniEnv) const noexcept {
+#ifdef ENABLE_NODE
+            return nullptr;
+#else
+            return v8ArrayBufferAllocator ? v8ArrayBufferAllocator->GetStatistics(jniEnv) : nullptr;
+#endif
+        }
+
+        inline jobject GetV8PropertyKeyCacheStatistics(JNIEnv* jniEnv) const noexcept {
+            return v8PropertyKeyCache->GetStatistics(jniEnv);
+        }
+
+        inline jobject GetV8UnboundScriptCacheStatistics(JNIEnv* jniEnv) const noexcept {
+            return v8UnboundScriptCache->GetStatistics(jniEnv);
+        }
+
         inline auto GetV8ContextScope(const V8LocalContext& v8LocalContext) const noexcept {
             return std::make_unique<V8ContextScope>(v8LocalContext);
         }
@@ -186,7 +207,8 @@ namespace Javet {
         std::atomic_bool nodeStopping;
         uv_loop_t uvLoop;
 #else
-        std::shared_ptr<V8ArrayBufferAllocator> v8ArrayBufferAllocator;
+        // The allocator is shared with V8 so that backing stores outliving the isolate can still be freed.
+        std::shared_ptr<Javet::ArrayBufferAllocator::JavetArrayBufferAllocator> v8ArrayBufferAllocator;
 #endif
         std::unique_ptr<v8::SnapshotCreator> v8SnapshotCreator;
         std::unique_ptr<v8::StartupData, std::function<void(v8::StartupData*)>> v8StartupData;
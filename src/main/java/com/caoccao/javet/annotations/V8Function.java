@@ -29,6 +29,18 @@ import java.lang.annotation.*;
 @Target(ElementType.METHOD)
 @Retention(RetentionPolicy.RUNTIME)
 public @interface V8Function {
+    /**
+     * Fast call is registered as a V8 fast API call so that TurboFan optimized code
+     * can call the function without leaving compiled code.
+     * <p>
+     * It only takes effect on side-effect-free functions with up to 3 int, double or boolean parameters
+     * and a void, int, double or boolean result. The function must not call back into V8.
+     *
+     * @return true: fast call is enabled, false: fast call is disabled
+     * @since 5.0.4
+     */
+    boolean fastCall() default false;
+
     /**
      * JS function name.
      *
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.enums;
+
+/**
+ * The enum Javet conversion mode determines how object graphs are converted
+ * between V8 and Java.
+ *
+ * @since 5.0.4
+ */
+public enum JavetConversionMode {
+    /**
+     * Recursive mode walks the object graph value by value
+     * with one native call per value.
+     *
+     * @since 5.0.4
+     */
+    Recursive,
+    /**
+     * Serialized mode transfers the whole object graph in the V8 value serializer wire format
+     * through a direct byte buffer with one native call per conversion.
+     * It falls back to the recursive mode if the object graph cannot be serialized.
+     *
+     * @since 5.0.4
+     */
+    Serialized,
+}
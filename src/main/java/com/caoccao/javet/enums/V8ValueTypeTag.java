@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.enums;
+
+import java.util.stream.Stream;
+
+/**
+ * The enum V8 value type tag is the stable type id of a V8 value class.
+ * <p>
+ * It is read by the native converter in one field access so that
+ * the V8 value class doesn't need to be resolved via a cascade of instanceof checks.
+ * The ids must be kept in sync with the native enum.
+ *
+ * @since 5.0.4
+ */
+public enum V8ValueTypeTag {
+    Unknown(0, "Unknown"),
+    Undefined(1, "Undefined"),
+    Null(2, "Null"),
+    Boolean(3, "Boolean"),
+    Integer(4, "Integer"),
+    Long(5, "Long"),
+    Double(6, "Double"),
+    String(7, "String"),
+    BigInteger(8, "BigInteger"),
+    ZonedDateTime(9, "ZonedDateTime"),
+    Reference(10, "Reference"),
+    Object(11, "Object"),
+    Array(12, "Array"),
+    GlobalObject(13, "GlobalObject"),
+    Map(14, "Map"),
+    Promise(15, "Promise"),
+    Proxy(16, "Proxy"),
+    RegExp(17, "RegExp"),
+    Set(18, "Set"),
+    Symbol(19, "Symbol"),
+    SymbolObject(20, "SymbolObject");
+
+    private static final int LENGTH = values().length;
+    private static final V8ValueTypeTag[] TYPES = new V8ValueTypeTag[LENGTH];
+
+    static {
+        Stream.of(values()).forEach(v -> TYPES[v.getId()] = v);
+    }
+
+    private final int id;
+    private final String name;
+
+    V8ValueTypeTag(int id, String name) {
+        this.id = id;
+        this.name = name;
+    }
+
+    /**
+     * Parse V8 value type tag.
+     *
+     * @param id the id
+     * @return the V8 value type tag
+     * @since 5.0.4
+     */
+    public static V8ValueTypeTag parse(int id) {
+        return id >= 0 && id < LENGTH ? TYPES[id] : Unknown;
+    }
+
+    /**
+     * Gets id.
+     *
+     * @return the id
+     * @since 5.0.4
+     */
+    public int getId() {
+        return id;
+    }
+
+    /**
+     * Gets name.
+     *
+     * @return the name
+     * @since 5.0.4
+     */
+    public String getName() {
+        return name;
+    }
+}
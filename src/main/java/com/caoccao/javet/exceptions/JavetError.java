@@ -429,6 +429,34 @@ public class JavetError {
             "${callbackContextCount} callback context(s), " +
             "${referenceCount} reference(s), " +
             "${v8ModuleCount} module(s)");
+    /**
+     * The constant RuntimeExternalSourceInvalid.
+     *
+     * @since 5.0.4
+     */
+    public static final JavetError RuntimeExternalSourceInvalid = new JavetError(
+            809, JavetErrorType.Runtime, "External source is closed or belongs to another host");
+    /**
+     * The constant RuntimeBackingStoreInvalid.
+     *
+     * @since 5.0.4
+     */
+    public static final JavetError RuntimeBackingStoreInvalid = new JavetError(
+            810, JavetErrorType.Runtime, "Backing store is closed or belongs to another host");
+    /**
+     * The constant RuntimeByteBufferInvalid.
+     *
+     * @since 5.0.4
+     */
+    public static final JavetError RuntimeByteBufferInvalid = new JavetError(
+            811, JavetErrorType.Runtime, "Byte buffer is not direct or its range is invalid");
+    /**
+     * The constant RuntimeSerializedDataInvalid.
+     *
+     * @since 5.0.4
+     */
+    public static final JavetError RuntimeSerializedDataInvalid = new JavetError(
+            812, JavetErrorType.Runtime, "Serialized data is invalid or truncated");
     /**
      * The constant EngineNotAvailable.
      *
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop;
+
+import com.caoccao.javet.interfaces.IJavetClosable;
+
+import java.util.Objects;
+
+/**
+ * The type Base V8 host resource.
+ * <p>
+ * It is native memory created by a {@link V8Host} that any number of V8 runtimes of that V8 host
+ * can use without copying. Its native handle is only meaningful to the native library of that V8 host,
+ * so the V8 runtimes of other V8 hosts reject it.
+ * <p>
+ * The native memory is reference counted. Closing the resource only drops the reference held by Java,
+ * and the memory stays alive as long as V8 still uses it. A V8 runtime acquires the resource
+ * for the duration of a native call, so a close in another thread is deferred until that call completes.
+ *
+ * @since 5.0.4
+ */
+public abstract class BaseV8HostResource implements IJavetClosable {
+    /**
+     * The constant INVALID_HANDLE.
+     *
+     * @since 5.0.4
+     */
+    protected static final long INVALID_HANDLE = 0L;
+    /**
+     * The V8 host.
+     *
+     * @since 5.0.4
+     */
+    protected final V8Host v8Host;
+    private volatile boolean closed;
+    private volatile long handle;
+    private int useCount;
+
+    /**
+     * Instantiates a new Base V8 host resource.
+     *
+     * @param v8Host the V8 host
+     * @since 5.0.4
+     */
+    protected BaseV8HostResource(V8Host v8Host) {
+        this.v8Host = Objects.requireNonNull(v8Host);
+        closed = false;
+        handle = INVALID_HANDLE;
+        useCount = 0;
+    }
+
+    /**
+     * Acquire the native handle so that it is not released by a concurrent close
+     * until {@link #release()} is called.
+     *
+     * @return true : acquired, false : closed
+     * @since 5.0.4
+     */
+    synchronized boolean acquire() {
+        if (closed) {
+            return false;
+        }
+        ++useCount;
+        return true;
+    }
+
+    @Override
+    public final synchronized void close() {
+        if (!closed) {
+            closed = true;
+            if (useCount == 0) {
+                releaseHandle();
+            }
+        }
+    }
+
+    /**
+     * Gets handle.
+     *
+     * @return the handle
+     * @since 5.0.4
+     */
+    public long getHandle() {
+        return handle;
+    }
+
+    /**
+     * Gets V8 host.
+     *
+     * @return the V8 host
+     * @since 5.0.4
+     */
+    public V8Host getV8Host() {
+        return v8Host;
+    }
+
+    @Override
+    public boolean isClosed() {
+        return closed;
+    }
+
+    /**
+     * Release the native handle acquired by {@link #acquire()}.
+     *
+     * @since 5.0.4
+     */
+    synchronized void release() {
+        if (useCount > 0 && --useCount == 0 && closed) {
+            releaseHandle();
+        }
+    }
+
+    private void releaseHandle() {
+        if (handle != INVALID_HANDLE) {
+            releaseNativeHandle(handle);
+            handle = INVALID_HANDLE;
+        }
+    }
+
+    /**
+     * Release native handle.
+     *
+     * @param handle the handle
+     * @since 5.0.4
+     */
+    protected abstract void releaseNativeHandle(long handle);
+
+    /**
+     * Sets the native handle created by the subclass.
+     *
+     * @param handle the handle
+     * @since 5.0.4
+     */
+    protected void setHandle(long handle) {
+        this.handle = handle;
+    }
+}
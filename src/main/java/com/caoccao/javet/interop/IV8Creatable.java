@@ -57,6 +57,70 @@ public interface IV8Creatable {
     @CheckReturnValue
     V8ValueArray createV8ValueArray() throws JavetException;
 
+    /**
+     * Create V8 value array from booleans.
+     * The array is created natively in one call with its elements being booleans.
+     *
+     * @param booleans the booleans
+     * @return the V8 value array
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    V8ValueArray createV8ValueArray(boolean[] booleans) throws JavetException;
+
+    /**
+     * Create V8 value array from doubles.
+     * The array is created natively in one call with its elements being numbers.
+     * It is a generic array with boxed numbers, so please use
+     * {@link #createV8ValueTypedArray(double[])} for numeric data.
+     *
+     * @param doubles the doubles
+     * @return the V8 value array
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    V8ValueArray createV8ValueArray(double[] doubles) throws JavetException;
+
+    /**
+     * Create V8 value array from integers.
+     * The array is created natively in one call with its elements being numbers.
+     * It is a generic array with boxed numbers, so please use
+     * {@link #createV8ValueTypedArray(int[])} for numeric data.
+     *
+     * @param integers the integers
+     * @return the V8 value array
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    V8ValueArray createV8ValueArray(int[] integers) throws JavetException;
+
+    /**
+     * Create V8 value array from longs.
+     * The array is created natively in one call with its elements being big integers.
+     *
+     * @param longs the longs
+     * @return the V8 value array
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    V8ValueArray createV8ValueArray(long[] longs) throws JavetException;
+
+    /**
+     * Create V8 value array from strings.
+     * The array is created natively in one call with its elements being strings, with null mapped to null.
+     *
+     * @param strings the strings
+     * @return the V8 value array
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    V8ValueArray createV8ValueArray(String[] strings) throws JavetException;
+
     /**
      * Create V8 value array buffer from a given length.
      *
@@ -352,6 +416,39 @@ public interface IV8Creatable {
     @CheckReturnValue
     V8ValueTypedArray createV8ValueTypedArray(V8ValueReferenceType type, int length) throws JavetException;
 
+    /**
+     * Create V8 value typed array of type Float64Array from doubles.
+     *
+     * @param doubles the doubles
+     * @return the V8 value typed array
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    V8ValueTypedArray createV8ValueTypedArray(double[] doubles) throws JavetException;
+
+    /**
+     * Create V8 value typed array of type Int32Array from integers.
+     *
+     * @param integers the integers
+     * @return the V8 value typed array
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    V8ValueTypedArray createV8ValueTypedArray(int[] integers) throws JavetException;
+
+    /**
+     * Create V8 value typed array of type BigInt64Array from longs.
+     *
+     * @param longs the longs
+     * @return the V8 value typed array
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    V8ValueTypedArray createV8ValueTypedArray(long[] longs) throws JavetException;
+
     /**
      * Create V8 value undefined.
      *
@@ -16,6 +16,7 @@
 
 package com.caoccao.javet.interop;
 
+import java.io.InputStream;
 import java.nio.ByteBuffer;
 
 /**
@@ -33,18 +34,80 @@ public interface IV8Native {
 
     Object arrayCreate(long v8RuntimeHandle);
 
+    Object arrayCreateFromBooleans(long v8RuntimeHandle, boolean[] values);
+
+    Object arrayCreateFromDoubles(long v8RuntimeHandle, double[] values);
+
+    Object arrayCreateFromIntegers(long v8RuntimeHandle, int[] values);
+
+    Object arrayCreateFromLongs(long v8RuntimeHandle, long[] values);
+
+    Object arrayCreateFromStrings(long v8RuntimeHandle, String[] values);
+
     int arrayGetLength(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
 
     boolean await(long v8RuntimeHandle, int v8AwaitMode);
 
+    Object backingStoreAttach(long v8RuntimeHandle, long backingStoreHandle);
+
+    long backingStoreCreate(ByteBuffer byteBuffer, int length, boolean shared);
+
+    ByteBuffer backingStoreGetByteBuffer(long backingStoreHandle);
+
+    void backingStoreRelease(long backingStoreHandle);
+
     int batchArrayGet(
             long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
             Object[] v8Values, int startIndex, int endIndex);
 
+    int batchArrayGetBooleans(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            boolean[] values, boolean[] validities, int startIndex, int endIndex);
+
+    int batchArrayGetDoubles(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            double[] values, boolean[] validities, int startIndex, int endIndex);
+
+    int batchArrayGetIntegers(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            int[] values, boolean[] validities, int startIndex, int endIndex);
+
+    int batchArrayGetLongs(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            long[] values, boolean[] validities, int startIndex, int endIndex);
+
+    int batchArrayGetStrings(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            String[] values, int startIndex, int endIndex);
+
     int batchObjectGet(
             long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
             Object[] v8ValueKeys, Object[] v8ValueValues, int length);
 
+    int batchObjectGetBooleans(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object[] v8ValueKeys, boolean[] values, boolean[] validities, int length);
+
+    int batchObjectGetDoubles(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object[] v8ValueKeys, double[] values, boolean[] validities, int length);
+
+    int batchObjectGetIntegers(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object[] v8ValueKeys, int[] values, boolean[] validities, int length);
+
+    int batchObjectGetLongs(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object[] v8ValueKeys, long[] values, boolean[] validities, int length);
+
+    int batchObjectGetStrings(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object[] v8ValueKeys, String[] values, int length);
+
+    int batchSetAdd(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object[] v8Values, int length);
+
     Object booleanObjectCreate(long v8RuntimeHandle, boolean booleanValue);
 
     Object booleanObjectValueOf(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
@@ -79,6 +142,10 @@ public interface IV8Native {
 
     Object errorCreate(long v8RuntimeHandle, int v8ValueErrorTypeId, String message);
 
+    long externalSourceCreate(ByteBuffer byteBuffer, boolean oneByte);
+
+    void externalSourceRelease(long externalSourceHandle);
+
     Object functionCall(
             long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
             Object receiver, boolean returnResult, Object[] values);
@@ -88,7 +155,7 @@ public interface IV8Native {
     boolean functionCanDiscardCompiled(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
 
     Object functionCompile(
-            long v8RuntimeHandle, String script, byte[] cachedData,
+            long v8RuntimeHandle, Object script, byte[] cachedData,
             String resourceName, int resourceLineOffset, int resourceColumnOffset,
             int scriptId, boolean wasm,
             String[] arguments, Object[] contextExtensions);
@@ -140,12 +207,18 @@ public interface IV8Native {
 
     int getPriority(long v8RuntimeHandle);
 
+    Object getV8ArrayBufferStatistics(long v8RuntimeHandle);
+
     Object getV8HeapSpaceStatistics(long v8RuntimeHandle, Object v8AllocationSpace);
 
     Object getV8HeapStatistics(long v8RuntimeHandle);
 
+    Object getV8PropertyKeyCacheStatistics(long v8RuntimeHandle);
+
     Object getV8SharedMemoryStatistics();
 
+    Object getV8UnboundScriptCacheStatistics(long v8RuntimeHandle);
+
     String getVersion();
 
     boolean hasException(long v8RuntimeHandle);
@@ -174,6 +247,14 @@ public interface IV8Native {
 
     boolean isWeak(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
 
+    Object jsonParse(long v8RuntimeHandle, ByteBuffer byteBuffer, int position, int length);
+
+    int jsonStringify(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, ByteBuffer byteBuffer, int position, int limit);
+
+    Object jsonStringifyGrowable(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, ByteBuffer byteBuffer, int position, int limit);
+
     boolean lockV8Runtime(long v8RuntimeHandle);
 
     Object longObjectCreate(long v8RuntimeHandle, long longValue);
@@ -206,7 +287,7 @@ public interface IV8Native {
 
     boolean mapHas(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object value);
 
-    boolean mapSet(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object[] keysAndValues);
+    int mapSet(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object[] keysAndValues);
 
     boolean mapSetBoolean(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object key, boolean value);
 
@@ -223,7 +304,7 @@ public interface IV8Native {
     boolean mapSetUndefined(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object key);
 
     Object moduleCompile(
-            long v8RuntimeHandle, String script, byte[] cachedData, boolean returnResult,
+            long v8RuntimeHandle, Object script, byte[] cachedData, boolean returnResult,
             String resourceName, int resourceLineOffset, int resourceColumnOffset,
             int scriptId, boolean isWASM, boolean isModule);
 
@@ -232,7 +313,7 @@ public interface IV8Native {
     Object moduleEvaluate(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, boolean resultRequired);
 
     Object moduleExecute(
-            long v8RuntimeHandle, String script, byte[] cachedData, boolean returnResult,
+            long v8RuntimeHandle, Object script, byte[] cachedData, boolean returnResult,
             String resourceName, int resourceLineOffset, int resourceColumnOffset,
             int scriptId, boolean isWASM);
 
@@ -300,7 +381,7 @@ public interface IV8Native {
 
     boolean objectIsSealed(long v8RuntimeHandle, long v8ValueHandle);
 
-    boolean objectSet(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object[] keysAndValues);
+    int objectSet(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object[] keysAndValues);
 
     boolean objectSetAccessor(
             long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
@@ -374,6 +455,8 @@ public interface IV8Native {
 
     void removeReferenceHandle(long v8RuntimeHandle, long referenceHandle, int referenceType);
 
+    void removeReferenceHandles(long v8RuntimeHandle, long[] referenceHandles, int length);
+
     boolean reportPendingMessages(long v8RuntimeHandle);
 
     void requestGarbageCollectionForTesting(long v8RuntimeHandle, boolean fullGC);
@@ -385,21 +468,37 @@ public interface IV8Native {
     boolean sameValue(long v8RuntimeHandle, long v8ValueHandle1, long v8ValueHandle2);
 
     Object scriptCompile(
-            long v8RuntimeHandle, String script, byte[] cachedData, boolean returnResult,
+            long v8RuntimeHandle, Object script, byte[] cachedData, boolean returnResult,
             String resourceName, int resourceLineOffset, int resourceColumnOffset,
-            int scriptId, boolean isWASM, boolean isModule);
+            int scriptId, boolean isWASM, boolean isModule,
+            int compileOptions, int[] compileHints);
 
     Object scriptExecute(
-            long v8RuntimeHandle, String script, byte[] cachedData, boolean returnResult,
+            long v8RuntimeHandle, Object script, byte[] cachedData, boolean returnResult,
             String resourceName, int resourceLineOffset, int resourceColumnOffset,
-            int scriptId, boolean isWASM);
+            int scriptId, boolean isWASM,
+            int compileOptions, int[] compileHints);
 
     byte[] scriptGetCachedData(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
 
+    int[] scriptGetCompileHints(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
+
     String scriptGetResourceName(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
 
     Object scriptRun(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, boolean resultRequired);
 
+    long scriptStreamingCreate(
+            long v8RuntimeHandle, InputStream inputStream, int bufferSize,
+            int compileOptions, int[] compileHints);
+
+    Object scriptStreamingFinish(
+            long v8RuntimeHandle, long scriptStreamingHandle,
+            String resourceName, int resourceLineOffset, int resourceColumnOffset, int scriptId);
+
+    void scriptStreamingRelease(long v8RuntimeHandle, long scriptStreamingHandle);
+
+    void scriptStreamingRun(long scriptStreamingHandle);
+
     void setAdd(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object value);
 
     Object setAsArray(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
@@ -446,6 +545,16 @@ public interface IV8Native {
 
     String toString(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
 
+    ByteBuffer typedArrayGetByteBuffer(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
+
+    boolean typedArrayGetRegion(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object array, int index, int arrayOffset, int length);
+
+    boolean typedArraySetRegion(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object array, int index, int arrayOffset, int length);
+
     boolean unlockV8Runtime(long v8RuntimeHandle);
 
     void unregisterGCEpilogueCallback(long v8RuntimeHandle);
@@ -455,4 +564,8 @@ public interface IV8Native {
     void unregisterNearHeapLimitCallback(long v8RuntimeHandle, long heapLimit);
 
     void v8InspectorSend(long v8RuntimeHandle, String message);
+
+    Object valueDeserialize(long v8RuntimeHandle, ByteBuffer byteBuffer, int length);
+
+    int valueSerialize(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, ByteBuffer byteBuffer);
 }
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop;
+
+import java.nio.ByteBuffer;
+
+/**
+ * The type V8 backing store.
+ * <p>
+ * It is a block of native memory that can be attached as an array buffer
+ * (or a shared array buffer) in any V8 runtime of the same {@link V8Host} without copying,
+ * so that a large binary input is held only once no matter how many V8 runtimes use it.
+ * The memory stays alive as long as any array buffer attached from it is alive.
+ * It is either allocated natively or borrowed from a direct byte buffer,
+ * in which case the byte buffer is kept alive until the memory is released.
+ *
+ * @since 5.0.4
+ */
+public final class V8BackingStore extends BaseV8HostResource {
+    private final ByteBuffer byteBuffer;
+    private final boolean shared;
+
+    /**
+     * Instantiates a new V8 backing store.
+     *
+     * @param v8Host     the V8 host
+     * @param byteBuffer the direct byte buffer or null to allocate natively
+     * @param length     the length in bytes if the memory is allocated natively
+     * @param shared     true : shared array buffer, false : array buffer
+     * @since 5.0.4
+     */
+    V8BackingStore(V8Host v8Host, ByteBuffer byteBuffer, int length, boolean shared) {
+        super(v8Host);
+        if (byteBuffer != null && !byteBuffer.isDirect()) {
+            throw new IllegalArgumentException("Byte buffer must be direct");
+        }
+        if (byteBuffer == null && length < 0) {
+            throw new IllegalArgumentException("Length must not be negative");
+        }
+        this.shared = shared;
+        IV8Native v8Native = v8Host.getV8Native();
+        // The native side shares the remaining bytes from the slice address.
+        long handle = v8Native.backingStoreCreate(byteBuffer == null ? null : byteBuffer.slice(), length, shared);
+        if (handle == INVALID_HANDLE) {
+            throw new OutOfMemoryError("Failed to create backing store");
+        }
+        setHandle(handle);
+        this.byteBuffer = v8Native.backingStoreGetByteBuffer(handle);
+    }
+
+    /**
+     * Gets a view of the native memory.
+     * The view must not be used after the backing store is closed
+     * unless an array buffer attached from it is still alive.
+     *
+     * @return the byte buffer
+     * @since 5.0.4
+     */
+    public ByteBuffer getByteBuffer() {
+        return byteBuffer.duplicate();
+    }
+
+    /**
+     * Gets the length in bytes.
+     *
+     * @return the length
+     * @since 5.0.4
+     */
+    public int getLength() {
+        return byteBuffer.capacity();
+    }
+
+    /**
+     * Is shared.
+     *
+     * @return true : attached as shared array buffer, false : attached as array buffer
+     * @since 5.0.4
+     */
+    public boolean isShared() {
+        return shared;
+    }
+
+    @Override
+    protected void releaseNativeHandle(long handle) {
+        v8Host.getV8Native().backingStoreRelease(handle);
+    }
+}
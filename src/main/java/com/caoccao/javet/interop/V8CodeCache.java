@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop;
+
+import com.caoccao.javet.interfaces.IJavetLogger;
+import com.caoccao.javet.interop.monitoring.V8CodeCacheStatistics;
+import com.caoccao.javet.interop.options.NodeRuntimeOptions;
+import com.caoccao.javet.interop.options.V8RuntimeOptions;
+import com.caoccao.javet.utils.JavetDefaultLogger;
+
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.*;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.util.*;
+import java.util.concurrent.atomic.AtomicLong;
+
+/**
+ * The type V8 code cache.
+ * <p>
+ * It is a code cache service that can be shared by any number of V8 runtimes in the process.
+ * Once it is set to a V8 runtime, scripts, modules and functions compiled from strings
+ * without explicit cached data look up the code cache by a hash of the source,
+ * the origin, the V8 version and the V8 flags. A miss compiles the source from scratch
+ * and stores the code cache created by V8, after the execution if the source is executed,
+ * so that the lazily compiled functions are included.
+ * A code cache rejected by V8 is replaced by a fresh one created the same way.
+ * <p>
+ * The code caches are kept in memory and, if a directory is given, persisted to that directory
+ * so that they survive restarts. The memory can be bounded by a max count and a max byte length
+ * of the code caches. The least recently used code caches are evicted from both the memory
+ * and the directory once either bound is exceeded.
+ *
+ * @since 5.0.4
+ */
+public final class V8CodeCache {
+    /**
+     * The constant KIND_FUNCTION.
+     *
+     * @since 5.0.4
+     */
+    public static final String KIND_FUNCTION = "function";
+    /**
+     * The constant KIND_MODULE.
+     *
+     * @since 5.0.4
+     */
+    public static final String KIND_MODULE = "module";
+    /**
+     * The constant KIND_SCRIPT.
+     *
+     * @since 5.0.4
+     */
+    public static final String KIND_SCRIPT = "script";
+    private static final String ALGORITHM = "SHA-256";
+    private static final char[] HEX_CHARS = "0123456789abcdef".toCharArray();
+    private static final String FILE_EXTENSION = ".cache";
+    private static final String TEMP_FILE_EXTENSION = ".tmp";
+    private final LinkedHashMap<String, byte[]> cachedDataMap;
+    private final AtomicLong diskHitCount;
+    private final Path directory;
+    private final AtomicLong evictCount;
+    private final AtomicLong hitCount;
+    private final IJavetLogger logger;
+    private final long maxBytes;
+    private final int maxSize;
+    private final AtomicLong missCount;
+    private final AtomicLong rejectCount;
+    private final AtomicLong storeCount;
+    private long bytes;
+
+    /**
+     * Instantiates a new unbounded V8 code cache in memory only.
+     *
+     * @since 5.0.4
+     */
+    public V8CodeCache() {
+        this(null);
+    }
+
+    /**
+     * Instantiates a new unbounded V8 code cache persisted to the given directory.
+     *
+     * @param directory the directory or null to keep the code caches in memory only
+     * @since 5.0.4
+     */
+    public V8CodeCache(Path directory) {
+        this(directory, 0, 0L);
+    }
+
+    /**
+     * Instantiates a new bounded V8 code cache persisted to the given directory.
+     *
+     * @param directory the directory or null to keep the code caches in memory only
+     * @param maxSize   the max count of the code caches, 0 means unbounded
+     * @param maxBytes  the max byte length of the code caches, 0 means unbounded
+     * @since 5.0.4
+     */
+    public V8CodeCache(Path directory, int maxSize, long maxBytes) {
+        bytes = 0L;
+        cachedDataMap = new LinkedHashMap<>(16, 0.75F, true);
+        diskHitCount = new AtomicLong();
+        this.directory = directory;
+        evictCount = new AtomicLong();
+        hitCount = new AtomicLong();
+        logger = new JavetDefaultLogger(getClass().getName());
+        this.maxBytes = Math.max(0L, maxBytes);
+        this.maxSize = Math.max(0, maxSize);
+        missCount = new AtomicLong();
+        rejectCount = new AtomicLong();
+        storeCount = new AtomicLong();
+    }
+
+    private static String toHexString(byte[] bytes) {
+        char[] chars = new char[bytes.length * 2];
+        for (int i = 0; i < bytes.length; i++) {
+            chars[i * 2] = HEX_CHARS[(bytes[i] >> 4) & 0x0F];
+            chars[i * 2 + 1] = HEX_CHARS[bytes[i] & 0x0F];
+        }
+        return new String(chars);
+    }
+
+    /**
+     * Clear the code caches in memory.
+     * The persisted code caches are kept.
+     *
+     * @since 5.0.4
+     */
+    public void clear() {
+        synchronized (cachedDataMap) {
+            cachedDataMap.clear();
+            bytes = 0L;
+        }
+    }
+
+    private void deleteFile(String key) {
+        if (directory != null) {
+            try {
+                Files.deleteIfExists(directory.resolve(key + FILE_EXTENSION));
+            } catch (IOException e) {
+                logger.logWarn("Failed to delete code cache {0}. {1}", key, e.getMessage());
+            }
+        }
+    }
+
+    /**
+     * Get the code cache by key.
+     *
+     * @param key the key
+     * @return the code cache or null if not found
+     * @since 5.0.4
+     */
+    public byte[] get(String key) {
+        Objects.requireNonNull(key);
+        byte[] cachedData;
+        synchronized (cachedDataMap) {
+            cachedData = cachedDataMap.get(key);
+        }
+        if (cachedData != null) {
+            hitCount.incrementAndGet();
+            return cachedData;
+        }
+        if (directory != null) {
+            Path path = directory.resolve(key + FILE_EXTENSION);
+            if (Files.isRegularFile(path)) {
+                try {
+                    cachedData = Files.readAllBytes(path);
+                    putInMemory(key, cachedData);
+                    diskHitCount.incrementAndGet();
+                    return cachedData;
+                } catch (IOException e) {
+                    logger.logWarn("Failed to read code cache {0}. {1}", path.toString(), e.getMessage());
+                }
+            }
+        }
+        missCount.incrementAndGet();
+        return null;
+    }
+
+    /**
+     * Gets directory.
+     *
+     * @return the directory or null if the code caches are kept in memory only
+     * @since 5.0.4
+     */
+    public Path getDirectory() {
+        return directory;
+    }
+
+    /**
+     * Gets the key of the given source.
+     * The key changes whenever the source, the origin, the V8 version or the V8 flags change,
+     * so that a code cache is never looked up by a V8 that would reject it.
+     *
+     * @param v8Runtime      the V8 runtime
+     * @param kind           the kind
+     * @param scriptString   the script string
+     * @param v8ScriptOrigin the V8 script origin
+     * @param arguments      the arguments of the function or null
+     * @return the key
+     * @since 5.0.4
+     */
+    public String getKey(
+            V8Runtime v8Runtime, String kind, String scriptString, V8ScriptOrigin v8ScriptOrigin, String[] arguments) {
+        MessageDigest messageDigest;
+        try {
+            messageDigest = MessageDigest.getInstance(ALGORITHM);
+        } catch (NoSuchAlgorithmException e) {
+            throw new IllegalStateException(e);
+        }
+        StringBuilder sb = new StringBuilder();
+        sb.append(kind).append('\0');
+        sb.append(v8Runtime.getJSRuntimeType().getName()).append('\0');
+        sb.append(v8Runtime.getVersion()).append('\0');
+        sb.append(v8Runtime.getJSRuntimeType().isNode()
+                ? NodeRuntimeOptions.V8_FLAGS.toString()
+                : V8RuntimeOptions.V8_FLAGS.toString()).append('\0');
+        sb.append(v8ScriptOrigin.getResourceName()).append('\0');
+        sb.append(v8ScriptOrigin.getResourceLineOffset()).append('\0');
+        sb.append(v8ScriptOrigin.getResourceColumnOffset()).append('\0');
+        if (arguments != null) {
+            for (String argument : arguments) {
+                sb.append(argument).append(',');
+            }
+        }
+        sb.append('\0');
+        messageDigest.update(sb.toString().getBytes(StandardCharsets.UTF_8));
+        messageDigest.update(Objects.requireNonNull(scriptString).getBytes(StandardCharsets.UTF_8));
+        return toHexString(messageDigest.digest());
+    }
+
+    /**
+     * Gets max byte length of the code caches in memory.
+     *
+     * @return the max byte length, 0 means unbounded
+     * @since 5.0.4
+     */
+    public long getMaxBytes() {
+        return maxBytes;
+    }
+
+    /**
+     * Gets max count of the code caches in memory.
+     *
+     * @return the max count, 0 means unbounded
+     * @since 5.0.4
+     */
+    public int getMaxSize() {
+        return maxSize;
+    }
+
+    /**
+     * Gets statistics.
+     *
+     * @return the statistics
+     * @since 5.0.4
+     */
+    public V8CodeCacheStatistics getStatistics() {
+        synchronized (cachedDataMap) {
+            return new V8CodeCacheStatistics(
+                    bytes,
+                    diskHitCount.get(),
+                    evictCount.get(),
+                    hitCount.get(),
+                    missCount.get(),
+                    rejectCount.get(),
+                    cachedDataMap.size(),
+                    storeCount.get());
+        }
+    }
+
+    /**
+     * Put the code cache by key.
+     * The code cache is written to a temporary file and moved in place,
+     * so that a concurrent reader never sees a partially written code cache.
+     * A code cache larger than the max byte length is neither kept nor persisted.
+     *
+     * @param key        the key
+     * @param cachedData the code cache
+     * @since 5.0.4
+     */
+    public void put(String key, byte[] cachedData) {
+        Objects.requireNonNull(key);
+        if (cachedData == null || cachedData.length == 0) {
+            return;
+        }
+        if (!putInMemory(key, cachedData)) {
+            return;
+        }
+        storeCount.incrementAndGet();
+        if (directory != null) {
+            Path path = directory.resolve(key + FILE_EXTENSION);
+            Path tempPath = directory.resolve(key + "." + Thread.currentThread().getId() + TEMP_FILE_EXTENSION);
+            try {
+                Files.createDirectories(directory);
+                Files.write(tempPath, cachedData);
+                try {
+                    Files.move(tempPath, path, StandardCopyOption.REPLACE_EXISTING, StandardCopyOption.ATOMIC_MOVE);
+                } catch (AtomicMoveNotSupportedException e) {
+                    Files.move(tempPath, path, StandardCopyOption.REPLACE_EXISTING);
+                }
+            } catch (IOException e) {
+                logger.logWarn("Failed to write code cache {0}. {1}", path.toString(), e.getMessage());
+                try {
+                    Files.deleteIfExists(tempPath);
+                } catch (IOException ignored) {
+                }
+            }
+        }
+    }
+
+    private boolean putInMemory(String key, byte[] cachedData) {
+        if (maxBytes > 0L && cachedData.length > maxBytes) {
+            return false;
+        }
+        List<String> evictedKeys = null;
+        synchronized (cachedDataMap) {
+            byte[] oldCachedData = cachedDataMap.put(key, cachedData);
+            bytes += cachedData.length - (oldCachedData == null ? 0 : oldCachedData.length);
+            Iterator<Map.Entry<String, byte[]>> iterator = cachedDataMap.entrySet().iterator();
+            while ((maxSize > 0 && cachedDataMap.size() > maxSize) || (maxBytes > 0L && bytes > maxBytes)) {
+                Map.Entry<String, byte[]> entry = iterator.next();
+                bytes -= entry.getValue().length;
+                iterator.remove();
+                if (evictedKeys == null) {
+                    evictedKeys = new ArrayList<>();
+                }
+                evictedKeys.add(entry.getKey());
+            }
+        }
+        if (evictedKeys != null) {
+            evictCount.addAndGet(evictedKeys.size());
+            evictedKeys.forEach(this::deleteFile);
+        }
+        return true;
+    }
+
+    /**
+     * Reject the code cache by key because V8 refused to consume it,
+     * e.g. after a V8 upgrade or a flag change that the key does not capture.
+     * The code cache is removed so that a fresh one can be put.
+     *
+     * @param key the key
+     * @since 5.0.4
+     */
+    public void reject(String key) {
+        rejectCount.incrementAndGet();
+        remove(key);
+    }
+
+    /**
+     * Remove the code cache by key from both the memory and the directory.
+     *
+     * @param key the key
+     * @since 5.0.4
+     */
+    public void remove(String key) {
+        Objects.requireNonNull(key);
+        synchronized (cachedDataMap) {
+            byte[] cachedData = cachedDataMap.remove(key);
+            if (cachedData != null) {
+                bytes -= cachedData.length;
+            }
+        }
+        deleteFile(key);
+    }
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.caoccao.javet.interop;
+
+import java.io.*;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Arrays;
+import java.util.Objects;
+
+/**
+ * The type V8 compile hints.
+ * <p>
+ * It is a sorted list of the source positions of the functions that are known to run,
+ * e.g. recorded from a warm-up pass via {@link com.caoccao.javet.values.reference.IV8Script#getCompileHints()}.
+ * When it is set to the V8 script origin of a later compilation of the same source,
+ * V8 compiles these functions eagerly instead of lazily on the first call,
+ * so that the first requests after a deployment do not pay for the lazy compilation.
+ * <p>
+ * It is immutable and can be shared by any number of V8 runtimes.
+ *
+ * @since 5.0.4
+ */
+public final class V8CompileHints {
+    /**
+     * The constant EMPTY.
+     *
+     * @since 5.0.4
+     */
+    public static final V8CompileHints EMPTY = new V8CompileHints(new int[0]);
+    private static final int MAGIC = 0x4A434831;
+    final int[] positions;
+
+    /**
+     * Instantiates a new V8 compile hints.
+     *
+     * @param positions the source positions in any order, duplicates are removed
+     * @since 5.0.4
+     */
+    public V8CompileHints(int[] positions) {
+        this.positions = Arrays.stream(Objects.requireNonNull(positions)).sorted().distinct().toArray();
+    }
+
+    /**
+     * Load the compile hints from a file written by {@link #save(Path)}.
+     *
+     * @param path the path
+     * @return the compile hints
+     * @throws IOException the IO exception
+     * @since 5.0.4
+     */
+    public static V8CompileHints load(Path path) throws IOException {
+        try (DataInputStream dataInputStream = new DataInputStream(
+                new BufferedInputStream(Files.newInputStream(path)))) {
+            if (dataInputStream.readInt() != MAGIC) {
+                throw new IOException("Invalid compile hints " + path);
+            }
+            final int length = dataInputStream.readInt();
+            if (length < 0) {
+                throw new IOException("Invalid compile hints " + path);
+            }
+            int[] positions = new int[length];
+            for (int i = 0; i < length; i++) {
+                positions[i] = dataInputStream.readInt();
+            }
+            return new V8CompileHints(positions);
+        }
+    }
+
+    /**
+     * Gets a copy of the sorted source positions.
+     *
+     * @return the source positions
+     * @since 5.0.4
+     */
+    public int[] getPositions() {
+        return positions.clone();
+    }
+
+    /**
+     * Is empty.
+     *
+     * @return true : empty, false : not empty
+     * @since 5.0.4
+     */
+    public boolean isEmpty() {
+        return positions.length == 0;
+    }
+
+    /**
+     * Merge with other compile hints, e.g. recorded from several warm-up passes.
+     *
+     * @param other the other compile hints
+     * @return the merged compile hints
+     * @since 5.0.4
+     */
+    public V8CompileHints merge(V8CompileHints other) {
+        Objects.requireNonNull(other);
+        int[] mergedPositions = Arrays.copyOf(positions, positions.length + other.positions.length);
+        System.arraycopy(other.positions, 0, mergedPositions, positions.length, other.positions.length);
+        return new V8CompileHints(mergedPositions);
+    }
+
+    /**
+     * Save the compile hints to a file.
+     *
+     * @param path the path
+     * @throws IOException the IO exception
+     * @since 5.0.4
+     */
+    public void save(Path path) throws IOException {
+        try (DataOutputStream dataOutputStream = new DataOutputStream(
+                new BufferedOutputStream(Files.newOutputStream(path)))) {
+            dataOutputStream.writeInt(MAGIC);
+            dataOutputStream.writeInt(positions.length);
+            for (int position : positions) {
+                dataOutputStream.writeInt(position);
+            }
+        }
+    }
+
+    /**
+     * Gets the count of the source positions.
+     *
+     * @return the count
+     * @since 5.0.4
+     */
+    public int size() {
+        return positions.length;
+    }
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop;
+
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.CharBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.Objects;
+
+/**
+ * The type V8 external source.
+ * <p>
+ * It is an immutable script source backed by a direct byte buffer.
+ * The bytes are exposed to V8 as external strings without being copied into the V8 heap,
+ * so that the same source can be compiled in every V8 runtime of the same {@link V8Host}
+ * without any per-runtime copy.
+ * The content is either one-byte (Latin-1) or two-byte (UTF-16 in native byte order).
+ * The byte buffer stays alive as long as V8 strings created from it are alive,
+ * and it must not be modified after the external source is created.
+ * <p>
+ * The closing and the per-call acquisition of the native handle follow {@link BaseV8HostResource}.
+ *
+ * @since 5.0.4
+ */
+public final class V8ExternalSource extends BaseV8HostResource {
+    private static final int MAX_ONE_BYTE_CHAR = 0xFF;
+    private final ByteBuffer byteBuffer;
+    private final boolean oneByte;
+
+    /**
+     * Instantiates a new V8 external source.
+     *
+     * @param v8Host     the V8 host
+     * @param byteBuffer the direct byte buffer
+     * @param oneByte    true : one-byte, false : two-byte
+     * @since 5.0.4
+     */
+    V8ExternalSource(V8Host v8Host, ByteBuffer byteBuffer, boolean oneByte) {
+        super(v8Host);
+        Objects.requireNonNull(byteBuffer);
+        if (!byteBuffer.isDirect()) {
+            throw new IllegalArgumentException("Byte buffer must be direct");
+        }
+        if (!oneByte && (byteBuffer.remaining() & 1) != 0) {
+            throw new IllegalArgumentException("Two-byte external source must have an even number of bytes");
+        }
+        this.byteBuffer = byteBuffer.slice().asReadOnlyBuffer();
+        this.oneByte = oneByte;
+        // The native side reads the slice from its address, not from the read-only view.
+        long handle = v8Host.getV8Native().externalSourceCreate(byteBuffer.slice(), oneByte);
+        if (handle == INVALID_HANDLE) {
+            throw new IllegalArgumentException("Failed to create external source");
+        }
+        setHandle(handle);
+    }
+
+    /**
+     * Encode a string to a direct byte buffer.
+     *
+     * @param string  the string
+     * @param oneByte true : Latin-1, false : UTF-16 in native byte order
+     * @return the direct byte buffer
+     * @since 5.0.4
+     */
+    static ByteBuffer encode(String string, boolean oneByte) {
+        ByteBuffer byteBuffer;
+        if (oneByte) {
+            byteBuffer = ByteBuffer.allocateDirect(string.length());
+            byteBuffer.put(string.getBytes(StandardCharsets.ISO_8859_1));
+        } else {
+            byteBuffer = ByteBuffer.allocateDirect(string.length() * 2).order(ByteOrder.nativeOrder());
+            byteBuffer.asCharBuffer().put(string);
+        }
+        ((Buffer) byteBuffer).clear();
+        return byteBuffer;
+    }
+
+    /**
+     * Is one-byte string.
+     *
+     * @param string the string
+     * @return true : one-byte, false : two-byte
+     * @since 5.0.4
+     */
+    static boolean isOneByte(String string) {
+        final int length = string.length();
+        for (int i = 0; i < length; ++i) {
+            if (string.charAt(i) > MAX_ONE_BYTE_CHAR) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Gets a read-only view of the byte buffer.
+     *
+     * @return the byte buffer
+     * @since 5.0.4
+     */
+    public ByteBuffer getByteBuffer() {
+        return byteBuffer.duplicate();
+    }
+
+    /**
+     * Gets the length in characters.
+     *
+     * @return the length
+     * @since 5.0.4
+     */
+    public int getLength() {
+        return oneByte ? byteBuffer.capacity() : byteBuffer.capacity() / 2;
+    }
+
+    /**
+     * Is one-byte.
+     *
+     * @return true : one-byte (Latin-1), false : two-byte (UTF-16)
+     * @since 5.0.4
+     */
+    public boolean isOneByte() {
+        return oneByte;
+    }
+
+    @Override
+    protected void releaseNativeHandle(long handle) {
+        v8Host.getV8Native().externalSourceRelease(handle);
+    }
+
+    /**
+     * Decode the source to a Java string.
+     * It copies the whole source, so it is only for diagnostics.
+     *
+     * @return the string
+     * @since 5.0.4
+     */
+    @Override
+    public String toString() {
+        ByteBuffer duplicatedByteBuffer = getByteBuffer();
+        if (oneByte) {
+            return StandardCharsets.ISO_8859_1.decode(duplicatedByteBuffer).toString();
+        }
+        CharBuffer charBuffer = duplicatedByteBuffer.order(ByteOrder.nativeOrder()).asCharBuffer();
+        return charBuffer.toString();
+    }
+}
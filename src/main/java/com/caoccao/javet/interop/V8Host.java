@@ -31,6 +31,7 @@ import com.caoccao.javet.utils.SimpleMap;
 import java.lang.management.ManagementFactory;
 import java.lang.management.MemoryPoolMXBean;
 import java.lang.management.MemoryType;
+import java.nio.ByteBuffer;
 import java.time.Duration;
 import java.time.ZonedDateTime;
 import java.util.*;
@@ -270,6 +271,62 @@ public final class V8Host {
         }
     }
 
+    /**
+     * Create a V8 backing store from a direct byte buffer.
+     * The remaining bytes of the byte buffer are shared with V8 without copying
+     * and the byte buffer is kept alive until the backing store is released.
+     *
+     * @param byteBuffer the direct byte buffer
+     * @param shared     true : attached as shared array buffer, false : attached as array buffer
+     * @return the V8 backing store
+     * @since 5.0.4
+     */
+    public V8BackingStore createV8BackingStore(ByteBuffer byteBuffer, boolean shared) {
+        return new V8BackingStore(this, Objects.requireNonNull(byteBuffer), 0, shared);
+    }
+
+    /**
+     * Create a V8 backing store by allocating zero-filled native memory.
+     * The memory can be filled via {@link V8BackingStore#getByteBuffer()} before being attached.
+     *
+     * @param length the length in bytes
+     * @param shared true : attached as shared array buffer, false : attached as array buffer
+     * @return the V8 backing store
+     * @since 5.0.4
+     */
+    public V8BackingStore createV8BackingStore(int length, boolean shared) {
+        return new V8BackingStore(this, null, length, shared);
+    }
+
+    /**
+     * Create a V8 external source from a direct byte buffer.
+     * The remaining bytes of the byte buffer are shared with V8 without copying,
+     * so the byte buffer must not be modified afterward.
+     *
+     * @param byteBuffer the direct byte buffer
+     * @param oneByte    true : Latin-1, false : UTF-16 in native byte order
+     * @return the V8 external source
+     * @since 5.0.4
+     */
+    public V8ExternalSource createV8ExternalSource(ByteBuffer byteBuffer, boolean oneByte) {
+        return new V8ExternalSource(this, byteBuffer, oneByte);
+    }
+
+    /**
+     * Create a V8 external source from a string.
+     * The string is copied once to a direct byte buffer which is then shared by all the V8 runtimes
+     * created by this V8 host.
+     *
+     * @param scriptString the script string
+     * @return the V8 external source
+     * @since 5.0.4
+     */
+    public V8ExternalSource createV8ExternalSource(String scriptString) {
+        Objects.requireNonNull(scriptString);
+        final boolean oneByte = V8ExternalSource.isOneByte(scriptString);
+        return new V8ExternalSource(this, V8ExternalSource.encode(scriptString, oneByte), oneByte);
+    }
+
     /**
      * Create V8 runtime.
      *
@@ -26,6 +26,7 @@ import com.caoccao.javet.values.V8Value;
 import com.caoccao.javet.values.primitive.*;
 import com.caoccao.javet.values.reference.*;
 
+import java.nio.ByteBuffer;
 import java.util.Objects;
 
 public final class V8Internal {
@@ -53,12 +54,84 @@ public final class V8Internal {
         return v8Runtime.batchArrayGet(iV8ValueArray, v8Values, startIndex, endIndex);
     }
 
+    public int batchArrayGetBooleans(
+            IV8ValueArray iV8ValueArray, boolean[] values, boolean[] validities,
+            int startIndex, int endIndex)
+            throws JavetException {
+        return v8Runtime.batchArrayGetBooleans(iV8ValueArray, values, validities, startIndex, endIndex);
+    }
+
+    public int batchArrayGetDoubles(
+            IV8ValueArray iV8ValueArray, double[] values, boolean[] validities,
+            int startIndex, int endIndex)
+            throws JavetException {
+        return v8Runtime.batchArrayGetDoubles(iV8ValueArray, values, validities, startIndex, endIndex);
+    }
+
+    public int batchArrayGetIntegers(
+            IV8ValueArray iV8ValueArray, int[] values, boolean[] validities,
+            int startIndex, int endIndex)
+            throws JavetException {
+        return v8Runtime.batchArrayGetIntegers(iV8ValueArray, values, validities, startIndex, endIndex);
+    }
+
+    public int batchArrayGetLongs(
+            IV8ValueArray iV8ValueArray, long[] values, boolean[] validities,
+            int startIndex, int endIndex)
+            throws JavetException {
+        return v8Runtime.batchArrayGetLongs(iV8ValueArray, values, validities, startIndex, endIndex);
+    }
+
+    public int batchArrayGetStrings(
+            IV8ValueArray iV8ValueArray, String[] values, int startIndex, int endIndex)
+            throws JavetException {
+        return v8Runtime.batchArrayGetStrings(iV8ValueArray, values, startIndex, endIndex);
+    }
+
     public int batchObjectGet(
             IV8ValueObject iV8ValueObject, V8Value[] v8ValueKeys, V8Value[] v8ValueValues, int length)
             throws JavetException {
         return v8Runtime.batchObjectGet(iV8ValueObject, v8ValueKeys, v8ValueValues, length);
     }
 
+    public int batchObjectGetBooleans(
+            IV8ValueObject iV8ValueObject, V8Value[] v8ValueKeys, boolean[] values, boolean[] validities,
+            int length)
+            throws JavetException {
+        return v8Runtime.batchObjectGetBooleans(iV8ValueObject, v8ValueKeys, values, validities, length);
+    }
+
+    public int batchObjectGetDoubles(
+            IV8ValueObject iV8ValueObject, V8Value[] v8ValueKeys, double[] values, boolean[] validities,
+            int length)
+            throws JavetException {
+        return v8Runtime.batchObjectGetDoubles(iV8ValueObject, v8ValueKeys, values, validities, length);
+    }
+
+    public int batchObjectGetIntegers(
+            IV8ValueObject iV8ValueObject, V8Value[] v8ValueKeys, int[] values, boolean[] validities,
+            int length)
+            throws JavetException {
+        return v8Runtime.batchObjectGetIntegers(iV8ValueObject, v8ValueKeys, values, validities, length);
+    }
+
+    public int batchObjectGetLongs(
+            IV8ValueObject iV8ValueObject, V8Value[] v8ValueKeys, long[] values, boolean[] validities,
+            int length)
+            throws JavetException {
+        return v8Runtime.batchObjectGetLongs(iV8ValueObject, v8ValueKeys, values, validities, length);
+    }
+
+    public int batchObjectGetStrings(
+            IV8ValueObject iV8ValueObject, V8Value[] v8ValueKeys, String[] values, int length)
+            throws JavetException {
+        return v8Runtime.batchObjectGetStrings(iV8ValueObject, v8ValueKeys, values, length);
+    }
+
+    public int batchSetAdd(IV8ValueSet iV8ValueSet, V8Value[] v8Values, int length) throws JavetException {
+        return v8Runtime.batchSetAdd(iV8ValueSet, v8Values, length);
+    }
+
     public V8ValueBoolean booleanObjectValueOf(V8ValueBooleanObject v8ValueBooleanObject) {
         return v8Runtime.booleanObjectValueOf(v8ValueBooleanObject);
     }
@@ -600,6 +673,10 @@ public final class V8Internal {
         return v8Runtime.scriptGetCachedData(iV8Script);
     }
 
+    public V8CompileHints scriptGetCompileHints(IV8Script iV8Script) throws JavetException {
+        return v8Runtime.scriptGetCompileHints(iV8Script);
+    }
+
     public String scriptGetResourceName(IV8Script iV8Script) throws JavetException {
         return v8Runtime.scriptGetResourceName(iV8Script);
     }
@@ -661,4 +738,20 @@ public final class V8Internal {
     public String toString(IV8ValueReference iV8ValueReference) throws JavetException {
         return v8Runtime.toString(iV8ValueReference);
     }
+
+    public ByteBuffer typedArrayGetByteBuffer(IV8ValueTypedArray iV8ValueTypedArray) throws JavetException {
+        return v8Runtime.typedArrayGetByteBuffer(iV8ValueTypedArray);
+    }
+
+    public boolean typedArrayGetRegion(
+            IV8ValueTypedArray iV8ValueTypedArray, int index, Object array, int arrayOffset, int length)
+            throws JavetException {
+        return v8Runtime.typedArrayGetRegion(iV8ValueTypedArray, index, array, arrayOffset, length);
+    }
+
+    public boolean typedArraySetRegion(
+            IV8ValueTypedArray iV8ValueTypedArray, int index, Object array, int arrayOffset, int length)
+            throws JavetException {
+        return v8Runtime.typedArraySetRegion(iV8ValueTypedArray, index, array, arrayOffset, length);
+    }
 }
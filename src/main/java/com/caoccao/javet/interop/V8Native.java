@@ -16,6 +16,7 @@
 
 package com.caoccao.javet.interop;
 
+import java.io.InputStream;
 import java.nio.ByteBuffer;
 
 /**
@@ -46,22 +47,104 @@ class V8Native implements IV8Native {
     @Override
     public native Object arrayCreate(long v8RuntimeHandle);
 
+    @Override
+    public native Object arrayCreateFromBooleans(long v8RuntimeHandle, boolean[] values);
+
+    @Override
+    public native Object arrayCreateFromDoubles(long v8RuntimeHandle, double[] values);
+
+    @Override
+    public native Object arrayCreateFromIntegers(long v8RuntimeHandle, int[] values);
+
+    @Override
+    public native Object arrayCreateFromLongs(long v8RuntimeHandle, long[] values);
+
+    @Override
+    public native Object arrayCreateFromStrings(long v8RuntimeHandle, String[] values);
+
     @Override
     public native int arrayGetLength(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
 
     @Override
     public native boolean await(long v8RuntimeHandle, int v8AwaitMode);
 
+    @Override
+    public native Object backingStoreAttach(long v8RuntimeHandle, long backingStoreHandle);
+
+    @Override
+    public native long backingStoreCreate(ByteBuffer byteBuffer, int length, boolean shared);
+
+    @Override
+    public native ByteBuffer backingStoreGetByteBuffer(long backingStoreHandle);
+
+    @Override
+    public native void backingStoreRelease(long backingStoreHandle);
+
     @Override
     public native int batchArrayGet(
             long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
             Object[] v8Values, int startIndex, int endIndex);
 
+    @Override
+    public native int batchArrayGetBooleans(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            boolean[] values, boolean[] validities, int startIndex, int endIndex);
+
+    @Override
+    public native int batchArrayGetDoubles(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            double[] values, boolean[] validities, int startIndex, int endIndex);
+
+    @Override
+    public native int batchArrayGetIntegers(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            int[] values, boolean[] validities, int startIndex, int endIndex);
+
+    @Override
+    public native int batchArrayGetLongs(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            long[] values, boolean[] validities, int startIndex, int endIndex);
+
+    @Override
+    public native int batchArrayGetStrings(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            String[] values, int startIndex, int endIndex);
+
     @Override
     public native int batchObjectGet(
             long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
             Object[] v8ValueKeys, Object[] v8ValueValues, int length);
 
+    @Override
+    public native int batchObjectGetBooleans(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object[] v8ValueKeys, boolean[] values, boolean[] validities, int length);
+
+    @Override
+    public native int batchObjectGetDoubles(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object[] v8ValueKeys, double[] values, boolean[] validities, int length);
+
+    @Override
+    public native int batchObjectGetIntegers(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object[] v8ValueKeys, int[] values, boolean[] validities, int length);
+
+    @Override
+    public native int batchObjectGetLongs(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object[] v8ValueKeys, long[] values, boolean[] validities, int length);
+
+    @Override
+    public native int batchObjectGetStrings(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object[] v8ValueKeys, String[] values, int length);
+
+    @Override
+    public native int batchSetAdd(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object[] v8Values, int length);
+
     @Override
     public native Object booleanObjectCreate(long v8RuntimeHandle, boolean booleanValue);
 
@@ -114,6 +197,12 @@ class V8Native implements IV8Native {
     @Override
     public native Object errorCreate(long v8RuntimeHandle, int v8ValueErrorTypeId, String message);
 
+    @Override
+    public native long externalSourceCreate(ByteBuffer byteBuffer, boolean oneByte);
+
+    @Override
+    public native void externalSourceRelease(long externalSourceHandle);
+
     @Override
     public native Object functionCall(
             long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
@@ -128,7 +217,7 @@ class V8Native implements IV8Native {
 
     @Override
     public native Object functionCompile(
-            long v8RuntimeHandle, String script, byte[] cachedData,
+            long v8RuntimeHandle, Object script, byte[] cachedData,
             String resourceName, int resourceLineOffset, int resourceColumnOffset,
             int scriptId, boolean wasm,
             String[] arguments, Object[] contextExtensions);
@@ -200,15 +289,24 @@ class V8Native implements IV8Native {
     @Override
     public native int getPriority(long v8RuntimeHandle);
 
+    @Override
+    public native Object getV8ArrayBufferStatistics(long v8RuntimeHandle);
+
     @Override
     public native Object getV8HeapSpaceStatistics(long v8RuntimeHandle, Object v8AllocationSpace);
 
     @Override
     public native Object getV8HeapStatistics(long v8RuntimeHandle);
 
+    @Override
+    public native Object getV8PropertyKeyCacheStatistics(long v8RuntimeHandle);
+
     @Override
     public native Object getV8SharedMemoryStatistics();
 
+    @Override
+    public native Object getV8UnboundScriptCacheStatistics(long v8RuntimeHandle);
+
     @Override
     public native String getVersion();
 
@@ -251,6 +349,17 @@ class V8Native implements IV8Native {
     @Override
     public native boolean isWeak(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
 
+    @Override
+    public native Object jsonParse(long v8RuntimeHandle, ByteBuffer byteBuffer, int position, int length);
+
+    @Override
+    public native int jsonStringify(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, ByteBuffer byteBuffer, int position, int limit);
+
+    @Override
+    public native Object jsonStringifyGrowable(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, ByteBuffer byteBuffer, int position, int limit);
+
     @Override
     public native boolean lockV8Runtime(long v8RuntimeHandle);
 
@@ -304,7 +413,7 @@ class V8Native implements IV8Native {
     public native boolean mapHas(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object value);
 
     @Override
-    public native boolean mapSet(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object[] keysAndValues);
+    public native int mapSet(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object[] keysAndValues);
 
     @Override
     public native boolean mapSetBoolean(
@@ -334,7 +443,7 @@ class V8Native implements IV8Native {
 
     @Override
     public native Object moduleCompile(
-            long v8RuntimeHandle, String script, byte[] cachedData, boolean returnResult,
+            long v8RuntimeHandle, Object script, byte[] cachedData, boolean returnResult,
             String resourceName, int resourceLineOffset, int resourceColumnOffset,
             int scriptId, boolean isWASM, boolean isModule);
 
@@ -346,7 +455,7 @@ class V8Native implements IV8Native {
 
     @Override
     public native Object moduleExecute(
-            long v8RuntimeHandle, String script, byte[] cachedData, boolean returnResult,
+            long v8RuntimeHandle, Object script, byte[] cachedData, boolean returnResult,
             String resourceName, int resourceLineOffset, int resourceColumnOffset,
             int scriptId, boolean isWASM);
 
@@ -452,7 +561,7 @@ class V8Native implements IV8Native {
     public native boolean objectIsSealed(long v8RuntimeHandle, long v8ValueHandle);
 
     @Override
-    public native boolean objectSet(
+    public native int objectSet(
             long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object[] keysAndValues);
 
     @Override
@@ -570,6 +679,9 @@ class V8Native implements IV8Native {
     @Override
     public native void removeReferenceHandle(long v8RuntimeHandle, long referenceHandle, int referenceType);
 
+    @Override
+    public native void removeReferenceHandles(long v8RuntimeHandle, long[] referenceHandles, int length);
+
     @Override
     public native boolean reportPendingMessages(long v8RuntimeHandle);
 
@@ -587,25 +699,46 @@ class V8Native implements IV8Native {
 
     @Override
     public native Object scriptCompile(
-            long v8RuntimeHandle, String script, byte[] cachedData, boolean returnResult,
+            long v8RuntimeHandle, Object script, byte[] cachedData, boolean returnResult,
             String resourceName, int resourceLineOffset, int resourceColumnOffset,
-            int scriptId, boolean isWASM, boolean isModule);
+            int scriptId, boolean isWASM, boolean isModule,
+            int compileOptions, int[] compileHints);
 
     @Override
     public native Object scriptExecute(
-            long v8RuntimeHandle, String script, byte[] cachedData, boolean returnResult,
+            long v8RuntimeHandle, Object script, byte[] cachedData, boolean returnResult,
             String resourceName, int resourceLineOffset, int resourceColumnOffset,
-            int scriptId, boolean isWASM);
+            int scriptId, boolean isWASM,
+            int compileOptions, int[] compileHints);
 
     @Override
     public native byte[] scriptGetCachedData(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
 
+    @Override
+    public native int[] scriptGetCompileHints(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
+
     @Override
     public native String scriptGetResourceName(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
 
     @Override
     public native Object scriptRun(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, boolean resultRequired);
 
+    @Override
+    public native long scriptStreamingCreate(
+            long v8RuntimeHandle, InputStream inputStream, int bufferSize,
+            int compileOptions, int[] compileHints);
+
+    @Override
+    public native Object scriptStreamingFinish(
+            long v8RuntimeHandle, long scriptStreamingHandle,
+            String resourceName, int resourceLineOffset, int resourceColumnOffset, int scriptId);
+
+    @Override
+    public native void scriptStreamingRelease(long v8RuntimeHandle, long scriptStreamingHandle);
+
+    @Override
+    public native void scriptStreamingRun(long scriptStreamingHandle);
+
     @Override
     public native void setAdd(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, Object value);
 
@@ -675,6 +808,19 @@ class V8Native implements IV8Native {
     @Override
     public native String toString(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
 
+    @Override
+    public native ByteBuffer typedArrayGetByteBuffer(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType);
+
+    @Override
+    public native boolean typedArrayGetRegion(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object array, int index, int arrayOffset, int length);
+
+    @Override
+    public native boolean typedArraySetRegion(
+            long v8RuntimeHandle, long v8ValueHandle, int v8ValueType,
+            Object array, int index, int arrayOffset, int length);
+
     @Override
     public native boolean unlockV8Runtime(long v8RuntimeHandle);
 
@@ -689,4 +835,10 @@ class V8Native implements IV8Native {
 
     @Override
     public native void v8InspectorSend(long v8RuntimeHandle, String message);
+
+    @Override
+    public native Object valueDeserialize(long v8RuntimeHandle, ByteBuffer byteBuffer, int length);
+
+    @Override
+    public native int valueSerialize(long v8RuntimeHandle, long v8ValueHandle, int v8ValueType, ByteBuffer byteBuffer);
 }
@@ -22,18 +22,24 @@ import com.caoccao.javet.exceptions.*;
 import com.caoccao.javet.interfaces.IEnumBitset;
 import com.caoccao.javet.interfaces.IJavetClosable;
 import com.caoccao.javet.interfaces.IJavetLogger;
+import com.caoccao.javet.interfaces.IJavetSupplier;
 import com.caoccao.javet.interop.callback.*;
 import com.caoccao.javet.interop.converters.IJavetConverter;
 import com.caoccao.javet.interop.converters.JavetObjectConverter;
 import com.caoccao.javet.interop.executors.IV8Executor;
+import com.caoccao.javet.interop.executors.V8ExternalSourceExecutor;
 import com.caoccao.javet.interop.executors.V8FileExecutor;
 import com.caoccao.javet.interop.executors.V8PathExecutor;
 import com.caoccao.javet.interop.executors.V8StringExecutor;
+import com.caoccao.javet.interop.monitoring.V8ArrayBufferStatistics;
 import com.caoccao.javet.interop.monitoring.V8HeapSpaceStatistics;
 import com.caoccao.javet.interop.monitoring.V8HeapStatistics;
+import com.caoccao.javet.interop.monitoring.V8PropertyKeyCacheStatistics;
 import com.caoccao.javet.interop.monitoring.V8SharedMemoryStatistics;
 import com.caoccao.javet.interop.monitoring.V8StatisticsFuture;
+import com.caoccao.javet.interop.monitoring.V8UnboundScriptCacheStatistics;
 import com.caoccao.javet.interop.options.RuntimeOptions;
+import com.caoccao.javet.utils.ByteBufferInputStream;
 import com.caoccao.javet.utils.JavetDefaultLogger;
 import com.caoccao.javet.utils.JavetResourceUtils;
 import com.caoccao.javet.utils.SimpleMap;
@@ -46,15 +52,26 @@ import com.caoccao.javet.values.reference.builtin.V8ValueBuiltInSymbol;
 import com.caoccao.javet.values.virtual.V8VirtualValue;
 
 import java.io.File;
+import java.io.FilterInputStream;
+import java.io.IOException;
+import java.io.InputStream;
 import java.math.BigInteger;
+import java.nio.Buffer;
 import java.nio.ByteBuffer;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.Channels;
+import java.nio.channels.FileChannel;
+import java.nio.channels.ReadableByteChannel;
 import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
 import java.text.MessageFormat;
 import java.time.ZonedDateTime;
 import java.util.*;
 import java.util.concurrent.CompletableFuture;
 import java.util.concurrent.CopyOnWriteArrayList;
+import java.util.concurrent.Executor;
 import java.util.concurrent.Executors;
+import java.util.concurrent.RejectedExecutionException;
 
 import static com.caoccao.javet.exceptions.JavetError.PARAMETER_FEATURE;
 
@@ -120,6 +137,14 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
      * @since 3.0.4
      */
     protected static final String ERROR_VALUE_CANNOT_BE_A_V_8_SCRIPT = "Value cannot be a V8 script.";
+    /**
+     * The Code cache rejected flag of the calling thread.
+     * JNI reports a rejected code cache on the thread that compiles,
+     * so that the rejection is attributed to the right call when the V8 runtime is shared by threads.
+     *
+     * @since 5.0.4
+     */
+    static final ThreadLocal<Boolean> CODE_CACHE_REJECTED = ThreadLocal.withInitial(() -> Boolean.FALSE);
     /**
      * The Default converter.
      *
@@ -132,6 +157,25 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
      * @since 0.7.3
      */
     static final String DEFAULT_MESSAGE_FORMAT_JAVET_INSPECTOR = "Javet Inspector {0}";
+    /**
+     * The Default reference release batch size.
+     *
+     * @since 5.0.4
+     */
+    static final int DEFAULT_REFERENCE_RELEASE_BATCH_SIZE = 256;
+    /**
+     * The Default script streaming buffer size.
+     *
+     * @since 5.0.4
+     */
+    static final int DEFAULT_SCRIPT_STREAMING_BUFFER_SIZE = 64 * 1024;
+    /**
+     * The Default script streaming release timeout millis.
+     * It matches the default pool shutdown timeout of the engine config.
+     *
+     * @since 5.0.4
+     */
+    static final long DEFAULT_SCRIPT_STREAMING_RELEASE_TIMEOUT_MILLIS = 5000L;
     /**
      * The Invalid handle.
      *
@@ -202,6 +246,12 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
      * @since 4.0.0
      */
     final JSRuntimeType jsRuntimeType;
+    /**
+     * The Pending reference handles are released in one JNI call.
+     *
+     * @since 5.0.4
+     */
+    final long[] pendingReferenceHandles;
     /**
      * The Primitive flags is for passing the calling succession in JNI calls.
      * Its length is 1. True: success. False: failure.
@@ -227,6 +277,14 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
      * @since 1.0.0
      */
     final RuntimeOptions<?> runtimeOptions;
+    /**
+     * The Script streaming map holds the pending script streamings by handle.
+     * Closing or resetting the V8 runtime cancels them and waits for them to be released
+     * before the V8 isolate is disposed.
+     *
+     * @since 5.0.4
+     */
+    final Map<Long, ScriptStreamingInputStream> scriptStreamingMap;
     /**
      * The V8 host.
      *
@@ -287,6 +345,12 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
      * @since 3.1.3
      */
     Object closeLock;
+    /**
+     * The Code cache rejected callback.
+     *
+     * @since 5.0.4
+     */
+    IJavetCodeCacheRejectedCallback codeCacheRejectedCallback;
     /**
      * The Converter.
      *
@@ -317,6 +381,12 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
      * @since 4.1.6
      */
     IJavetNearHeapLimitCallback nearHeapLimitCallback;
+    /**
+     * The Pending reference count.
+     *
+     * @since 5.0.4
+     */
+    int pendingReferenceCount;
     /**
      * The Pooled.
      *
@@ -329,6 +399,24 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
      * @since 0.8.3
      */
     IJavetPromiseRejectCallback promiseRejectCallback;
+    /**
+     * The Reference batch depth.
+     *
+     * @since 5.0.4
+     */
+    int referenceBatchDepth;
+    /**
+     * The Reference release deferred.
+     *
+     * @since 5.0.4
+     */
+    boolean referenceReleaseDeferred;
+    /**
+     * The V8 code cache.
+     *
+     * @since 5.0.4
+     */
+    V8CodeCache v8CodeCache;
     /**
      * The V8 inspector.
      *
@@ -370,6 +458,7 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         callbackContextLock = new Object();
         callbackContextMap = new HashMap<>();
         closeLock = new Object();
+        codeCacheRejectedCallback = null;
         converter = DEFAULT_CONVERTER;
         gcEpilogueCallbacks = new CopyOnWriteArrayList<>();
         gcPrologueCallbacks = new CopyOnWriteArrayList<>();
@@ -377,12 +466,18 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         this.runtimeOptions = Objects.requireNonNull(runtimeOptions);
         this.handle = handle;
         logger = new JavetDefaultLogger(getClass().getName());
+        pendingReferenceCount = 0;
+        pendingReferenceHandles = new long[DEFAULT_REFERENCE_RELEASE_BATCH_SIZE];
         this.pooled = pooled;
         primitiveFlags = new boolean[1];
         promiseRejectCallback = new JavetPromiseRejectCallback(logger);
+        referenceBatchDepth = 0;
         referenceLock = new Object();
+        referenceReleaseDeferred = false;
         referenceMap = new HashMap<>();
+        scriptStreamingMap = new HashMap<>();
         this.v8Host = Objects.requireNonNull(v8Host);
+        v8CodeCache = null;
         v8Inspector = null;
         this.v8Native = Objects.requireNonNull(v8Native);
         this.jsRuntimeType = Objects.requireNonNull(jsRuntimeType);
@@ -393,6 +488,36 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         initializeV8ValueCache();
     }
 
+    /**
+     * Acquire V8 backing store for an attachment.
+     * It must be released after the attachment.
+     *
+     * @param v8BackingStore the V8 backing store
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    void acquireV8BackingStore(V8BackingStore v8BackingStore) throws JavetException {
+        Objects.requireNonNull(v8BackingStore);
+        if (v8BackingStore.getV8Host() != v8Host || !v8BackingStore.acquire()) {
+            throw new JavetException(JavetError.RuntimeBackingStoreInvalid);
+        }
+    }
+
+    /**
+     * Acquire V8 external source for a compilation or an execution,
+     * so that a close in another thread cannot free the source while V8 reads it.
+     *
+     * @param v8ExternalSource the V8 external source
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    void acquireV8ExternalSource(V8ExternalSource v8ExternalSource) throws JavetException {
+        Objects.requireNonNull(v8ExternalSource);
+        if (v8ExternalSource.getV8Host() != v8Host || !v8ExternalSource.acquire()) {
+            throw new JavetException(JavetError.RuntimeExternalSourceInvalid);
+        }
+    }
+
     /**
      * Add GC epilogue callback.
      *
@@ -525,6 +650,21 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return false;
     }
 
+    /**
+     * Begin a reference batch.
+     * <p>
+     * The references closed within a batch are released in one JNI call
+     * when the outermost batch ends.
+     * Every call must be paired with {@link #endReferenceBatch()}.
+     *
+     * @since 5.0.4
+     */
+    public void beginReferenceBatch() {
+        synchronized (referenceLock) {
+            ++referenceBatchDepth;
+        }
+    }
+
     /**
      * Get the given range of items from the array.
      *
@@ -545,6 +685,119 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
                 v8Values, startIndex, endIndex);
     }
 
+    /**
+     * Get the given range of items from the array as booleans.
+     * Items that are not booleans are marked by false.
+     *
+     * @param iV8ValueArray the V8 value array
+     * @param values        the values
+     * @param validities    the validities of the values, or null
+     * @param startIndex    the start index
+     * @param endIndex      the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    int batchArrayGetBooleans(
+            IV8ValueArray iV8ValueArray, boolean[] values, boolean[] validities,
+            int startIndex, int endIndex)
+            throws JavetException {
+        return v8Native.batchArrayGetBooleans(
+                handle, iV8ValueArray.getHandle(), iV8ValueArray.getType().getId(),
+                values, validities, startIndex, endIndex);
+    }
+
+    /**
+     * Get the given range of items from the array as doubles.
+     * Items that are not numbers are marked by NaN.
+     *
+     * @param iV8ValueArray the V8 value array
+     * @param values        the values
+     * @param validities    the validities of the values, or null
+     * @param startIndex    the start index
+     * @param endIndex      the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    int batchArrayGetDoubles(
+            IV8ValueArray iV8ValueArray, double[] values, boolean[] validities,
+            int startIndex, int endIndex)
+            throws JavetException {
+        return v8Native.batchArrayGetDoubles(
+                handle, iV8ValueArray.getHandle(), iV8ValueArray.getType().getId(),
+                values, validities, startIndex, endIndex);
+    }
+
+    /**
+     * Get the given range of items from the array as integers.
+     * Items that are not 32-bit integers are marked by 0.
+     *
+     * @param iV8ValueArray the V8 value array
+     * @param values        the values
+     * @param validities    the validities of the values, or null
+     * @param startIndex    the start index
+     * @param endIndex      the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    int batchArrayGetIntegers(
+            IV8ValueArray iV8ValueArray, int[] values, boolean[] validities,
+            int startIndex, int endIndex)
+            throws JavetException {
+        return v8Native.batchArrayGetIntegers(
+                handle, iV8ValueArray.getHandle(), iV8ValueArray.getType().getId(),
+                values, validities, startIndex, endIndex);
+    }
+
+    /**
+     * Get the given range of items from the array as longs.
+     * Items that are neither integral numbers nor big integers within the range of long are marked by 0.
+     *
+     * @param iV8ValueArray the V8 value array
+     * @param values        the values
+     * @param validities    the validities of the values, or null
+     * @param startIndex    the start index
+     * @param endIndex      the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    int batchArrayGetLongs(
+            IV8ValueArray iV8ValueArray, long[] values, boolean[] validities,
+            int startIndex, int endIndex)
+            throws JavetException {
+        return v8Native.batchArrayGetLongs(
+                handle, iV8ValueArray.getHandle(), iV8ValueArray.getType().getId(),
+                values, validities, startIndex, endIndex);
+    }
+
+    /**
+     * Get the given range of items from the array as strings.
+     * Items that are not strings are marked by null.
+     *
+     * @param iV8ValueArray the V8 value array
+     * @param values        the values
+     * @param startIndex    the start index
+     * @param endIndex      the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    int batchArrayGetStrings(
+            IV8ValueArray iV8ValueArray, String[] values, int startIndex, int endIndex)
+            throws JavetException {
+        return v8Native.batchArrayGetStrings(
+                handle, iV8ValueArray.getHandle(), iV8ValueArray.getType().getId(),
+                values, startIndex, endIndex);
+    }
+
     /**
      * Batch get a range of values by keys.
      *
@@ -565,6 +818,137 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
                 v8ValueKeys, v8ValueValues, length);
     }
 
+    /**
+     * Batch get a range of values by keys as booleans.
+     * Values that are not booleans are marked by false.
+     *
+     * @param iV8ValueObject the V8 value object
+     * @param v8ValueKeys    the V8 value keys
+     * @param values         the values
+     * @param validities     the validities of the values, or null
+     * @param length         the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    int batchObjectGetBooleans(
+            IV8ValueObject iV8ValueObject, V8Value[] v8ValueKeys, boolean[] values, boolean[] validities,
+            int length)
+            throws JavetException {
+        return v8Native.batchObjectGetBooleans(
+                handle, iV8ValueObject.getHandle(), iV8ValueObject.getType().getId(),
+                v8ValueKeys, values, validities, length);
+    }
+
+    /**
+     * Batch get a range of values by keys as doubles.
+     * Values that are not numbers are marked by NaN.
+     *
+     * @param iV8ValueObject the V8 value object
+     * @param v8ValueKeys    the V8 value keys
+     * @param values         the values
+     * @param validities     the validities of the values, or null
+     * @param length         the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    int batchObjectGetDoubles(
+            IV8ValueObject iV8ValueObject, V8Value[] v8ValueKeys, double[] values, boolean[] validities,
+            int length)
+            throws JavetException {
+        return v8Native.batchObjectGetDoubles(
+                handle, iV8ValueObject.getHandle(), iV8ValueObject.getType().getId(),
+                v8ValueKeys, values, validities, length);
+    }
+
+    /**
+     * Batch get a range of values by keys as integers.
+     * Values that are not 32-bit integers are marked by 0.
+     *
+     * @param iV8ValueObject the V8 value object
+     * @param v8ValueKeys    the V8 value keys
+     * @param values         the values
+     * @param validities     the validities of the values, or null
+     * @param length         the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    int batchObjectGetIntegers(
+            IV8ValueObject iV8ValueObject, V8Value[] v8ValueKeys, int[] values, boolean[] validities,
+            int length)
+            throws JavetException {
+        return v8Native.batchObjectGetIntegers(
+                handle, iV8ValueObject.getHandle(), iV8ValueObject.getType().getId(),
+                v8ValueKeys, values, validities, length);
+    }
+
+    /**
+     * Batch get a range of values by keys as longs.
+     * Values that are neither integral numbers nor big integers within the range of long are marked by 0.
+     *
+     * @param iV8ValueObject the V8 value object
+     * @param v8ValueKeys    the V8 value keys
+     * @param values         the values
+     * @param validities     the validities of the values, or null
+     * @param length         the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    int batchObjectGetLongs(
+            IV8ValueObject iV8ValueObject, V8Value[] v8ValueKeys, long[] values, boolean[] validities,
+            int length)
+            throws JavetException {
+        return v8Native.batchObjectGetLongs(
+                handle, iV8ValueObject.getHandle(), iV8ValueObject.getType().getId(),
+                v8ValueKeys, values, validities, length);
+    }
+
+    /**
+     * Batch get a range of values by keys as strings.
+     * Values that are not strings are marked by null.
+     *
+     * @param iV8ValueObject the V8 value object
+     * @param v8ValueKeys    the V8 value keys
+     * @param values         the values
+     * @param length         the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    int batchObjectGetStrings(
+            IV8ValueObject iV8ValueObject, V8Value[] v8ValueKeys, String[] values, int length)
+            throws JavetException {
+        return v8Native.batchObjectGetStrings(
+                handle, iV8ValueObject.getHandle(), iV8ValueObject.getType().getId(),
+                v8ValueKeys, values, length);
+    }
+
+    /**
+     * Batch add values to a set.
+     * The batch stops at the first failure.
+     *
+     * @param iV8ValueSet the V8 value set
+     * @param v8Values    the V8 values
+     * @param length      the length
+     * @return the count of the values that are added
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    int batchSetAdd(IV8ValueSet iV8ValueSet, V8Value[] v8Values, int length) throws JavetException {
+        return v8Native.batchSetAdd(
+                handle, iV8ValueSet.getHandle(), iV8ValueSet.getType().getId(),
+                v8Values, length);
+    }
+
     /**
      * From boolean object to boolean.
      *
@@ -637,11 +1021,14 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
      */
     public void close(boolean forceClose) throws JavetException {
         if (!isClosed() && forceClose) {
-            removeAllReferences();
-            synchronized (closeLock) {
-                v8Host.closeV8Runtime(this);
-                handle = INVALID_HANDLE;
-                v8Native = null;
+            synchronized (scriptStreamingMap) {
+                releaseScriptStreamings();
+                removeAllReferences();
+                synchronized (closeLock) {
+                    v8Host.closeV8Runtime(this);
+                    handle = INVALID_HANDLE;
+                    v8Native = null;
+                }
             }
         }
     }
@@ -661,15 +1048,71 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
     public V8Module compileV8Module(
             String scriptString, byte[] cachedData, V8ScriptOrigin v8ScriptOrigin, boolean resultRequired)
             throws JavetException {
+        String key = null;
+        if (cachedData == null && v8CodeCache != null && resultRequired && !isClosed()) {
+            key = v8CodeCache.getKey(this, V8CodeCache.KIND_MODULE, scriptString, v8ScriptOrigin, null);
+            cachedData = v8CodeCache.get(key);
+            if (cachedData == null) {
+                V8Module v8Module = compileV8ModuleFromSource(scriptString, null, v8ScriptOrigin, true);
+                if (v8Module != null) {
+                    v8CodeCache.put(key, v8Module.getCachedData());
+                }
+                return v8Module;
+            }
+        }
+        V8Module v8Module = compileV8ModuleFromSource(scriptString, cachedData, v8ScriptOrigin, resultRequired);
+        if (v8ScriptOrigin.isCachedDataRejected()) {
+            refreshCachedData(key, scriptString, v8ScriptOrigin, v8Module);
+        }
+        return v8Module;
+    }
+
+    /**
+     * Compile a V8 module and add that V8 module to the internal V8 module map.
+     *
+     * @param v8ExternalSource the V8 external source
+     * @param cachedData       the cached data
+     * @param v8ScriptOrigin   the V8 script origin
+     * @param resultRequired   the result required
+     * @return the compiled V8 module or null
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    public V8Module compileV8Module(
+            V8ExternalSource v8ExternalSource, byte[] cachedData, V8ScriptOrigin v8ScriptOrigin, boolean resultRequired)
+            throws JavetException {
+        acquireV8ExternalSource(v8ExternalSource);
+        try {
+            return compileV8ModuleFromSource(v8ExternalSource, cachedData, v8ScriptOrigin, resultRequired);
+        } finally {
+            v8ExternalSource.release();
+        }
+    }
+
+    /**
+     * Compile a V8 module from a script string or a V8 external source.
+     *
+     * @param scriptSource   the script string or the V8 external source
+     * @param cachedData     the cached data
+     * @param v8ScriptOrigin the V8 script origin
+     * @param resultRequired the result required
+     * @return the compiled V8 module or null
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    private V8Module compileV8ModuleFromSource(
+            Object scriptSource, byte[] cachedData, V8ScriptOrigin v8ScriptOrigin, boolean resultRequired)
+            throws JavetException {
         if (!isClosed()) {
             v8ScriptOrigin.setModule(true);
             if (StringUtils.isEmpty(v8ScriptOrigin.getResourceName())) {
                 throw new JavetException(JavetError.ModuleNameEmpty);
             }
-            Object result = v8Native.moduleCompile(
-                    handle, scriptString, cachedData, resultRequired, v8ScriptOrigin.getResourceName(),
+            Object result = consumeCachedData(cachedData, v8ScriptOrigin, () -> v8Native.moduleCompile(
+                    handle, scriptSource, cachedData, resultRequired, v8ScriptOrigin.getResourceName(),
                     v8ScriptOrigin.getResourceLineOffset(), v8ScriptOrigin.getResourceColumnOffset(),
-                    v8ScriptOrigin.getScriptId(), v8ScriptOrigin.isWasm(), v8ScriptOrigin.isModule());
+                    v8ScriptOrigin.getScriptId(), v8ScriptOrigin.isWasm(), v8ScriptOrigin.isModule()));
             V8Module v8Module = null;
             if (resultRequired && result instanceof V8Module) {
                 v8Module = (V8Module) result;
@@ -692,16 +1135,219 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
      * @since 0.9.13
      */
     @CheckReturnValue
-    @SuppressWarnings("RedundantThrows")
     public V8Script compileV8Script(
             String scriptString, byte[] cachedData, V8ScriptOrigin v8ScriptOrigin, boolean resultRequired)
             throws JavetException {
+        String key = null;
+        // Recording the compile hints requires a compilation from scratch.
+        if (cachedData == null && v8CodeCache != null && !v8ScriptOrigin.isProduceCompileHints() && !isClosed()) {
+            key = v8CodeCache.getKey(this, V8CodeCache.KIND_SCRIPT, scriptString, v8ScriptOrigin, null);
+            cachedData = v8CodeCache.get(key);
+            if (cachedData == null) {
+                V8Script v8Script = compileV8ScriptFromSource(scriptString, null, v8ScriptOrigin, true);
+                if (v8Script != null) {
+                    v8CodeCache.put(key, v8Script.getCachedData());
+                    if (!resultRequired) {
+                        v8Script.close();
+                        v8Script = null;
+                    }
+                }
+                return v8Script;
+            }
+        }
+        V8Script v8Script = compileV8ScriptFromSource(scriptString, cachedData, v8ScriptOrigin, resultRequired);
+        if (v8ScriptOrigin.isCachedDataRejected()) {
+            refreshCachedData(key, scriptString, v8ScriptOrigin, v8Script);
+        }
+        return v8Script;
+    }
+
+    /**
+     * Compile a V8 script.
+     *
+     * @param v8ExternalSource the V8 external source
+     * @param cachedData       the cached data
+     * @param v8ScriptOrigin   the V8 script origin
+     * @param resultRequired   the result required
+     * @return the V8 script
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    public V8Script compileV8Script(
+            V8ExternalSource v8ExternalSource, byte[] cachedData, V8ScriptOrigin v8ScriptOrigin, boolean resultRequired)
+            throws JavetException {
+        acquireV8ExternalSource(v8ExternalSource);
+        try {
+            return compileV8ScriptFromSource(v8ExternalSource, cachedData, v8ScriptOrigin, resultRequired);
+        } finally {
+            v8ExternalSource.release();
+        }
+    }
+
+    /**
+     * Compile a V8 script asynchronously from an input stream of UTF-8 bytes.
+     * <p>
+     * The source is read incrementally and parsed by V8 on a thread of the given executor
+     * without holding the V8 isolate lock, so that the parsing overlaps the I/O
+     * and the V8 runtime keeps serving other calls in the meantime.
+     * The compilation is finished under the lock on the same thread.
+     * The eager compile and the compile hints of the V8 script origin apply to the background parsing.
+     * The input stream is not closed.
+     * <p>
+     * Closing or resetting the V8 runtime stops feeding the pending parsing, interrupts the thread
+     * that reads the input stream, waits for it and completes the future with {@link JavetError#RuntimeAlreadyClosed}.
+     * A read that blocks must be interruptible, e.g. a stream of an interruptible channel,
+     * otherwise closing or resetting the V8 runtime fails with {@link JavetError#RuntimeCloseFailure}
+     * after 5 seconds and the V8 isolate is kept alive.
+     *
+     * @param inputStream    the input stream
+     * @param v8ScriptOrigin the V8 script origin
+     * @param executor       the executor that runs the parsing
+     * @return the future of the V8 script
+     * @since 5.0.4
+     */
+    public CompletableFuture<V8Script> compileV8ScriptAsync(
+            InputStream inputStream, V8ScriptOrigin v8ScriptOrigin, Executor executor) {
+        Objects.requireNonNull(inputStream);
+        Objects.requireNonNull(v8ScriptOrigin);
+        Objects.requireNonNull(executor);
+        CompletableFuture<V8Script> future = new CompletableFuture<>();
+        v8ScriptOrigin.setModule(false);
+        final ScriptStreamingInputStream scriptStreamingInputStream = new ScriptStreamingInputStream(inputStream);
+        final long scriptStreamingHandle;
+        synchronized (scriptStreamingMap) {
+            if (isClosed()) {
+                future.completeExceptionally(new JavetException(JavetError.RuntimeAlreadyClosed));
+                return future;
+            }
+            scriptStreamingHandle = v8Native.scriptStreamingCreate(
+                    handle, scriptStreamingInputStream, DEFAULT_SCRIPT_STREAMING_BUFFER_SIZE,
+                    v8ScriptOrigin.getCompileOptions(), v8ScriptOrigin.getCompileHintPositions());
+            scriptStreamingMap.put(scriptStreamingHandle, scriptStreamingInputStream);
+        }
+        try {
+            executor.execute(() -> {
+                synchronized (scriptStreamingMap) {
+                    if (!scriptStreamingMap.containsKey(scriptStreamingHandle)) {
+                        // The V8 runtime has been closed or reset before the parsing started.
+                        future.completeExceptionally(new JavetException(JavetError.RuntimeAlreadyClosed));
+                        return;
+                    }
+                    scriptStreamingInputStream.setStarted();
+                }
+                V8Script v8Script = null;
+                Throwable throwable = null;
+                try {
+                    v8Native.scriptStreamingRun(scriptStreamingHandle);
+                    if (scriptStreamingInputStream.isCancelled()) {
+                        throw new JavetException(JavetError.RuntimeAlreadyClosed);
+                    }
+                    v8Script = (V8Script) v8Native.scriptStreamingFinish(
+                            handle, scriptStreamingHandle, v8ScriptOrigin.getResourceName(),
+                            v8ScriptOrigin.getResourceLineOffset(), v8ScriptOrigin.getResourceColumnOffset(),
+                            v8ScriptOrigin.getScriptId());
+                } catch (Throwable t) {
+                    // A read aborted by the cancellation is reported as closed as well.
+                    throwable = scriptStreamingInputStream.isCancelled()
+                            ? new JavetException(JavetError.RuntimeAlreadyClosed)
+                            : t;
+                } finally {
+                    // The V8 isolate stays alive until the pending script streaming is removed.
+                    v8Native.scriptStreamingRelease(handle, scriptStreamingHandle);
+                    synchronized (scriptStreamingMap) {
+                        scriptStreamingMap.remove(scriptStreamingHandle);
+                        scriptStreamingMap.notifyAll();
+                        if (scriptStreamingInputStream.isCancelled()) {
+                            // The interrupt of the cancellation must not leak to the next task of the executor.
+                            //noinspection ResultOfMethodCallIgnored
+                            Thread.interrupted();
+                        }
+                    }
+                }
+                if (throwable == null) {
+                    future.complete(v8Script);
+                } else {
+                    future.completeExceptionally(throwable);
+                }
+            });
+        } catch (RejectedExecutionException e) {
+            synchronized (scriptStreamingMap) {
+                if (scriptStreamingMap.remove(scriptStreamingHandle) != null) {
+                    v8Native.scriptStreamingRelease(handle, scriptStreamingHandle);
+                }
+            }
+            future.completeExceptionally(e);
+        }
+        return future;
+    }
+
+    /**
+     * Compile a V8 script asynchronously from a file of UTF-8 bytes.
+     * The file is memory mapped and streamed to V8 without being copied into a Java string.
+     *
+     * @param scriptPath     the script path
+     * @param v8ScriptOrigin the V8 script origin
+     * @param executor       the executor that runs the parsing
+     * @return the future of the V8 script
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public CompletableFuture<V8Script> compileV8ScriptAsync(
+            Path scriptPath, V8ScriptOrigin v8ScriptOrigin, Executor executor)
+            throws JavetException {
+        Objects.requireNonNull(scriptPath);
+        MappedByteBuffer mappedByteBuffer;
+        try (FileChannel fileChannel = FileChannel.open(scriptPath, StandardOpenOption.READ)) {
+            mappedByteBuffer = fileChannel.map(FileChannel.MapMode.READ_ONLY, 0, fileChannel.size());
+        } catch (IOException e) {
+            throw new JavetException(
+                    JavetError.FailedToReadPath,
+                    SimpleMap.of(JavetError.PARAMETER_PATH, scriptPath),
+                    e);
+        }
+        return compileV8ScriptAsync(new ByteBufferInputStream(mappedByteBuffer), v8ScriptOrigin, executor);
+    }
+
+    /**
+     * Compile a V8 script asynchronously from a readable byte channel of UTF-8 bytes.
+     * The channel is not closed, except that an interruptible channel is closed by the interrupt
+     * if the V8 runtime is closed or reset while the channel is being read.
+     *
+     * @param readableByteChannel the readable byte channel
+     * @param v8ScriptOrigin      the V8 script origin
+     * @param executor            the executor that runs the parsing
+     * @return the future of the V8 script
+     * @since 5.0.4
+     */
+    public CompletableFuture<V8Script> compileV8ScriptAsync(
+            ReadableByteChannel readableByteChannel, V8ScriptOrigin v8ScriptOrigin, Executor executor) {
+        return compileV8ScriptAsync(
+                Channels.newInputStream(Objects.requireNonNull(readableByteChannel)), v8ScriptOrigin, executor);
+    }
+
+    /**
+     * Compile a V8 script from a script string or a V8 external source.
+     *
+     * @param scriptSource   the script string or the V8 external source
+     * @param cachedData     the cached data
+     * @param v8ScriptOrigin the V8 script origin
+     * @param resultRequired the result required
+     * @return the V8 script
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    private V8Script compileV8ScriptFromSource(
+            Object scriptSource, byte[] cachedData, V8ScriptOrigin v8ScriptOrigin, boolean resultRequired)
+            throws JavetException {
         if (!isClosed()) {
             v8ScriptOrigin.setModule(false);
-            return (V8Script) v8Native.scriptCompile(
-                    handle, scriptString, cachedData, resultRequired, v8ScriptOrigin.getResourceName(),
+            return (V8Script) consumeCachedData(cachedData, v8ScriptOrigin, () -> v8Native.scriptCompile(
+                    handle, scriptSource, cachedData, resultRequired, v8ScriptOrigin.getResourceName(),
                     v8ScriptOrigin.getResourceLineOffset(), v8ScriptOrigin.getResourceColumnOffset(),
-                    v8ScriptOrigin.getScriptId(), v8ScriptOrigin.isWasm(), v8ScriptOrigin.isModule());
+                    v8ScriptOrigin.getScriptId(), v8ScriptOrigin.isWasm(), v8ScriptOrigin.isModule(),
+                    v8ScriptOrigin.getCompileOptions(), v8ScriptOrigin.getCompileHintPositions()));
         }
         return null;
     }
@@ -719,21 +1365,113 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
      * @since 2.0.3
      */
     @CheckReturnValue
-    @SuppressWarnings("RedundantThrows")
     public V8ValueFunction compileV8ValueFunction(
             String scriptString, byte[] cachedData, V8ScriptOrigin v8ScriptOrigin,
             String[] arguments, V8ValueObject[] contextExtensions)
             throws JavetException {
+        String key = null;
+        if (cachedData == null && v8CodeCache != null && !isClosed()) {
+            key = v8CodeCache.getKey(this, V8CodeCache.KIND_FUNCTION, scriptString, v8ScriptOrigin, arguments);
+            cachedData = v8CodeCache.get(key);
+            if (cachedData == null) {
+                V8ValueFunction v8ValueFunction = compileV8ValueFunctionFromSource(
+                        scriptString, null, v8ScriptOrigin, arguments, contextExtensions);
+                if (v8ValueFunction != null) {
+                    v8CodeCache.put(key, v8ValueFunction.getCachedData());
+                }
+                return v8ValueFunction;
+            }
+        }
+        V8ValueFunction v8ValueFunction = compileV8ValueFunctionFromSource(
+                scriptString, cachedData, v8ScriptOrigin, arguments, contextExtensions);
+        if (v8ScriptOrigin.isCachedDataRejected()) {
+            refreshCachedData(key, scriptString, v8ScriptOrigin, v8ValueFunction);
+        }
+        return v8ValueFunction;
+    }
+
+    /**
+     * Compile V8 value function.
+     *
+     * @param v8ExternalSource  the V8 external source
+     * @param cachedData        the cached data
+     * @param v8ScriptOrigin    the V8 script origin
+     * @param arguments         the arguments
+     * @param contextExtensions the context extensions
+     * @return the V8 value function
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    public V8ValueFunction compileV8ValueFunction(
+            V8ExternalSource v8ExternalSource, byte[] cachedData, V8ScriptOrigin v8ScriptOrigin,
+            String[] arguments, V8ValueObject[] contextExtensions)
+            throws JavetException {
+        acquireV8ExternalSource(v8ExternalSource);
+        try {
+            return compileV8ValueFunctionFromSource(v8ExternalSource, cachedData, v8ScriptOrigin, arguments, contextExtensions);
+        } finally {
+            v8ExternalSource.release();
+        }
+    }
+
+    /**
+     * Compile V8 value function from a script string or a V8 external source.
+     *
+     * @param scriptSource      the script string or the V8 external source
+     * @param cachedData        the cached data
+     * @param v8ScriptOrigin    the V8 script origin
+     * @param arguments         the arguments
+     * @param contextExtensions the context extensions
+     * @return the V8 value function
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    private V8ValueFunction compileV8ValueFunctionFromSource(
+            Object scriptSource, byte[] cachedData, V8ScriptOrigin v8ScriptOrigin,
+            String[] arguments, V8ValueObject[] contextExtensions)
+            throws JavetException {
         if (!isClosed()) {
-            return (V8ValueFunction) v8Native.functionCompile(
-                    handle, scriptString, cachedData, v8ScriptOrigin.getResourceName(),
+            return (V8ValueFunction) consumeCachedData(cachedData, v8ScriptOrigin, () -> v8Native.functionCompile(
+                    handle, scriptSource, cachedData, v8ScriptOrigin.getResourceName(),
                     v8ScriptOrigin.getResourceLineOffset(), v8ScriptOrigin.getResourceColumnOffset(),
                     v8ScriptOrigin.getScriptId(), v8ScriptOrigin.isWasm(),
-                    arguments, contextExtensions);
+                    arguments, contextExtensions));
         }
         return null;
     }
 
+    /**
+     * Consume cached data via the given native call and record in the V8 script origin
+     * whether V8 rejected the cached data.
+     *
+     * @param <T>            the type parameter
+     * @param cachedData     the cached data
+     * @param v8ScriptOrigin the V8 script origin
+     * @param supplier       the native call
+     * @return the result of the native call
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    private <T> T consumeCachedData(
+            byte[] cachedData, V8ScriptOrigin v8ScriptOrigin, IJavetSupplier<T, JavetException> supplier)
+            throws JavetException {
+        if (cachedData == null) {
+            v8ScriptOrigin.setCachedDataRejected(false);
+            return supplier.get();
+        }
+        // The flag of an outer call, e.g. a script that calls back to Java which compiles again, is restored.
+        final Boolean outerCodeCacheRejected = CODE_CACHE_REJECTED.get();
+        CODE_CACHE_REJECTED.set(Boolean.FALSE);
+        try {
+            return supplier.get();
+        } finally {
+            v8ScriptOrigin.setCachedDataRejected(CODE_CACHE_REJECTED.get());
+            CODE_CACHE_REJECTED.set(outerCodeCacheRejected);
+        }
+    }
+
     /**
      * Contains a V8 module by resource name.
      *
@@ -859,6 +1597,61 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return null;
     }
 
+    @SuppressWarnings("RedundantThrows")
+    @CheckReturnValue
+    @Override
+    public V8ValueArray createV8ValueArray(boolean[] booleans) throws JavetException {
+        Objects.requireNonNull(booleans);
+        if (!isClosed()) {
+            return (V8ValueArray) v8Native.arrayCreateFromBooleans(handle, booleans);
+        }
+        return null;
+    }
+
+    @SuppressWarnings("RedundantThrows")
+    @CheckReturnValue
+    @Override
+    public V8ValueArray createV8ValueArray(double[] doubles) throws JavetException {
+        Objects.requireNonNull(doubles);
+        if (!isClosed()) {
+            return (V8ValueArray) v8Native.arrayCreateFromDoubles(handle, doubles);
+        }
+        return null;
+    }
+
+    @SuppressWarnings("RedundantThrows")
+    @CheckReturnValue
+    @Override
+    public V8ValueArray createV8ValueArray(int[] integers) throws JavetException {
+        Objects.requireNonNull(integers);
+        if (!isClosed()) {
+            return (V8ValueArray) v8Native.arrayCreateFromIntegers(handle, integers);
+        }
+        return null;
+    }
+
+    @SuppressWarnings("RedundantThrows")
+    @CheckReturnValue
+    @Override
+    public V8ValueArray createV8ValueArray(long[] longs) throws JavetException {
+        Objects.requireNonNull(longs);
+        if (!isClosed()) {
+            return (V8ValueArray) v8Native.arrayCreateFromLongs(handle, longs);
+        }
+        return null;
+    }
+
+    @SuppressWarnings("RedundantThrows")
+    @CheckReturnValue
+    @Override
+    public V8ValueArray createV8ValueArray(String[] strings) throws JavetException {
+        Objects.requireNonNull(strings);
+        if (!isClosed()) {
+            return (V8ValueArray) v8Native.arrayCreateFromStrings(handle, strings);
+        }
+        return null;
+    }
+
     @SuppressWarnings("RedundantThrows")
     @CheckReturnValue
     @Override
@@ -881,6 +1674,29 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return null;
     }
 
+    /**
+     * Create a V8 value array buffer from a V8 backing store without copying.
+     * A shared V8 backing store is attached as a V8 value shared array buffer.
+     * The same V8 backing store can be attached in every V8 runtime of the same V8 host.
+     *
+     * @param v8BackingStore the V8 backing store
+     * @return the V8 value array buffer
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    public V8ValueArrayBuffer createV8ValueArrayBuffer(V8BackingStore v8BackingStore) throws JavetException {
+        if (!isClosed()) {
+            acquireV8BackingStore(v8BackingStore);
+            try {
+                return (V8ValueArrayBuffer) v8Native.backingStoreAttach(handle, v8BackingStore.getHandle());
+            } finally {
+                v8BackingStore.release();
+            }
+        }
+        return null;
+    }
+
     @Override
     public V8ValueBigInteger createV8ValueBigInteger(BigInteger bigInteger) throws JavetException {
         return new V8ValueBigInteger(this, bigInteger);
@@ -1128,6 +1944,42 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         throw new JavetException(JavetError.NotSupported, SimpleMap.of(PARAMETER_FEATURE, type.getName()));
     }
 
+    @Override
+    @CheckReturnValue
+    public V8ValueTypedArray createV8ValueTypedArray(double[] doubles) throws JavetException {
+        Objects.requireNonNull(doubles);
+        V8ValueTypedArray v8ValueTypedArray = createV8ValueTypedArray(V8ValueReferenceType.Float64Array, doubles.length);
+        if (doubles.length > 0 && !v8ValueTypedArray.fromDoubles(0, doubles, 0, doubles.length)) {
+            v8ValueTypedArray.close();
+            throw new JavetException(JavetError.NotSupported, SimpleMap.of(PARAMETER_FEATURE, "Float64Array"));
+        }
+        return v8ValueTypedArray;
+    }
+
+    @Override
+    @CheckReturnValue
+    public V8ValueTypedArray createV8ValueTypedArray(int[] integers) throws JavetException {
+        Objects.requireNonNull(integers);
+        V8ValueTypedArray v8ValueTypedArray = createV8ValueTypedArray(V8ValueReferenceType.Int32Array, integers.length);
+        if (integers.length > 0 && !v8ValueTypedArray.fromIntegers(0, integers, 0, integers.length)) {
+            v8ValueTypedArray.close();
+            throw new JavetException(JavetError.NotSupported, SimpleMap.of(PARAMETER_FEATURE, "Int32Array"));
+        }
+        return v8ValueTypedArray;
+    }
+
+    @Override
+    @CheckReturnValue
+    public V8ValueTypedArray createV8ValueTypedArray(long[] longs) throws JavetException {
+        Objects.requireNonNull(longs);
+        V8ValueTypedArray v8ValueTypedArray = createV8ValueTypedArray(V8ValueReferenceType.BigInt64Array, longs.length);
+        if (longs.length > 0 && !v8ValueTypedArray.fromLongs(0, longs, 0, longs.length)) {
+            v8ValueTypedArray.close();
+            throw new JavetException(JavetError.NotSupported, SimpleMap.of(PARAMETER_FEATURE, "BigInt64Array"));
+        }
+        return v8ValueTypedArray;
+    }
+
     @Override
     public V8ValueUndefined createV8ValueUndefined() {
         if (!isClosed()) {
@@ -1146,6 +1998,30 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return new V8ValueZonedDateTime(this, zonedDateTime);
     }
 
+    /**
+     * Deserialize a V8 value with the V8 value deserializer from a direct byte buffer.
+     * <p>
+     * The whole value graph in the V8 wire format is materialized in one native call.
+     * Invalid or truncated data is reported with {@link JavetError#RuntimeSerializedDataInvalid}
+     * or the deserialization error thrown by V8, never as undefined.
+     *
+     * @param <T>        the type parameter
+     * @param byteBuffer the direct byte buffer with the serialized data starting at index 0
+     * @param length     the length of the serialized data
+     * @return the V8 value
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    @CheckReturnValue
+    public <T extends V8Value> T deserialize(ByteBuffer byteBuffer, int length) throws JavetException {
+        Objects.requireNonNull(byteBuffer);
+        if (!byteBuffer.isDirect()) {
+            throw new IllegalArgumentException(ERROR_BYTE_BUFFER_MUST_BE_DIRECT);
+        }
+        return (T) v8Native.valueDeserialize(handle, byteBuffer, length);
+    }
+
     /**
      * From double object to either double or integer.
      *
@@ -1158,6 +2034,25 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
                 handle, Objects.requireNonNull(v8ValueDoubleObject).getHandle(), v8ValueDoubleObject.getType().getId());
     }
 
+    /**
+     * End a reference batch.
+     * <p>
+     * The pending references are released when the outermost batch ends,
+     * unless the reference release is deferred.
+     *
+     * @since 5.0.4
+     */
+    public void endReferenceBatch() {
+        synchronized (referenceLock) {
+            if (referenceBatchDepth > 0) {
+                --referenceBatchDepth;
+            }
+            if (referenceBatchDepth == 0 && !referenceReleaseDeferred) {
+                flushReferences();
+            }
+        }
+    }
+
     /**
      * Equals tells whether 2 references are reference equal or not.
      *
@@ -1189,17 +2084,84 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
     public <T extends V8Value> T execute(
             String scriptString, byte[] cachedData, V8ScriptOrigin v8ScriptOrigin, boolean resultRequired)
             throws JavetException {
+        String key = null;
+        if (cachedData == null && v8CodeCache != null && !v8ScriptOrigin.isModule()
+                && !v8ScriptOrigin.isProduceCompileHints() && !isClosed()) {
+            key = v8CodeCache.getKey(this, V8CodeCache.KIND_SCRIPT, scriptString, v8ScriptOrigin, null);
+            cachedData = v8CodeCache.get(key);
+            if (cachedData == null) {
+                try (V8Script v8Script = compileV8ScriptFromSource(scriptString, null, v8ScriptOrigin, true)) {
+                    T result = v8Script.execute(resultRequired);
+                    // The code cache created after the execution includes the lazily compiled functions.
+                    v8CodeCache.put(key, v8Script.getCachedData());
+                    return result;
+                }
+            }
+        }
+        T result = executeFromSource(scriptString, cachedData, v8ScriptOrigin, resultRequired);
+        if (cachedData != null && v8ScriptOrigin.isCachedDataRejected() && !v8ScriptOrigin.isModule()
+                && (key != null || codeCacheRejectedCallback != null) && !isClosed()) {
+            // Only a rejected code cache pays for another compile that produces a fresh code cache.
+            try (V8Script v8Script = compileV8ScriptFromSource(scriptString, null, v8ScriptOrigin, true)) {
+                refreshCachedData(key, scriptString, v8ScriptOrigin, v8Script);
+            } finally {
+                v8ScriptOrigin.setCachedDataRejected(true);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Execute a script or module.
+     *
+     * @param <T>              the type parameter
+     * @param v8ExternalSource the V8 external source
+     * @param cachedData       the cached data
+     * @param v8ScriptOrigin   the V8 script origin
+     * @param resultRequired   the result required
+     * @return the result
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    public <T extends V8Value> T execute(
+            V8ExternalSource v8ExternalSource, byte[] cachedData, V8ScriptOrigin v8ScriptOrigin, boolean resultRequired)
+            throws JavetException {
+        acquireV8ExternalSource(v8ExternalSource);
+        try {
+            return executeFromSource(v8ExternalSource, cachedData, v8ScriptOrigin, resultRequired);
+        } finally {
+            v8ExternalSource.release();
+        }
+    }
+
+    /**
+     * Execute a script or module from a script string or a V8 external source.
+     *
+     * @param <T>            the type parameter
+     * @param scriptSource   the script string or the V8 external source
+     * @param cachedData     the cached data
+     * @param v8ScriptOrigin the V8 script origin
+     * @param resultRequired the result required
+     * @return the result
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    private <T extends V8Value> T executeFromSource(
+            Object scriptSource, byte[] cachedData, V8ScriptOrigin v8ScriptOrigin, boolean resultRequired)
+            throws JavetException {
         if (!isClosed()) {
             if (v8ScriptOrigin.isModule()) {
-                return (T) v8Native.moduleExecute(
-                        handle, scriptString, cachedData, resultRequired, v8ScriptOrigin.getResourceName(),
+                return (T) consumeCachedData(cachedData, v8ScriptOrigin, () -> v8Native.moduleExecute(
+                        handle, scriptSource, cachedData, resultRequired, v8ScriptOrigin.getResourceName(),
                         v8ScriptOrigin.getResourceLineOffset(), v8ScriptOrigin.getResourceColumnOffset(),
-                        v8ScriptOrigin.getScriptId(), v8ScriptOrigin.isWasm());
+                        v8ScriptOrigin.getScriptId(), v8ScriptOrigin.isWasm()));
             } else {
-                return (T) v8Native.scriptExecute(
-                        handle, scriptString, cachedData, resultRequired, v8ScriptOrigin.getResourceName(),
+                return (T) consumeCachedData(cachedData, v8ScriptOrigin, () -> v8Native.scriptExecute(
+                        handle, scriptSource, cachedData, resultRequired, v8ScriptOrigin.getResourceName(),
                         v8ScriptOrigin.getResourceLineOffset(), v8ScriptOrigin.getResourceColumnOffset(),
-                        v8ScriptOrigin.getScriptId(), v8ScriptOrigin.isWasm());
+                        v8ScriptOrigin.getScriptId(), v8ScriptOrigin.isWasm(),
+                        v8ScriptOrigin.getCompileOptions(), v8ScriptOrigin.getCompileHintPositions()));
             }
         }
         return null;
@@ -1248,6 +2210,22 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
                 handle, iV8ValueObject.getHandle(), iV8ValueObject.getType().getId(), v8Values);
     }
 
+    /**
+     * Release the pending references in one JNI call.
+     *
+     * @since 5.0.4
+     */
+    public void flushReferences() {
+        synchronized (referenceLock) {
+            if (pendingReferenceCount > 0) {
+                if (!isClosed()) {
+                    v8Native.removeReferenceHandles(handle, pendingReferenceHandles, pendingReferenceCount);
+                }
+                pendingReferenceCount = 0;
+            }
+        }
+    }
+
     /**
      * Can discard compiled byte code of a function.
      *
@@ -1521,6 +2499,16 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return callbackContextMap.size();
     }
 
+    /**
+     * Gets code cache rejected callback.
+     *
+     * @return the code cache rejected callback or null
+     * @since 5.0.4
+     */
+    public IJavetCodeCacheRejectedCallback getCodeCacheRejectedCallback() {
+        return codeCacheRejectedCallback;
+    }
+
     /**
      * Gets close lock.
      *
@@ -1576,6 +2564,29 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return new V8StringExecutor(this, scriptString);
     }
 
+    /**
+     * Gets an executor by a V8 external source.
+     *
+     * @param v8ExternalSource the V8 external source
+     * @return the executor
+     * @since 5.0.4
+     */
+    public IV8Executor getExecutor(V8ExternalSource v8ExternalSource) {
+        return new V8ExternalSourceExecutor(this, v8ExternalSource);
+    }
+
+    /**
+     * Gets an executor by a V8 external source and cached data.
+     *
+     * @param v8ExternalSource the V8 external source
+     * @param cachedData       the cached data
+     * @return the executor
+     * @since 5.0.4
+     */
+    public IV8Executor getExecutor(V8ExternalSource v8ExternalSource, byte[] cachedData) {
+        return new V8ExternalSourceExecutor(this, v8ExternalSource, cachedData);
+    }
+
     /**
      * Gets executor by a script string and cached data.
      *
@@ -1703,6 +2714,16 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return promiseRejectCallback;
     }
 
+    /**
+     * Gets the pending reference count.
+     *
+     * @return the pending reference count
+     * @since 5.0.4
+     */
+    public int getPendingReferenceCount() {
+        return pendingReferenceCount;
+    }
+
     /**
      * Gets the internal reference count.
      *
@@ -1723,6 +2744,31 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return runtimeOptions;
     }
 
+    /**
+     * Gets V8 array buffer statistics of this V8 runtime.
+     * It is a sync call that reads the counters of the per-runtime array buffer allocator
+     * without locking the V8 runtime.
+     *
+     * @return the V8 array buffer statistics, or null if the V8 runtime is closed or in Node.js mode
+     * @since 5.0.4
+     */
+    public V8ArrayBufferStatistics getV8ArrayBufferStatistics() {
+        if (!isClosed()) {
+            return (V8ArrayBufferStatistics) v8Native.getV8ArrayBufferStatistics(handle);
+        }
+        return null;
+    }
+
+    /**
+     * Gets V8 code cache.
+     *
+     * @return the V8 code cache or null if not set
+     * @since 5.0.4
+     */
+    public V8CodeCache getV8CodeCache() {
+        return v8CodeCache;
+    }
+
     /**
      * Gets V8 heap space statistics by an allocation space via completable future.
      * It is an async call that will be completed if there is no race condition.
@@ -1876,6 +2922,21 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return v8ModuleResolver;
     }
 
+    /**
+     * Gets V8 property key cache statistics of this V8 runtime.
+     * It is a sync call that reads the counters of the per-runtime property key cache
+     * without locking the V8 runtime.
+     *
+     * @return the V8 property key cache statistics, or null if the V8 runtime is closed
+     * @since 5.0.4
+     */
+    public V8PropertyKeyCacheStatistics getV8PropertyKeyCacheStatistics() {
+        if (!isClosed()) {
+            return (V8PropertyKeyCacheStatistics) v8Native.getV8PropertyKeyCacheStatistics(handle);
+        }
+        return null;
+    }
+
     /**
      * Gets V8 scope.
      *
@@ -1896,6 +2957,21 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return v8Host.getV8SharedMemoryStatistics();
     }
 
+    /**
+     * Gets V8 unbound script cache statistics of this V8 runtime.
+     * It is a sync call that reads the counters of the per-isolate unbound script cache
+     * without locking the V8 runtime.
+     *
+     * @return the V8 unbound script cache statistics, or null if the V8 runtime is closed
+     * @since 5.0.4
+     */
+    public V8UnboundScriptCacheStatistics getV8UnboundScriptCacheStatistics() {
+        if (!isClosed()) {
+            return (V8UnboundScriptCacheStatistics) v8Native.getV8UnboundScriptCacheStatistics(handle);
+        }
+        return null;
+    }
+
     /**
      * Gets the V8 version.
      *
@@ -2102,6 +3178,16 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return pooled;
     }
 
+    /**
+     * Returns whether the reference release is deferred or not.
+     *
+     * @return true : deferred, false : not deferred
+     * @since 5.0.4
+     */
+    public boolean isReferenceReleaseDeferred() {
+        return referenceReleaseDeferred;
+    }
+
     /**
      * Returns whether the reference is weak or not.
      *
@@ -2113,6 +3199,93 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return v8Native.isWeak(handle, iV8ValueReference.getHandle(), iV8ValueReference.getType().getId());
     }
 
+    /**
+     * Parse the UTF-8 JSON between the position and the limit of a direct byte buffer.
+     * The bytes are decoded by V8 directly without an intermediate Java string.
+     * The position of the byte buffer is moved to the limit on success.
+     *
+     * @param <T>        the type parameter
+     * @param byteBuffer the direct byte buffer
+     * @return the parsed V8 value
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public <T extends V8Value> T jsonParse(ByteBuffer byteBuffer) throws JavetException {
+        Objects.requireNonNull(byteBuffer);
+        if (!byteBuffer.isDirect()) {
+            throw new IllegalArgumentException(ERROR_BYTE_BUFFER_MUST_BE_DIRECT);
+        }
+        final int position = byteBuffer.position();
+        final int length = byteBuffer.remaining();
+        T v8Value = (T) v8Native.jsonParse(handle, byteBuffer, position, length);
+        ((Buffer) byteBuffer).position(position + length);
+        return v8Value;
+    }
+
+    /**
+     * Stringify a V8 value as UTF-8 JSON to a direct byte buffer from its position.
+     * <p>
+     * If the returned length is not greater than the remaining of the byte buffer,
+     * the JSON is written and the position of the byte buffer is moved forward by that length.
+     * Otherwise, nothing is written and the position stays unchanged,
+     * so that the caller can resume with a byte buffer that has at least that many bytes remaining.
+     * Resuming stringifies the value again, so that toJSON() and getters run once more.
+     * Use {@link #jsonStringifyGrowable(IV8ValueReference, ByteBuffer)} to stringify the value only once.
+     *
+     * @param iV8ValueReference the V8 value reference
+     * @param byteBuffer        the direct byte buffer
+     * @return the length of the UTF-8 JSON, or -1 if the value cannot be stringified
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public int jsonStringify(IV8ValueReference iV8ValueReference, ByteBuffer byteBuffer) throws JavetException {
+        Objects.requireNonNull(byteBuffer);
+        if (!byteBuffer.isDirect()) {
+            throw new IllegalArgumentException(ERROR_BYTE_BUFFER_MUST_BE_DIRECT);
+        }
+        final int position = byteBuffer.position();
+        final int length = v8Native.jsonStringify(
+                handle, iV8ValueReference.getHandle(), iV8ValueReference.getType().getId(),
+                byteBuffer, position, byteBuffer.limit());
+        if (length >= 0 && length <= byteBuffer.remaining()) {
+            ((Buffer) byteBuffer).position(position + length);
+        }
+        return length;
+    }
+
+    /**
+     * Stringify a V8 value as UTF-8 JSON to a growable direct byte buffer from its position.
+     * <p>
+     * The value is stringified only once. If the JSON doesn't fit before the limit of the byte buffer,
+     * a larger direct byte buffer is allocated, the written bytes before the position are copied to it
+     * and the JSON is written to it.
+     * The returned byte buffer has its position right after the JSON.
+     * If the value cannot be stringified, nothing is written.
+     *
+     * @param iV8ValueReference the V8 value reference
+     * @param byteBuffer        the direct byte buffer
+     * @return the byte buffer that holds the JSON, which may not be the given one
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public ByteBuffer jsonStringifyGrowable(IV8ValueReference iV8ValueReference, ByteBuffer byteBuffer)
+            throws JavetException {
+        Objects.requireNonNull(byteBuffer);
+        if (!byteBuffer.isDirect()) {
+            throw new IllegalArgumentException(ERROR_BYTE_BUFFER_MUST_BE_DIRECT);
+        }
+        ByteBuffer resultByteBuffer = (ByteBuffer) v8Native.jsonStringifyGrowable(
+                handle, iV8ValueReference.getHandle(), iV8ValueReference.getType().getId(),
+                byteBuffer, byteBuffer.position(), byteBuffer.limit());
+        if (resultByteBuffer == null) {
+            return byteBuffer;
+        }
+        if (resultByteBuffer != byteBuffer) {
+            resultByteBuffer.order(byteBuffer.order());
+        }
+        return resultByteBuffer;
+    }
+
     /**
      * From long object to long.
      *
@@ -2315,7 +3488,8 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
     }
 
     /**
-     * Sets a property of a map by a key
+     * Sets a property of a map by a key.
+     * The key-value pairs are set in one native call which stops at the first failure.
      *
      * @param iV8ValueMap the V8 value map
      * @param v8Values    the V8 values
@@ -2326,7 +3500,8 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
     @SuppressWarnings("RedundantThrows")
     boolean mapSet(IV8ValueMap iV8ValueMap, V8Value... v8Values) throws JavetException {
         assert v8Values.length > 0 && v8Values.length % 2 == 0 : ERROR_THE_KEY_VALUE_PAIR_MUST_MATCH;
-        return v8Native.mapSet(handle, iV8ValueMap.getHandle(), iV8ValueMap.getType().getId(), v8Values);
+        return v8Native.mapSet(handle, iV8ValueMap.getHandle(), iV8ValueMap.getType().getId(), v8Values)
+                == v8Values.length >> 1;
     }
 
     /**
@@ -2932,7 +4107,8 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
     }
 
     /**
-     * Sets a property of an object by a key
+     * Sets a property of an object by a key.
+     * The key-value pairs are set in one native call which stops at the first failure.
      *
      * @param iV8ValueObject the V8 value object
      * @param v8Values       the V8 values
@@ -2947,7 +4123,7 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
                 handle,
                 Objects.requireNonNull(iV8ValueObject).getHandle(),
                 iV8ValueObject.getType().getId(),
-                v8Values);
+                v8Values) == v8Values.length >> 1;
     }
 
     /**
@@ -3354,6 +4530,15 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         v8Native.proxyRevoke(handle, iV8ValueProxy.getHandle(), iV8ValueProxy.getType().getId());
     }
 
+    /**
+     * Receives the code cache rejected callback from JNI on the thread that consumes the code cache.
+     *
+     * @since 5.0.4
+     */
+    void receiveCodeCacheRejectedCallback() {
+        CODE_CACHE_REJECTED.set(Boolean.TRUE);
+    }
+
     /**
      * Receives the GC epilogue callback from JNI.
      *
@@ -3424,6 +4609,82 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         }
     }
 
+    /**
+     * Refresh the cached data rejected by V8.
+     * A code cache served by the V8 code cache is replaced by a fresh one,
+     * otherwise the code cache rejected callback is notified with a fresh one.
+     *
+     * @param key            the key in the V8 code cache or null if the cached data was given by the caller
+     * @param scriptString   the script string
+     * @param v8ScriptOrigin the V8 script origin
+     * @param iV8Cacheable   the compiled script, module or function, or null if the result was not required
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    private void refreshCachedData(
+            String key, String scriptString, V8ScriptOrigin v8ScriptOrigin, IV8Cacheable iV8Cacheable)
+            throws JavetException {
+        if (key != null) {
+            v8CodeCache.reject(key);
+            if (iV8Cacheable != null) {
+                v8CodeCache.put(key, iV8Cacheable.getCachedData());
+            }
+        } else if (codeCacheRejectedCallback != null && iV8Cacheable != null) {
+            try {
+                codeCacheRejectedCallback.callback(v8ScriptOrigin, scriptString, iV8Cacheable.getCachedData());
+            } catch (Throwable t) {
+                logger.logError(t, "Failed to process code cache rejected callback {0}.",
+                        v8ScriptOrigin.getResourceName());
+            }
+        }
+    }
+
+    /**
+     * Release the pending script streamings before the V8 isolate is disposed.
+     * The script streamings not started yet are released immediately.
+     * The running ones are cancelled and released by their own threads, which are awaited
+     * for at most {@link #DEFAULT_SCRIPT_STREAMING_RELEASE_TIMEOUT_MILLIS}.
+     * It must be called with the script streaming map locked.
+     *
+     * @throws JavetException the javet exception if the running ones are not released in time
+     * @since 5.0.4
+     */
+    private void releaseScriptStreamings() throws JavetException {
+        Iterator<Map.Entry<Long, ScriptStreamingInputStream>> iterator = scriptStreamingMap.entrySet().iterator();
+        while (iterator.hasNext()) {
+            Map.Entry<Long, ScriptStreamingInputStream> entry = iterator.next();
+            entry.getValue().cancel();
+            if (!entry.getValue().isStarted()) {
+                v8Native.scriptStreamingRelease(handle, entry.getKey());
+                iterator.remove();
+            }
+        }
+        boolean interrupted = false;
+        final long deadline = System.currentTimeMillis() + DEFAULT_SCRIPT_STREAMING_RELEASE_TIMEOUT_MILLIS;
+        try {
+            while (!scriptStreamingMap.isEmpty()) {
+                final long timeout = deadline - System.currentTimeMillis();
+                if (timeout <= 0) {
+                    // Disposing the V8 isolate under a running parsing would crash the process.
+                    throw new JavetException(
+                            JavetError.RuntimeCloseFailure,
+                            SimpleMap.of(JavetError.PARAMETER_MESSAGE, MessageFormat.format(
+                                    "{0} script streaming(s) are still reading their input streams",
+                                    scriptStreamingMap.size())));
+                }
+                try {
+                    scriptStreamingMap.wait(timeout);
+                } catch (InterruptedException e) {
+                    interrupted = true;
+                }
+            }
+        } finally {
+            if (interrupted) {
+                Thread.currentThread().interrupt();
+            }
+        }
+    }
+
     /**
      * Remove all references.
      *
@@ -3526,7 +4787,14 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
                 if (referenceType == V8ValueReferenceType.Module.getId()) {
                     removeV8Module((IV8Module) iV8ValueReference);
                 }
-                v8Native.removeReferenceHandle(handle, referenceHandle, referenceType);
+                if (referenceBatchDepth > 0 || referenceReleaseDeferred) {
+                    pendingReferenceHandles[pendingReferenceCount] = referenceHandle;
+                    if (++pendingReferenceCount == DEFAULT_REFERENCE_RELEASE_BATCH_SIZE) {
+                        flushReferences();
+                    }
+                } else {
+                    v8Native.removeReferenceHandle(handle, referenceHandle, referenceType);
+                }
             }
         }
         if (gcScheduled) {
@@ -3547,14 +4815,19 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
                 final int referenceCount = getReferenceCount();
                 final int v8ModuleCount = getV8ModuleCount();
                 int weakReferenceCount = 0;
-                for (IV8ValueReference iV8ValueReference : new ArrayList<>(referenceMap.values())) {
-                    if (iV8ValueReference instanceof IV8ValueObject) {
-                        IV8ValueObject iV8ValueObject = (IV8ValueObject) iV8ValueReference;
-                        if (iV8ValueObject.isWeak()) {
-                            ++weakReferenceCount;
+                ++referenceBatchDepth;
+                try {
+                    for (IV8ValueReference iV8ValueReference : new ArrayList<>(referenceMap.values())) {
+                        if (iV8ValueReference instanceof IV8ValueObject) {
+                            IV8ValueObject iV8ValueObject = (IV8ValueObject) iV8ValueReference;
+                            if (iV8ValueObject.isWeak()) {
+                                ++weakReferenceCount;
+                            }
                         }
+                        iV8ValueReference.close(true);
                     }
-                    iV8ValueReference.close(true);
+                } finally {
+                    --referenceBatchDepth;
                 }
                 if (v8ModuleCount + weakReferenceCount < referenceCount) {
                     logger.logWarn("{0} V8 object(s) not recycled, {1} weak, {2} module(s).",
@@ -3569,6 +4842,7 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
                 }
                 referenceMap.clear();
             }
+            flushReferences();
         }
     }
 
@@ -3710,8 +4984,11 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
     @SuppressWarnings("UnusedReturnValue")
     public void resetIsolate() throws JavetException {
         if (!isClosed()) {
-            removeAllReferences();
-            v8Native.resetV8Isolate(handle, runtimeOptions);
+            synchronized (scriptStreamingMap) {
+                releaseScriptStreamings();
+                removeAllReferences();
+                v8Native.resetV8Isolate(handle, runtimeOptions);
+            }
         }
     }
 
@@ -3740,6 +5017,20 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return v8Native.scriptGetCachedData(handle, iV8Script.getHandle(), iV8Script.getType().getId());
     }
 
+    /**
+     * Get compile hints recorded by a script compiled with produce compile hints.
+     *
+     * @param iV8Script the V8 script
+     * @return the compile hints
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    V8CompileHints scriptGetCompileHints(IV8Script iV8Script) throws JavetException {
+        int[] positions = v8Native.scriptGetCompileHints(handle, iV8Script.getHandle(), iV8Script.getType().getId());
+        return positions == null ? V8CompileHints.EMPTY : new V8CompileHints(positions);
+    }
+
     /**
      * Get resource name from a script.
      *
@@ -3771,6 +5062,30 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
                 handle, iV8Script.getHandle(), iV8Script.getType().getId(), resultRequired);
     }
 
+    /**
+     * Serialize a V8 value with the V8 value serializer into a direct byte buffer.
+     * <p>
+     * The whole object graph is written in one native call in the V8 wire format.
+     * If the returned length is greater than the capacity of the byte buffer,
+     * the content of the byte buffer is undefined and the caller is expected
+     * to retry with a byte buffer that is large enough.
+     *
+     * @param iV8ValueReference the V8 value reference
+     * @param byteBuffer        the direct byte buffer
+     * @return the length of the serialized data, or -1 if the value cannot be serialized
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    public int serialize(IV8ValueReference iV8ValueReference, ByteBuffer byteBuffer) throws JavetException {
+        Objects.requireNonNull(byteBuffer);
+        if (!byteBuffer.isDirect()) {
+            throw new IllegalArgumentException(ERROR_BYTE_BUFFER_MUST_BE_DIRECT);
+        }
+        return v8Native.valueSerialize(
+                handle, iV8ValueReference.getHandle(), iV8ValueReference.getType().getId(), byteBuffer);
+    }
+
     /**
      * Add a value to a set.
      *
@@ -3823,6 +5138,18 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         v8Native.setClear(handle, iV8ValueSet.getHandle(), iV8ValueSet.getType().getId());
     }
 
+    /**
+     * Sets code cache rejected callback.
+     * It is notified with a fresh code cache whenever V8 rejects the cached data given by the caller,
+     * so that the stale code cache can be replaced.
+     *
+     * @param codeCacheRejectedCallback the code cache rejected callback or null to disable the notification
+     * @since 5.0.4
+     */
+    public void setCodeCacheRejectedCallback(IJavetCodeCacheRejectedCallback codeCacheRejectedCallback) {
+        this.codeCacheRejectedCallback = codeCacheRejectedCallback;
+    }
+
     /**
      * Sets converter.
      *
@@ -3962,6 +5289,39 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         this.promiseRejectCallback = Objects.requireNonNull(promiseRejectCallback);
     }
 
+    /**
+     * Sets reference release deferred.
+     * <p>
+     * If it is true, the closed references are queued up and released in one JNI call
+     * when the queue is full, when {@link #flushReferences()} is called,
+     * or before the runtime is reset or closed.
+     *
+     * @param referenceReleaseDeferred the reference release deferred
+     * @return the self
+     * @since 5.0.4
+     */
+    public V8Runtime setReferenceReleaseDeferred(boolean referenceReleaseDeferred) {
+        synchronized (referenceLock) {
+            this.referenceReleaseDeferred = referenceReleaseDeferred;
+            if (!referenceReleaseDeferred && referenceBatchDepth == 0) {
+                flushReferences();
+            }
+        }
+        return this;
+    }
+
+    /**
+     * Sets V8 code cache.
+     * Scripts, modules and functions compiled from strings without explicit cached data
+     * look up and store code caches in the given V8 code cache.
+     *
+     * @param v8CodeCache the V8 code cache or null to disable the lookup
+     * @since 5.0.4
+     */
+    public void setV8CodeCache(V8CodeCache v8CodeCache) {
+        this.v8CodeCache = v8CodeCache;
+    }
+
     /**
      * Sets V8 module resolver.
      *
@@ -4150,9 +5510,150 @@ public class V8Runtime implements IJavetClosable, IV8Creatable, IV8Convertible {
         return v8Native.toString(handle, iV8ValueReference.getHandle(), iV8ValueReference.getType().getId());
     }
 
+    /**
+     * Gets a direct byte buffer over the current window of the typed array in the backing store.
+     *
+     * @param iV8ValueTypedArray the V8 value typed array
+     * @return the byte buffer, or null if the typed array is detached, out of bounds or empty
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    ByteBuffer typedArrayGetByteBuffer(IV8ValueTypedArray iV8ValueTypedArray) throws JavetException {
+        return v8Native.typedArrayGetByteBuffer(
+                handle, iV8ValueTypedArray.getHandle(), iV8ValueTypedArray.getType().getId());
+    }
+
+    /**
+     * Copy a region of the typed array to a Java primitive array.
+     * The Java array type must match the element type of the typed array.
+     *
+     * @param iV8ValueTypedArray the V8 value typed array
+     * @param index              the start index in the typed array
+     * @param array              the Java primitive array
+     * @param arrayOffset        the start offset in the Java array
+     * @param length             the element count
+     * @return true : copied, false : the typed array range is out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    boolean typedArrayGetRegion(
+            IV8ValueTypedArray iV8ValueTypedArray, int index, Object array, int arrayOffset, int length)
+            throws JavetException {
+        return v8Native.typedArrayGetRegion(
+                handle, iV8ValueTypedArray.getHandle(), iV8ValueTypedArray.getType().getId(),
+                array, index, arrayOffset, length);
+    }
+
+    /**
+     * Copy a region of a Java primitive array to the typed array.
+     * The Java array type must match the element type of the typed array.
+     *
+     * @param iV8ValueTypedArray the V8 value typed array
+     * @param index              the start index in the typed array
+     * @param array              the Java primitive array
+     * @param arrayOffset        the start offset in the Java array
+     * @param length             the element count
+     * @return true : copied, false : the typed array range is out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("RedundantThrows")
+    boolean typedArraySetRegion(
+            IV8ValueTypedArray iV8ValueTypedArray, int index, Object array, int arrayOffset, int length)
+            throws JavetException {
+        return v8Native.typedArraySetRegion(
+                handle, iV8ValueTypedArray.getHandle(), iV8ValueTypedArray.getType().getId(),
+                array, index, arrayOffset, length);
+    }
+
     @Override
     @CheckReturnValue
     public <T, V extends V8Value> V toV8Value(T object) throws JavetException {
         return converter.toV8Value(this, object);
     }
+
+    /**
+     * The type script streaming input stream feeds a script streaming
+     * and reports the end of the source once the V8 runtime is being closed or reset.
+     * The underlying input stream is not closed.
+     *
+     * @since 5.0.4
+     */
+    static final class ScriptStreamingInputStream extends FilterInputStream {
+        private volatile boolean cancelled;
+        private boolean started;
+        private Thread thread;
+
+        /**
+         * Instantiates a new script streaming input stream.
+         *
+         * @param inputStream the input stream
+         * @since 5.0.4
+         */
+        ScriptStreamingInputStream(InputStream inputStream) {
+            super(inputStream);
+            cancelled = false;
+            started = false;
+            thread = null;
+        }
+
+        /**
+         * Cancel the script streaming and interrupt the thread that reads the input stream.
+         * It is guarded by the script streaming map.
+         *
+         * @since 5.0.4
+         */
+        void cancel() {
+            cancelled = true;
+            if (thread != null) {
+                thread.interrupt();
+            }
+        }
+
+        @Override
+        public void close() {
+        }
+
+        /**
+         * Is cancelled.
+         *
+         * @return true : cancelled, false : not cancelled
+         * @since 5.0.4
+         */
+        boolean isCancelled() {
+            return cancelled;
+        }
+
+        /**
+         * Is started. It is guarded by the script streaming map.
+         *
+         * @return true : started, false : not started
+         * @since 5.0.4
+         */
+        boolean isStarted() {
+            return started;
+        }
+
+        @Override
+        public int read() throws IOException {
+            return cancelled ? -1 : super.read();
+        }
+
+        @Override
+        public int read(byte[] bytes, int offset, int length) throws IOException {
+            return cancelled ? -1 : super.read(bytes, offset, length);
+        }
+
+        /**
+         * Mark the script streaming as started by the current thread. It is guarded by the script streaming map.
+         *
+         * @since 5.0.4
+         */
+        void setStarted() {
+            started = true;
+            thread = Thread.currentThread();
+        }
+    }
 }
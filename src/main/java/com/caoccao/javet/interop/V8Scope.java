@@ -152,6 +152,36 @@ public class V8Scope implements IV8Creatable, IJavetClosable {
         return add(v8Runtime.createV8ValueArray());
     }
 
+    @Override
+    public V8ValueArray createV8ValueArray(boolean[] booleans) throws JavetException {
+        Objects.requireNonNull(v8Runtime, ERROR_MESSAGE_V8_RUNTIME_CANNOT_BE_EMPTY);
+        return add(v8Runtime.createV8ValueArray(booleans));
+    }
+
+    @Override
+    public V8ValueArray createV8ValueArray(double[] doubles) throws JavetException {
+        Objects.requireNonNull(v8Runtime, ERROR_MESSAGE_V8_RUNTIME_CANNOT_BE_EMPTY);
+        return add(v8Runtime.createV8ValueArray(doubles));
+    }
+
+    @Override
+    public V8ValueArray createV8ValueArray(int[] integers) throws JavetException {
+        Objects.requireNonNull(v8Runtime, ERROR_MESSAGE_V8_RUNTIME_CANNOT_BE_EMPTY);
+        return add(v8Runtime.createV8ValueArray(integers));
+    }
+
+    @Override
+    public V8ValueArray createV8ValueArray(long[] longs) throws JavetException {
+        Objects.requireNonNull(v8Runtime, ERROR_MESSAGE_V8_RUNTIME_CANNOT_BE_EMPTY);
+        return add(v8Runtime.createV8ValueArray(longs));
+    }
+
+    @Override
+    public V8ValueArray createV8ValueArray(String[] strings) throws JavetException {
+        Objects.requireNonNull(v8Runtime, ERROR_MESSAGE_V8_RUNTIME_CANNOT_BE_EMPTY);
+        return add(v8Runtime.createV8ValueArray(strings));
+    }
+
     @Override
     public V8ValueArrayBuffer createV8ValueArrayBuffer(int length) throws JavetException {
         Objects.requireNonNull(v8Runtime, ERROR_MESSAGE_V8_RUNTIME_CANNOT_BE_EMPTY);
@@ -308,6 +338,24 @@ public class V8Scope implements IV8Creatable, IJavetClosable {
         return add(v8Runtime.createV8ValueTypedArray(type, length));
     }
 
+    @Override
+    public V8ValueTypedArray createV8ValueTypedArray(double[] doubles) throws JavetException {
+        Objects.requireNonNull(v8Runtime, ERROR_MESSAGE_V8_RUNTIME_CANNOT_BE_EMPTY);
+        return add(v8Runtime.createV8ValueTypedArray(doubles));
+    }
+
+    @Override
+    public V8ValueTypedArray createV8ValueTypedArray(int[] integers) throws JavetException {
+        Objects.requireNonNull(v8Runtime, ERROR_MESSAGE_V8_RUNTIME_CANNOT_BE_EMPTY);
+        return add(v8Runtime.createV8ValueTypedArray(integers));
+    }
+
+    @Override
+    public V8ValueTypedArray createV8ValueTypedArray(long[] longs) throws JavetException {
+        Objects.requireNonNull(v8Runtime, ERROR_MESSAGE_V8_RUNTIME_CANNOT_BE_EMPTY);
+        return add(v8Runtime.createV8ValueTypedArray(longs));
+    }
+
     @Override
     public V8ValueUndefined createV8ValueUndefined() {
         Objects.requireNonNull(v8Runtime, ERROR_MESSAGE_V8_RUNTIME_CANNOT_BE_EMPTY);
@@ -17,8 +17,16 @@
 package com.caoccao.javet.interop;
 
 public final class V8ScriptOrigin {
-
+    static final int COMPILE_OPTION_EAGER_COMPILE = 1;
+    static final int COMPILE_OPTION_FOLLOW_COMPILE_HINTS_MAGIC_COMMENT = 4;
+    static final int COMPILE_OPTION_PRODUCE_COMPILE_HINTS = 2;
+
+    private boolean cachedDataRejected;
+    private V8CompileHints compileHints;
+    private boolean eagerCompile;
+    private boolean followCompileHintsMagicComment;
     private boolean module;
+    private boolean produceCompileHints;
     private int resourceColumnOffset;
     private int resourceLineOffset;
     private String resourceName;
@@ -38,6 +46,11 @@ public final class V8ScriptOrigin {
         this.scriptId = scriptId;
         this.wasm = wasm;
         this.module = module;
+        cachedDataRejected = false;
+        compileHints = null;
+        eagerCompile = false;
+        followCompileHintsMagicComment = false;
+        produceCompileHints = false;
     }
 
     public V8ScriptOrigin() {
@@ -64,6 +77,28 @@ public final class V8ScriptOrigin {
                 scriptId, false, false);
     }
 
+    int[] getCompileHintPositions() {
+        return compileHints == null || compileHints.isEmpty() ? null : compileHints.positions;
+    }
+
+    public V8CompileHints getCompileHints() {
+        return compileHints;
+    }
+
+    int getCompileOptions() {
+        int compileOptions = 0;
+        if (eagerCompile) {
+            compileOptions |= COMPILE_OPTION_EAGER_COMPILE;
+        }
+        if (produceCompileHints) {
+            compileOptions |= COMPILE_OPTION_PRODUCE_COMPILE_HINTS;
+        }
+        if (followCompileHintsMagicComment) {
+            compileOptions |= COMPILE_OPTION_FOLLOW_COMPILE_HINTS_MAGIC_COMMENT;
+        }
+        return compileOptions;
+    }
+
     public int getResourceColumnOffset() {
         return resourceColumnOffset;
     }
@@ -80,19 +115,60 @@ public final class V8ScriptOrigin {
         return scriptId;
     }
 
+    public boolean isCachedDataRejected() {
+        return cachedDataRejected;
+    }
+
+    public boolean isEagerCompile() {
+        return eagerCompile;
+    }
+
+    public boolean isFollowCompileHintsMagicComment() {
+        return followCompileHintsMagicComment;
+    }
+
     public boolean isModule() {
         return module;
     }
 
+    public boolean isProduceCompileHints() {
+        return produceCompileHints;
+    }
+
     public boolean isWasm() {
         return wasm;
     }
 
+    V8ScriptOrigin setCachedDataRejected(boolean cachedDataRejected) {
+        this.cachedDataRejected = cachedDataRejected;
+        return this;
+    }
+
+    public V8ScriptOrigin setCompileHints(V8CompileHints compileHints) {
+        this.compileHints = compileHints;
+        return this;
+    }
+
+    public V8ScriptOrigin setEagerCompile(boolean eagerCompile) {
+        this.eagerCompile = eagerCompile;
+        return this;
+    }
+
+    public V8ScriptOrigin setFollowCompileHintsMagicComment(boolean followCompileHintsMagicComment) {
+        this.followCompileHintsMagicComment = followCompileHintsMagicComment;
+        return this;
+    }
+
     public V8ScriptOrigin setModule(boolean module) {
         this.module = module;
         return this;
     }
 
+    public V8ScriptOrigin setProduceCompileHints(boolean produceCompileHints) {
+        this.produceCompileHints = produceCompileHints;
+        return this;
+    }
+
     public V8ScriptOrigin setResourceColumnOffset(int resourceColumnOffset) {
         this.resourceColumnOffset = resourceColumnOffset;
         return this;
@@ -26,6 +26,12 @@ import java.lang.reflect.Method;
  * @since 0.9.2
  */
 public class MethodDescriptor {
+    /**
+     * The Fast call.
+     *
+     * @since 5.0.4
+     */
+    protected boolean fastCall;
     /**
      * The Method.
      *
@@ -65,6 +71,20 @@ public class MethodDescriptor {
      * @since 0.9.11
      */
     public MethodDescriptor(Method method, boolean thisObjectRequired, V8ValueSymbolType symbolType) {
+        this(method, thisObjectRequired, symbolType, false);
+    }
+
+    /**
+     * Instantiates a new Method descriptor.
+     *
+     * @param method             the method
+     * @param thisObjectRequired this object required
+     * @param symbolType         the symbol type
+     * @param fastCall           the fast call
+     * @since 5.0.4
+     */
+    public MethodDescriptor(Method method, boolean thisObjectRequired, V8ValueSymbolType symbolType, boolean fastCall) {
+        this.fastCall = fastCall;
         this.method = method;
         this.symbolType = symbolType;
         this.thisObjectRequired = thisObjectRequired;
@@ -90,6 +110,16 @@ public class MethodDescriptor {
         return symbolType;
     }
 
+    /**
+     * Is fast call.
+     *
+     * @return true : yes, false : no
+     * @since 5.0.4
+     */
+    public boolean isFastCall() {
+        return fastCall;
+    }
+
     /**
      * Is this object required boolean.
      *
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.caoccao.javet.interop.callback;
+
+import com.caoccao.javet.interop.V8ScriptOrigin;
+
+/**
+ * The interface Javet code cache rejected callback.
+ * <p>
+ * It is called after V8 rejected the cached data passed in to compile or execute a script, module or function,
+ * with a fresh code cache created from the compilation that V8 fell back to,
+ * so that the fresh code cache can be stored in place of the stale one.
+ *
+ * @since 5.0.4
+ */
+@FunctionalInterface
+public interface IJavetCodeCacheRejectedCallback {
+    /**
+     * Callback.
+     *
+     * @param v8ScriptOrigin the V8 script origin
+     * @param scriptString   the script string
+     * @param cachedData     the fresh code cache
+     * @since 5.0.4
+     */
+    void callback(V8ScriptOrigin v8ScriptOrigin, String scriptString, byte[] cachedData);
+}
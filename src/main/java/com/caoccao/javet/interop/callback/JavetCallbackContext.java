@@ -46,7 +46,9 @@ public final class JavetCallbackContext {
     private final String name;
     private final V8ValueSymbolType symbolType;
     private final boolean thisObjectRequired;
+    private boolean fastCall;
     private long handle;
+    private JavetPrimitiveSignature primitiveSignature;
     private boolean returnResult;
 
     /**
@@ -200,6 +202,7 @@ public final class JavetCallbackContext {
                 || (callbackReceiver == null && Modifier.isStatic(callbackMethod.getModifiers()))
                 : ERROR_CALLBACK_RECEIVER_OR_CALLBACK_METHOD_IS_INVALID;
         this.returnResult = !callbackMethod.getReturnType().equals(Void.TYPE);
+        primitiveSignature = JavetPrimitiveSignature.of(callbackMethod, thisObjectRequired);
     }
 
     private JavetCallbackContext(
@@ -212,8 +215,10 @@ public final class JavetCallbackContext {
         this.callbackMethod = Objects.requireNonNull(callbackMethod);
         this.callbackReceiver = callbackReceiver;
         this.callbackType = Objects.requireNonNull(callbackType);
+        fastCall = false;
         handle = INVALID_HANDLE;
         this.name = name;
+        primitiveSignature = null;
         this.thisObjectRequired = thisObjectRequired;
         this.symbolType = Objects.requireNonNull(symbolType);
     }
@@ -269,6 +274,19 @@ public final class JavetCallbackContext {
         return name;
     }
 
+    /**
+     * Gets primitive signature.
+     * <p>
+     * A callback with a primitive signature is called by the native trampoline
+     * with raw primitive and string arguments if the actual arguments match.
+     *
+     * @return the primitive signature or null if the callback is not eligible
+     * @since 5.0.4
+     */
+    public JavetPrimitiveSignature getPrimitiveSignature() {
+        return primitiveSignature;
+    }
+
     /**
      * Gets symbol type.
      *
@@ -279,6 +297,16 @@ public final class JavetCallbackContext {
         return symbolType;
     }
 
+    /**
+     * Is fast call.
+     *
+     * @return true : yes, false : no
+     * @since 5.0.4
+     */
+    public boolean isFastCall() {
+        return fastCall;
+    }
+
     /**
      * Is return result.
      *
@@ -309,6 +337,22 @@ public final class JavetCallbackContext {
         return handle != INVALID_HANDLE;
     }
 
+    /**
+     * Sets fast call.
+     * <p>
+     * Fast call registers the callback as a V8 fast API call if the primitive signature
+     * has up to 3 int, double or boolean parameters and a void, int, double or boolean result.
+     * Otherwise, it is ignored. It must be set before the function is created.
+     *
+     * @param fastCall the fast call
+     * @return the self
+     * @since 5.0.4
+     */
+    public JavetCallbackContext setFastCall(boolean fastCall) {
+        this.fastCall = fastCall;
+        return this;
+    }
+
     /**
      * Sets handle.
      *
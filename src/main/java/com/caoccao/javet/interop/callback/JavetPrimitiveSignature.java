@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop.callback;
+
+import java.lang.reflect.Method;
+import java.util.Objects;
+
+/**
+ * The type Javet primitive signature describes a reflection callback
+ * whose parameters and return type are all primitives or String.
+ * <p>
+ * Such callbacks are called by the native trampoline directly with raw JNI values
+ * so that no V8 value wrappers are allocated per call. If the actual arguments
+ * do not match the signature exactly, the regular callback path is taken.
+ *
+ * @since 5.0.4
+ */
+public final class JavetPrimitiveSignature {
+    /**
+     * The constant TYPE_BOOLEAN.
+     *
+     * @since 5.0.4
+     */
+    public static final int TYPE_BOOLEAN = 1;
+    /**
+     * The constant TYPE_DOUBLE.
+     *
+     * @since 5.0.4
+     */
+    public static final int TYPE_DOUBLE = 4;
+    /**
+     * The constant TYPE_INT.
+     *
+     * @since 5.0.4
+     */
+    public static final int TYPE_INT = 2;
+    /**
+     * The constant TYPE_LONG.
+     *
+     * @since 5.0.4
+     */
+    public static final int TYPE_LONG = 3;
+    /**
+     * The constant TYPE_STRING.
+     *
+     * @since 5.0.4
+     */
+    public static final int TYPE_STRING = 5;
+    /**
+     * The constant TYPE_VOID.
+     *
+     * @since 5.0.4
+     */
+    public static final int TYPE_VOID = 0;
+    private static final int TYPE_UNSUPPORTED = -1;
+    private final Method method;
+    private final int[] parameterTypes;
+    private final int returnType;
+
+    private JavetPrimitiveSignature(Method method, int[] parameterTypes, int returnType) {
+        this.method = Objects.requireNonNull(method);
+        this.parameterTypes = Objects.requireNonNull(parameterTypes);
+        this.returnType = returnType;
+    }
+
+    /**
+     * Detect the primitive signature of a reflection callback.
+     *
+     * @param callbackMethod     the callback method
+     * @param thisObjectRequired the this object required
+     * @return the primitive signature or null if the callback is not eligible
+     * @since 5.0.4
+     */
+    public static JavetPrimitiveSignature of(Method callbackMethod, boolean thisObjectRequired) {
+        if (callbackMethod == null || thisObjectRequired || callbackMethod.isVarArgs()) {
+            return null;
+        }
+        int returnType = toType(callbackMethod.getReturnType());
+        if (returnType == TYPE_UNSUPPORTED) {
+            return null;
+        }
+        Class<?>[] parameterClasses = callbackMethod.getParameterTypes();
+        final int length = parameterClasses.length;
+        int[] parameterTypes = new int[length];
+        for (int i = 0; i < length; ++i) {
+            int parameterType = toType(parameterClasses[i]);
+            if (parameterType == TYPE_UNSUPPORTED || parameterType == TYPE_VOID) {
+                return null;
+            }
+            parameterTypes[i] = parameterType;
+        }
+        return new JavetPrimitiveSignature(callbackMethod, parameterTypes, returnType);
+    }
+
+    private static int toType(Class<?> clazz) {
+        if (clazz == int.class) {
+            return TYPE_INT;
+        } else if (clazz == double.class) {
+            return TYPE_DOUBLE;
+        } else if (clazz == boolean.class) {
+            return TYPE_BOOLEAN;
+        } else if (clazz == String.class) {
+            return TYPE_STRING;
+        } else if (clazz == long.class) {
+            return TYPE_LONG;
+        } else if (clazz == void.class) {
+            return TYPE_VOID;
+        }
+        return TYPE_UNSUPPORTED;
+    }
+
+    /**
+     * Gets method.
+     *
+     * @return the method
+     * @since 5.0.4
+     */
+    public Method getMethod() {
+        return method;
+    }
+
+    /**
+     * Gets parameter types.
+     *
+     * @return the parameter types
+     * @since 5.0.4
+     */
+    public int[] getParameterTypes() {
+        return parameterTypes;
+    }
+
+    /**
+     * Gets return type.
+     *
+     * @return the return type
+     * @since 5.0.4
+     */
+    public int getReturnType() {
+        return returnType;
+    }
+}
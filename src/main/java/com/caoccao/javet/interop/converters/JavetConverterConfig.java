@@ -16,6 +16,7 @@
 
 package com.caoccao.javet.interop.converters;
 
+import com.caoccao.javet.enums.JavetConversionMode;
 import com.caoccao.javet.interop.binding.IClassProxyPlugin;
 import com.caoccao.javet.interop.proxy.IJavetReflectionObjectFactory;
 import com.caoccao.javet.interop.proxy.plugins.JavetProxyPluginArray;
@@ -25,6 +26,7 @@ import com.caoccao.javet.interop.proxy.plugins.JavetProxyPluginSet;
 
 import java.util.ArrayList;
 import java.util.List;
+import java.util.Objects;
 
 /**
  * The type Javet converter config.
@@ -63,6 +65,12 @@ public class JavetConverterConfig<T extends JavetConverterConfig<T>> {
      * @since 5.0.2
      */
     protected int batchSize;
+    /**
+     * The conversion mode from V8 objects to Java objects.
+     *
+     * @since 5.0.4
+     */
+    protected JavetConversionMode conversionMode;
     /**
      * The Default boolean.
      *
@@ -149,6 +157,7 @@ public class JavetConverterConfig<T extends JavetConverterConfig<T>> {
      */
     public JavetConverterConfig() {
         batchSize = DEFAULT_BATCH_SIZE;
+        conversionMode = JavetConversionMode.Recursive;
         defaultBoolean = false;
         defaultByte = (byte) 0;
         defaultChar = '\0';
@@ -175,6 +184,16 @@ public class JavetConverterConfig<T extends JavetConverterConfig<T>> {
         return batchSize;
     }
 
+    /**
+     * Gets conversion mode.
+     *
+     * @return the conversion mode
+     * @since 5.0.4
+     */
+    public JavetConversionMode getConversionMode() {
+        return conversionMode;
+    }
+
     /**
      * Gets default boolean boolean.
      *
@@ -367,6 +386,18 @@ public class JavetConverterConfig<T extends JavetConverterConfig<T>> {
         return this;
     }
 
+    /**
+     * Sets conversion mode.
+     *
+     * @param conversionMode the conversion mode
+     * @return the self
+     * @since 5.0.4
+     */
+    public JavetConverterConfig<T> setConversionMode(JavetConversionMode conversionMode) {
+        this.conversionMode = Objects.requireNonNull(conversionMode);
+        return this;
+    }
+
     /**
      * Sets default boolean.
      *
@@ -21,7 +21,10 @@ import com.caoccao.javet.entities.JavetEntityError;
 import com.caoccao.javet.entities.JavetEntityFunction;
 import com.caoccao.javet.entities.JavetEntityMap;
 import com.caoccao.javet.entities.JavetEntitySymbol;
+import com.caoccao.javet.enums.JavetConversionMode;
 import com.caoccao.javet.enums.V8ValueReferenceType;
+import com.caoccao.javet.exceptions.JavetConverterException;
+import com.caoccao.javet.exceptions.JavetError;
 import com.caoccao.javet.exceptions.JavetException;
 import com.caoccao.javet.interfaces.*;
 import com.caoccao.javet.interop.V8Runtime;
@@ -37,6 +40,7 @@ import java.lang.reflect.AccessibleObject;
 import java.lang.reflect.Constructor;
 import java.lang.reflect.Method;
 import java.lang.reflect.Modifier;
+import java.nio.ByteBuffer;
 import java.util.*;
 import java.util.concurrent.ConcurrentHashMap;
 import java.util.stream.BaseStream;
@@ -50,6 +54,12 @@ import java.util.stream.BaseStream;
  */
 @SuppressWarnings("unchecked")
 public class JavetObjectConverter extends JavetPrimitiveConverter {
+    /**
+     * The constant DEFAULT_SERIALIZATION_BUFFER_SIZE.
+     *
+     * @since 5.0.4
+     */
+    protected static final int DEFAULT_SERIALIZATION_BUFFER_SIZE = 64 * 1024;
     /**
      * The constant EXECUTABLE_INDEX_DEFAULT_CONSTRUCTOR.
      *
@@ -68,6 +78,12 @@ public class JavetObjectConverter extends JavetPrimitiveConverter {
      * @since 0.9.12
      */
     protected static final int EXECUTABLE_INDEX_TO_MAP = 2;
+    /**
+     * The constant MAX_CACHED_SERIALIZATION_BUFFER_SIZE.
+     *
+     * @since 5.0.4
+     */
+    protected static final int MAX_CACHED_SERIALIZATION_BUFFER_SIZE = 16 * 1024 * 1024;
     /**
      * The constant METHOD_NAME_FROM_MAP.
      *
@@ -110,6 +126,14 @@ public class JavetObjectConverter extends JavetPrimitiveConverter {
      * @since 0.7.2
      */
     protected static final String PUBLIC_PROPERTY_CONSTRUCTOR = "constructor";
+    /**
+     * The constant SERIALIZATION_BUFFER holds the reusable direct byte buffer per thread.
+     * The byte buffer is taken out while it is in use, so that a nested conversion
+     * allocates its own byte buffer.
+     *
+     * @since 5.0.4
+     */
+    protected static final ThreadLocal<ByteBuffer> SERIALIZATION_BUFFER = new ThreadLocal<>();
     /**
      * The Custom object map.
      *
@@ -147,6 +171,39 @@ public class JavetObjectConverter extends JavetPrimitiveConverter {
         return new JavetEntityMap();
     }
 
+    /**
+     * Is the V8 value eligible for the serialized conversion.
+     *
+     * @param v8Value the V8 value
+     * @return true : eligible, false : not eligible
+     * @since 5.0.4
+     */
+    protected boolean isSerializable(V8Value v8Value) {
+        if (config.getConversionMode() != JavetConversionMode.Serialized
+                || config.isSealedEnabled()
+                || !customObjectMap.isEmpty()) {
+            return false;
+        }
+        return v8Value instanceof V8ValueArray
+                || v8Value instanceof V8ValueMap
+                || v8Value instanceof V8ValueSet
+                || v8Value.getClass() == V8ValueObject.class;
+    }
+
+    /**
+     * Is the Java object eligible for the serialized conversion.
+     *
+     * @param object the object
+     * @return true : eligible, false : not eligible
+     * @since 5.0.4
+     */
+    protected boolean isSerializableObject(Object object) {
+        if (config.getConversionMode() != JavetConversionMode.Serialized || !customObjectMap.isEmpty()) {
+            return false;
+        }
+        return object instanceof Map || object instanceof Collection || object instanceof Object[];
+    }
+
     /**
      * Register custom object.
      *
@@ -204,6 +261,12 @@ public class JavetObjectConverter extends JavetPrimitiveConverter {
         if (!(returnObject instanceof V8Value)) {
             return returnObject;
         }
+        if (depth == 0 && isSerializable(v8Value)) {
+            Object object = toObjectBySerialization((V8ValueObject) v8Value, depth);
+            if (object != null) {
+                return (T) object;
+            }
+        }
         if (v8Value instanceof V8ValueArray) {
             V8ValueArray v8ValueArray = (V8ValueArray) v8Value;
             final List<Object> list = new ArrayList<>();
@@ -336,10 +399,56 @@ public class JavetObjectConverter extends JavetPrimitiveConverter {
         return (T) v8Value;
     }
 
+    /**
+     * Convert a V8 object to a Java object via the V8 value serializer.
+     * The whole object graph is serialized in one native call and decoded in one pass.
+     *
+     * @param v8ValueObject the V8 value object
+     * @param depth         the depth
+     * @return the Java object, or null if the object graph cannot be serialized
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    protected Object toObjectBySerialization(V8ValueObject v8ValueObject, final int depth) throws JavetException {
+        ByteBuffer byteBuffer = SERIALIZATION_BUFFER.get();
+        SERIALIZATION_BUFFER.remove();
+        if (byteBuffer == null) {
+            byteBuffer = ByteBuffer.allocateDirect(DEFAULT_SERIALIZATION_BUFFER_SIZE);
+        }
+        try {
+            V8Runtime v8Runtime = v8ValueObject.getV8Runtime();
+            int length = v8Runtime.serialize(v8ValueObject, byteBuffer);
+            if (length > byteBuffer.capacity()) {
+                byteBuffer = ByteBuffer.allocateDirect(Math.max(length, byteBuffer.capacity() * 2));
+                length = v8Runtime.serialize(v8ValueObject, byteBuffer);
+            }
+            if (length < 0 || length > byteBuffer.capacity()) {
+                return null;
+            }
+            return new JavetSerializedValueReader(byteBuffer, length, config.getMaxDepth(), this::createEntityMap)
+                    .read(depth);
+        } catch (JavetConverterException e) {
+            if (e.getError() == JavetError.ConverterCircularStructure) {
+                throw e;
+            }
+            return null;
+        } finally {
+            if (byteBuffer.capacity() <= MAX_CACHED_SERIALIZATION_BUFFER_SIZE) {
+                SERIALIZATION_BUFFER.set(byteBuffer);
+            }
+        }
+    }
+
     @Override
     @CheckReturnValue
     protected <T extends V8Value> T toV8Value(
             V8Runtime v8Runtime, Object object, final int depth) throws JavetException {
+        if (depth == 0 && isSerializableObject(object)) {
+            V8Value v8Value = toV8ValueBySerialization(v8Runtime, object, depth);
+            if (v8Value != null) {
+                return (T) v8Value;
+            }
+        }
         V8Value v8Value = super.toV8Value(v8Runtime, object, depth);
         if (v8Value != null && !(v8Value.isUndefined())) {
             return (T) v8Value;
@@ -382,13 +491,17 @@ public class JavetObjectConverter extends JavetPrimitiveConverter {
             try (V8Scope v8Scope = v8Runtime.getV8Scope()) {
                 V8ValueSet v8ValueSet = v8Scope.createV8ValueSet();
                 final Set<?> setObject = (Set<?>) object;
-                for (Object item : setObject) {
-                    try (V8Value childV8Value = toV8Value(v8Runtime, item, depth + 1)) {
-                        v8ValueSet.add(childV8Value);
+                final List<V8Value> childV8Values = new ArrayList<>(setObject.size());
+                try {
+                    for (Object item : setObject) {
+                        childV8Values.add(toV8Value(v8Runtime, item, depth + 1));
                     }
+                    v8ValueSet.batchAdd(childV8Values.toArray());
+                    v8Value = v8ValueSet;
+                    v8Scope.setEscapable();
+                } finally {
+                    JavetResourceUtils.safeClose(childV8Values);
                 }
-                v8Value = v8ValueSet;
-                v8Scope.setEscapable();
             }
         } else if (object instanceof Collection) {
             try (V8Scope v8Scope = v8Runtime.getV8Scope()) {
@@ -606,6 +719,52 @@ public class JavetObjectConverter extends JavetPrimitiveConverter {
         return (T) v8Value;
     }
 
+    /**
+     * Convert a Java object to a V8 value via the V8 value deserializer.
+     * The whole object graph is encoded in one pass and materialized in one native call.
+     *
+     * @param <T>       the type parameter
+     * @param v8Runtime the V8 runtime
+     * @param object    the object
+     * @param depth     the depth
+     * @return the V8 value, or null if the object graph cannot be serialized
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @CheckReturnValue
+    protected <T extends V8Value> T toV8ValueBySerialization(
+            V8Runtime v8Runtime, Object object, final int depth) throws JavetException {
+        ByteBuffer byteBuffer = SERIALIZATION_BUFFER.get();
+        SERIALIZATION_BUFFER.remove();
+        if (byteBuffer == null) {
+            byteBuffer = ByteBuffer.allocateDirect(DEFAULT_SERIALIZATION_BUFFER_SIZE);
+        }
+        try {
+            JavetSerializedValueWriter writer = new JavetSerializedValueWriter(byteBuffer, config.getMaxDepth());
+            try {
+                writer.write(object, depth);
+            } finally {
+                byteBuffer = writer.getByteBuffer();
+            }
+            return v8Runtime.deserialize(byteBuffer, writer.getLength());
+        } catch (JavetConverterException e) {
+            if (e.getError() == JavetError.ConverterCircularStructure) {
+                throw e;
+            }
+            return null;
+        } catch (JavetException e) {
+            // Data that V8 cannot read falls back to the recursive conversion.
+            if (e.getError() == JavetError.RuntimeSerializedDataInvalid) {
+                return null;
+            }
+            throw e;
+        } finally {
+            if (byteBuffer.capacity() <= MAX_CACHED_SERIALIZATION_BUFFER_SIZE) {
+                SERIALIZATION_BUFFER.set(byteBuffer);
+            }
+        }
+    }
+
     /**
      * Unregister custom object.
      *
@@ -70,6 +70,12 @@ public class JavetProxyConverter extends JavetObjectConverter {
         super();
     }
 
+    @Override
+    protected boolean isSerializableObject(Object object) {
+        // Proxy plugins decide per object so that the whole graph cannot be serialized at once.
+        return config.getProxyPlugins().isEmpty() && super.isSerializableObject(object);
+    }
+
     /**
      * To proxied V8 value.
      *
@@ -0,0 +1,601 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop.converters;
+
+import com.caoccao.javet.exceptions.JavetConverterException;
+import com.caoccao.javet.exceptions.JavetException;
+import com.caoccao.javet.utils.JavetDateTimeUtils;
+
+import java.math.BigInteger;
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.Charset;
+import java.nio.charset.StandardCharsets;
+import java.time.ZonedDateTime;
+import java.util.*;
+import java.util.function.Supplier;
+
+/**
+ * The type Javet serialized value reader decodes the V8 value serializer wire format
+ * into Java objects in one pass.
+ * <p>
+ * The output follows {@link JavetObjectConverter}: arrays become lists, sets become sets,
+ * maps and objects become maps with string keys, typed arrays become primitive arrays,
+ * dates become {@link ZonedDateTime} and array buffers become byte arrays.
+ * Values that the recursive conversion treats differently, e.g. errors, regular expressions
+ * and primitive wrapper objects, are rejected with a converter failure so that the caller
+ * can fall back to the recursive conversion.
+ *
+ * @since 5.0.4
+ */
+public final class JavetSerializedValueReader {
+    /**
+     * The constant LATEST_VERSION is the latest wire format version the reader supports.
+     *
+     * @since 5.0.4
+     */
+    public static final int LATEST_VERSION = 15;
+    /**
+     * The constant MIN_VERSION is the earliest wire format version the reader supports.
+     *
+     * @since 5.0.4
+     */
+    public static final int MIN_VERSION = 13;
+    private static final ByteOrder BYTE_ORDER = ByteOrder.nativeOrder();
+    private static final String PUBLIC_PROPERTY_CONSTRUCTOR = "constructor";
+    private static final byte TAG_ARRAY_BUFFER = 'B';
+    private static final byte TAG_ARRAY_BUFFER_VIEW = 'V';
+    private static final byte TAG_BEGIN_DENSE_ARRAY = 'A';
+    private static final byte TAG_BEGIN_JS_MAP = ';';
+    private static final byte TAG_BEGIN_JS_OBJECT = 'o';
+    private static final byte TAG_BEGIN_JS_SET = '\'';
+    private static final byte TAG_BEGIN_SPARSE_ARRAY = 'a';
+    private static final byte TAG_BIGINT = 'Z';
+    private static final byte TAG_DATE = 'D';
+    private static final byte TAG_DOUBLE = 'N';
+    private static final byte TAG_END_DENSE_ARRAY = '$';
+    private static final byte TAG_END_JS_MAP = ':';
+    private static final byte TAG_END_JS_OBJECT = '{';
+    private static final byte TAG_END_JS_SET = ',';
+    private static final byte TAG_END_SPARSE_ARRAY = '@';
+    private static final byte TAG_FALSE = 'F';
+    private static final byte TAG_INT32 = 'I';
+    private static final byte TAG_NULL = '0';
+    private static final byte TAG_OBJECT_REFERENCE = '^';
+    private static final byte TAG_ONE_BYTE_STRING = '"';
+    private static final byte TAG_PADDING = 0;
+    private static final byte TAG_RESIZABLE_ARRAY_BUFFER = '~';
+    private static final byte TAG_THE_HOLE = '-';
+    private static final byte TAG_TRUE = 'T';
+    private static final byte TAG_TWO_BYTE_STRING = 'c';
+    private static final byte TAG_UINT32 = 'U';
+    private static final byte TAG_UNDEFINED = '_';
+    private static final byte TAG_UTF8_STRING = 'S';
+    private static final byte TAG_VERIFY_OBJECT_COUNT = '?';
+    private static final byte TAG_VERSION = (byte) 0xFF;
+    private static final Charset TWO_BYTE_CHARSET = BYTE_ORDER == ByteOrder.LITTLE_ENDIAN
+            ? StandardCharsets.UTF_16LE : StandardCharsets.UTF_16BE;
+    private static final Object UNDEFINED = new Object();
+    private static final byte VIEW_TAG_BIG_INT64_ARRAY = 'q';
+    private static final byte VIEW_TAG_BIG_UINT64_ARRAY = 'Q';
+    private static final byte VIEW_TAG_FLOAT32_ARRAY = 'f';
+    private static final byte VIEW_TAG_FLOAT64_ARRAY = 'F';
+    private static final byte VIEW_TAG_INT16_ARRAY = 'w';
+    private static final byte VIEW_TAG_INT32_ARRAY = 'd';
+    private static final byte VIEW_TAG_INT8_ARRAY = 'b';
+    private static final byte VIEW_TAG_UINT16_ARRAY = 'W';
+    private static final byte VIEW_TAG_UINT32_ARRAY = 'D';
+    private static final byte VIEW_TAG_UINT8_ARRAY = 'B';
+    private static final byte VIEW_TAG_UINT8_CLAMPED_ARRAY = 'C';
+    private final ByteBuffer byteBuffer;
+    private final Supplier<Map<String, Object>> entityMapSupplier;
+    private final int length;
+    private final int maxDepth;
+    private final List<Object> objects;
+    private final BitSet openObjectIds;
+    private int position;
+    private int version;
+
+    /**
+     * Instantiates a new Javet serialized value reader.
+     *
+     * @param byteBuffer        the byte buffer with the serialized data starting at index 0
+     * @param length            the length of the serialized data
+     * @param maxDepth          the max depth
+     * @param entityMapSupplier the supplier of the maps that represent JS maps
+     * @since 5.0.4
+     */
+    public JavetSerializedValueReader(
+            ByteBuffer byteBuffer,
+            int length,
+            int maxDepth,
+            Supplier<Map<String, Object>> entityMapSupplier) {
+        this.byteBuffer = Objects.requireNonNull(byteBuffer).duplicate().order(BYTE_ORDER);
+        this.entityMapSupplier = Objects.requireNonNull(entityMapSupplier);
+        this.length = length;
+        this.maxDepth = maxDepth;
+        objects = new ArrayList<>();
+        openObjectIds = new BitSet();
+        position = 0;
+        version = 0;
+    }
+
+    private static JavetConverterException unsupported(String message) {
+        return new JavetConverterException(message);
+    }
+
+    private void checkRemaining(int size) throws JavetException {
+        if (size < 0 || position + size > length) {
+            throw unsupported("Serialized data is truncated");
+        }
+    }
+
+    private void closeObject(int id) {
+        openObjectIds.clear(id);
+    }
+
+    private ByteBuffer getSlice(int offset) {
+        ByteBuffer slice = byteBuffer.duplicate().order(BYTE_ORDER);
+        ((Buffer) slice).position(offset);
+        return slice;
+    }
+
+    /**
+     * Gets the wire format version from the header.
+     *
+     * @return the version
+     * @since 5.0.4
+     */
+    public int getVersion() {
+        return version;
+    }
+
+    private boolean isNextTag(byte tag) {
+        int peekPosition = position;
+        while (peekPosition < length) {
+            byte nextTag = byteBuffer.get(peekPosition++);
+            if (nextTag != TAG_PADDING) {
+                return nextTag == tag;
+            }
+        }
+        return false;
+    }
+
+    private int openObject(Object object) {
+        int id = objects.size();
+        objects.add(object);
+        openObjectIds.set(id);
+        return id;
+    }
+
+    private byte peekTag() throws JavetException {
+        int peekPosition = position;
+        byte tag;
+        do {
+            if (peekPosition >= length) {
+                throw unsupported("Serialized data is truncated");
+            }
+            tag = byteBuffer.get(peekPosition++);
+        } while (tag == TAG_PADDING);
+        return tag;
+    }
+
+    /**
+     * Read the serialized data as a Java object.
+     *
+     * @param <T>   the type parameter
+     * @param depth the depth of the root value
+     * @return the Java object
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("unchecked")
+    public <T> T read(int depth) throws JavetException {
+        readHeader();
+        Object value = readObject(depth);
+        return value == UNDEFINED ? null : (T) value;
+    }
+
+    private Object readArrayBuffer(int byteLength) throws JavetException {
+        checkRemaining(byteLength);
+        final int offset = position;
+        position += byteLength;
+        final int id = objects.size();
+        if (isNextTag(TAG_ARRAY_BUFFER_VIEW)) {
+            // The view consumes the buffer before it, so that the buffer is not materialized.
+            objects.add(new ArrayBufferSlice(offset, byteLength));
+            readTag();
+            return readArrayBufferView((ArrayBufferSlice) objects.get(id));
+        }
+        byte[] bytes = new byte[byteLength];
+        getSlice(offset).get(bytes);
+        objects.add(bytes);
+        return bytes;
+    }
+
+    private Object readArrayBufferView(ArrayBufferSlice arrayBufferSlice) throws JavetException {
+        final byte subTag = (byte) readVarInt();
+        final int byteOffset = (int) readVarLong();
+        final int byteLength = (int) readVarLong();
+        if (version >= 14) {
+            readVarInt();
+        }
+        if (byteOffset < 0 || byteLength < 0 || byteOffset + byteLength > arrayBufferSlice.length) {
+            throw unsupported("Array buffer view is out of range");
+        }
+        ByteBuffer slice = getSlice(arrayBufferSlice.offset + byteOffset);
+        Object value;
+        switch (subTag) {
+            case VIEW_TAG_INT8_ARRAY:
+            case VIEW_TAG_UINT8_ARRAY:
+            case VIEW_TAG_UINT8_CLAMPED_ARRAY: {
+                byte[] bytes = new byte[byteLength];
+                slice.get(bytes);
+                value = bytes;
+                break;
+            }
+            case VIEW_TAG_INT16_ARRAY:
+            case VIEW_TAG_UINT16_ARRAY: {
+                short[] shorts = new short[byteLength / Short.BYTES];
+                slice.asShortBuffer().get(shorts);
+                value = shorts;
+                break;
+            }
+            case VIEW_TAG_INT32_ARRAY:
+            case VIEW_TAG_UINT32_ARRAY: {
+                int[] integers = new int[byteLength / Integer.BYTES];
+                slice.asIntBuffer().get(integers);
+                value = integers;
+                break;
+            }
+            case VIEW_TAG_FLOAT32_ARRAY: {
+                float[] floats = new float[byteLength / Float.BYTES];
+                slice.asFloatBuffer().get(floats);
+                value = floats;
+                break;
+            }
+            case VIEW_TAG_FLOAT64_ARRAY: {
+                double[] doubles = new double[byteLength / Double.BYTES];
+                slice.asDoubleBuffer().get(doubles);
+                value = doubles;
+                break;
+            }
+            case VIEW_TAG_BIG_INT64_ARRAY:
+            case VIEW_TAG_BIG_UINT64_ARRAY: {
+                long[] longs = new long[byteLength / Long.BYTES];
+                slice.asLongBuffer().get(longs);
+                value = longs;
+                break;
+            }
+            default:
+                throw unsupported("Array buffer view " + (char) subTag + " is not supported");
+        }
+        objects.add(value);
+        return value;
+    }
+
+    private Object readBigInt() throws JavetException {
+        final int bitField = readVarInt();
+        final boolean negative = (bitField & 1) != 0;
+        final int byteLength = (bitField >>> 1) & 0x3FFFFFFF;
+        final int wordCount = byteLength / Long.BYTES;
+        checkRemaining(byteLength);
+        final long[] words = new long[wordCount];
+        getSlice(position).asLongBuffer().get(words);
+        position += byteLength;
+        if (wordCount == 0) {
+            return 0L;
+        }
+        if (wordCount == 1) {
+            // The word is an unsigned magnitude, so only the magnitudes that fit in a long take the fast path.
+            if (words[0] >= 0) {
+                return negative ? -words[0] : words[0];
+            }
+            if (words[0] == Long.MIN_VALUE && negative) {
+                return Long.MIN_VALUE;
+            }
+        }
+        byte[] magnitude = new byte[byteLength];
+        for (int i = 0; i < wordCount; ++i) {
+            long word = words[wordCount - 1 - i];
+            for (int j = 0; j < Long.BYTES; ++j) {
+                magnitude[i * Long.BYTES + j] = (byte) (word >>> ((Long.BYTES - 1 - j) * Byte.SIZE));
+            }
+        }
+        return new BigInteger(negative ? -1 : 1, magnitude);
+    }
+
+    private List<Object> readDenseArray(int depth) throws JavetException {
+        final int arrayLength = readVarInt();
+        if (arrayLength < 0) {
+            throw unsupported("Dense array length " + arrayLength + " is not supported");
+        }
+        final List<Object> list = new ArrayList<>(Math.min(arrayLength, length - position));
+        final int id = openObject(list);
+        for (int i = 0; i < arrayLength; ++i) {
+            if (peekTag() == TAG_THE_HOLE) {
+                readTag();
+                list.add(null);
+            } else {
+                list.add(toValue(readObject(depth + 1)));
+            }
+        }
+        readProperties(TAG_END_DENSE_ARRAY, depth, null);
+        readVarInt();
+        readVarInt();
+        closeObject(id);
+        return list;
+    }
+
+    private double readDouble() throws JavetException {
+        checkRemaining(Double.BYTES);
+        double value = byteBuffer.getDouble(position);
+        position += Double.BYTES;
+        return value;
+    }
+
+    private void readHeader() throws JavetException {
+        if (peekTag() != TAG_VERSION) {
+            throw unsupported("Serialized data has no version header");
+        }
+        readTag();
+        version = readVarInt();
+        if (version < MIN_VERSION || version > LATEST_VERSION) {
+            throw unsupported("Serialized data version " + version + " is not supported");
+        }
+    }
+
+    private Map<String, Object> readJSMap(int depth) throws JavetException {
+        final Map<String, Object> map = entityMapSupplier.get();
+        final int id = openObject(map);
+        while (peekTag() != TAG_END_JS_MAP) {
+            String key = toMapKey(readObject(depth + 1));
+            map.put(key, toValue(readObject(depth + 1)));
+        }
+        readTag();
+        readVarInt();
+        closeObject(id);
+        return map;
+    }
+
+    private Map<String, Object> readJSObject(int depth) throws JavetException {
+        final Map<String, Object> map = new HashMap<>();
+        final int id = openObject(map);
+        readProperties(TAG_END_JS_OBJECT, depth, map);
+        readVarInt();
+        closeObject(id);
+        return map;
+    }
+
+    private Set<Object> readJSSet(int depth) throws JavetException {
+        final Set<Object> set = new HashSet<>();
+        final int id = openObject(set);
+        while (peekTag() != TAG_END_JS_SET) {
+            set.add(toValue(readObject(depth + 1)));
+        }
+        readTag();
+        readVarInt();
+        closeObject(id);
+        return set;
+    }
+
+    private Object readObject(int depth) throws JavetException {
+        if (depth >= maxDepth) {
+            throw JavetConverterException.circularStructure(maxDepth);
+        }
+        byte tag = readTag();
+        while (tag == TAG_VERIFY_OBJECT_COUNT) {
+            readVarInt();
+            tag = readTag();
+        }
+        switch (tag) {
+            case TAG_UNDEFINED:
+                return UNDEFINED;
+            case TAG_NULL:
+                return null;
+            case TAG_TRUE:
+                return Boolean.TRUE;
+            case TAG_FALSE:
+                return Boolean.FALSE;
+            case TAG_INT32: {
+                int value = readVarInt();
+                return (value >>> 1) ^ -(value & 1);
+            }
+            case TAG_UINT32: {
+                long value = readVarInt() & 0xFFFFFFFFL;
+                return value <= Integer.MAX_VALUE ? (Object) (int) value : (Object) (double) value;
+            }
+            case TAG_DOUBLE:
+                return toNumber(readDouble());
+            case TAG_BIGINT:
+                return readBigInt();
+            case TAG_ONE_BYTE_STRING:
+                return readString(StandardCharsets.ISO_8859_1);
+            case TAG_TWO_BYTE_STRING:
+                return readString(TWO_BYTE_CHARSET);
+            case TAG_UTF8_STRING:
+                return readString(StandardCharsets.UTF_8);
+            case TAG_OBJECT_REFERENCE:
+                return readObjectReference();
+            case TAG_BEGIN_JS_OBJECT:
+                return readJSObject(depth);
+            case TAG_BEGIN_DENSE_ARRAY:
+                return readDenseArray(depth);
+            case TAG_BEGIN_SPARSE_ARRAY:
+                return readSparseArray(depth);
+            case TAG_BEGIN_JS_MAP:
+                return readJSMap(depth);
+            case TAG_BEGIN_JS_SET:
+                return readJSSet(depth);
+            case TAG_DATE: {
+                ZonedDateTime zonedDateTime = JavetDateTimeUtils.toZonedDateTime((long) readDouble());
+                objects.add(zonedDateTime);
+                return zonedDateTime;
+            }
+            case TAG_ARRAY_BUFFER:
+                return readArrayBuffer(readVarInt());
+            case TAG_RESIZABLE_ARRAY_BUFFER: {
+                int byteLength = readVarInt();
+                readVarInt();
+                return readArrayBuffer(byteLength);
+            }
+            default:
+                throw unsupported("Serialization tag " + (char) tag + " is not supported");
+        }
+    }
+
+    private Object readObjectReference() throws JavetException {
+        final int id = readVarInt();
+        if (id < 0 || id >= objects.size()) {
+            throw unsupported("Object reference " + id + " is invalid");
+        }
+        if (openObjectIds.get(id)) {
+            throw JavetConverterException.circularStructure(maxDepth);
+        }
+        Object object = objects.get(id);
+        if (object instanceof ArrayBufferSlice) {
+            ArrayBufferSlice arrayBufferSlice = (ArrayBufferSlice) object;
+            if (isNextTag(TAG_ARRAY_BUFFER_VIEW)) {
+                readTag();
+                return readArrayBufferView(arrayBufferSlice);
+            }
+            byte[] bytes = new byte[arrayBufferSlice.length];
+            getSlice(arrayBufferSlice.offset).get(bytes);
+            objects.set(id, bytes);
+            return bytes;
+        }
+        return object;
+    }
+
+    private void readProperties(byte endTag, int depth, Map<String, Object> map) throws JavetException {
+        while (peekTag() != endTag) {
+            Object key = readObject(depth + 1);
+            Object value = readObject(depth + 1);
+            if (map != null && value != UNDEFINED) {
+                String keyString = toMapKey(key);
+                if (PUBLIC_PROPERTY_CONSTRUCTOR.equals(keyString)) {
+                    throw unsupported("Property constructor is not supported");
+                }
+                map.put(keyString, value);
+            }
+        }
+        readTag();
+    }
+
+    private List<Object> readSparseArray(int depth) throws JavetException {
+        final int arrayLength = readVarInt();
+        if (arrayLength < 0 || arrayLength > length - position) {
+            // A sparse array with more holes than bytes is not worth materializing.
+            throw unsupported("Sparse array length " + arrayLength + " is not supported");
+        }
+        final List<Object> list = new ArrayList<>(Collections.nCopies(arrayLength, null));
+        final int id = openObject(list);
+        while (peekTag() != TAG_END_SPARSE_ARRAY) {
+            Object key = readObject(depth + 1);
+            Object value = toValue(readObject(depth + 1));
+            if (key instanceof Integer) {
+                int index = (Integer) key;
+                if (index >= 0 && index < arrayLength) {
+                    list.set(index, value);
+                }
+            }
+        }
+        readTag();
+        readVarInt();
+        readVarInt();
+        closeObject(id);
+        return list;
+    }
+
+    private String readString(Charset charset) throws JavetException {
+        final int byteLength = readVarInt();
+        checkRemaining(byteLength);
+        final byte[] bytes = new byte[byteLength];
+        getSlice(position).get(bytes);
+        position += byteLength;
+        return new String(bytes, charset);
+    }
+
+    private byte readTag() throws JavetException {
+        byte tag;
+        do {
+            checkRemaining(1);
+            tag = byteBuffer.get(position++);
+        } while (tag == TAG_PADDING);
+        return tag;
+    }
+
+    private int readVarInt() throws JavetException {
+        return (int) readVarLong();
+    }
+
+    private long readVarLong() throws JavetException {
+        long value = 0L;
+        int shift = 0;
+        byte b;
+        do {
+            checkRemaining(1);
+            b = byteBuffer.get(position++);
+            if (shift < Long.SIZE) {
+                value |= (long) (b & 0x7F) << shift;
+                shift += 7;
+            }
+        } while ((b & 0x80) != 0);
+        return value;
+    }
+
+    private String toMapKey(Object key) throws JavetException {
+        if (key instanceof String) {
+            return (String) key;
+        } else if (key instanceof Integer || key instanceof Long || key instanceof Boolean) {
+            return key.toString();
+        } else if (key == null) {
+            return "null";
+        } else if (key == UNDEFINED) {
+            return "undefined";
+        } else if (key instanceof Double) {
+            double value = (Double) key;
+            if (value == Math.rint(value) && Math.abs(value) < 1e21) {
+                return Long.toString((long) value);
+            }
+        }
+        throw unsupported("Key " + key + " is not supported");
+    }
+
+    private Object toNumber(double value) {
+        int intValue = (int) value;
+        if (intValue == value && (intValue != 0 || Double.doubleToRawLongBits(value) == 0L)) {
+            return intValue;
+        }
+        return value;
+    }
+
+    private Object toValue(Object value) {
+        return value == UNDEFINED ? null : value;
+    }
+
+    private static final class ArrayBufferSlice {
+        private final int length;
+        private final int offset;
+
+        private ArrayBufferSlice(int offset, int length) {
+            this.length = length;
+            this.offset = offset;
+        }
+    }
+}
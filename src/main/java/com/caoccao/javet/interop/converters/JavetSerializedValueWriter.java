@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop.converters;
+
+import com.caoccao.javet.exceptions.JavetConverterException;
+import com.caoccao.javet.exceptions.JavetException;
+import com.caoccao.javet.interfaces.IJavetEntityMap;
+
+import java.math.BigInteger;
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.time.ZonedDateTime;
+import java.util.*;
+
+/**
+ * The type Javet serialized value writer encodes Java objects in the V8 value serializer wire format
+ * so that the whole value graph can be materialized by the V8 value deserializer in one native call.
+ * <p>
+ * The output follows {@link JavetObjectConverter}: maps become objects, entity maps become maps,
+ * sets become sets, collections and object arrays become arrays, primitive arrays become typed arrays
+ * except for boolean and char arrays, and {@link ZonedDateTime} becomes date.
+ * Objects that the recursive conversion treats specially, e.g. V8 values, entities and custom objects,
+ * are rejected with a converter failure so that the caller can fall back to the recursive conversion.
+ *
+ * @since 5.0.4
+ */
+public final class JavetSerializedValueWriter {
+    /**
+     * The constant VERSION is the wire format version the writer produces.
+     *
+     * @since 5.0.4
+     */
+    public static final int VERSION = 15;
+    private static final ByteOrder BYTE_ORDER = ByteOrder.nativeOrder();
+    private static final byte TAG_ARRAY_BUFFER = 'B';
+    private static final byte TAG_ARRAY_BUFFER_VIEW = 'V';
+    private static final byte TAG_BEGIN_DENSE_ARRAY = 'A';
+    private static final byte TAG_BEGIN_JS_MAP = ';';
+    private static final byte TAG_BEGIN_JS_OBJECT = 'o';
+    private static final byte TAG_BEGIN_JS_SET = '\'';
+    private static final byte TAG_BIGINT = 'Z';
+    private static final byte TAG_DATE = 'D';
+    private static final byte TAG_DOUBLE = 'N';
+    private static final byte TAG_END_DENSE_ARRAY = '$';
+    private static final byte TAG_END_JS_MAP = ':';
+    private static final byte TAG_END_JS_OBJECT = '{';
+    private static final byte TAG_END_JS_SET = ',';
+    private static final byte TAG_FALSE = 'F';
+    private static final byte TAG_INT32 = 'I';
+    private static final byte TAG_NULL = '0';
+    private static final byte TAG_ONE_BYTE_STRING = '"';
+    private static final byte TAG_TRUE = 'T';
+    private static final byte TAG_TWO_BYTE_STRING = 'c';
+    private static final byte TAG_VERSION = (byte) 0xFF;
+    private static final byte VIEW_TAG_BIG_INT64_ARRAY = 'q';
+    private static final byte VIEW_TAG_FLOAT32_ARRAY = 'f';
+    private static final byte VIEW_TAG_FLOAT64_ARRAY = 'F';
+    private static final byte VIEW_TAG_INT16_ARRAY = 'w';
+    private static final byte VIEW_TAG_INT32_ARRAY = 'd';
+    private static final byte VIEW_TAG_INT8_ARRAY = 'b';
+    private final int maxDepth;
+    private ByteBuffer byteBuffer;
+    private int position;
+
+    /**
+     * Instantiates a new Javet serialized value writer.
+     *
+     * @param byteBuffer the initial direct byte buffer
+     * @param maxDepth   the max depth
+     * @since 5.0.4
+     */
+    public JavetSerializedValueWriter(ByteBuffer byteBuffer, int maxDepth) {
+        this.byteBuffer = Objects.requireNonNull(byteBuffer).duplicate().order(BYTE_ORDER);
+        this.maxDepth = maxDepth;
+        position = 0;
+    }
+
+    private static JavetConverterException unsupported(Object object) {
+        return new JavetConverterException(object.getClass().getName() + " is not supported");
+    }
+
+    private void ensureCapacity(int size) {
+        final int requiredCapacity = position + size;
+        if (requiredCapacity > byteBuffer.capacity()) {
+            ByteBuffer newByteBuffer = ByteBuffer.allocateDirect(
+                    Math.max(requiredCapacity, byteBuffer.capacity() * 2)).order(BYTE_ORDER);
+            ((Buffer) byteBuffer).position(0);
+            ((Buffer) byteBuffer).limit(position);
+            newByteBuffer.put(byteBuffer);
+            byteBuffer = newByteBuffer;
+            ((Buffer) byteBuffer).clear();
+        }
+    }
+
+    /**
+     * Gets the byte buffer with the serialized data starting at index 0.
+     * It is a new byte buffer if the initial one is not large enough.
+     *
+     * @return the byte buffer
+     * @since 5.0.4
+     */
+    public ByteBuffer getByteBuffer() {
+        return byteBuffer;
+    }
+
+    /**
+     * Gets the length of the serialized data.
+     *
+     * @return the length
+     * @since 5.0.4
+     */
+    public int getLength() {
+        return position;
+    }
+
+    private ByteBuffer getSlice(int offset) {
+        ByteBuffer slice = byteBuffer.duplicate().order(BYTE_ORDER);
+        ((Buffer) slice).position(offset);
+        return slice;
+    }
+
+    /**
+     * Write the Java object with the header.
+     *
+     * @param object the Java object
+     * @param depth  the depth of the root object
+     * @return the self
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public JavetSerializedValueWriter write(Object object, int depth) throws JavetException {
+        position = 0;
+        writeTag(TAG_VERSION);
+        writeVarLong(VERSION);
+        writeObject(object, depth);
+        return this;
+    }
+
+    private void writeArrayBufferView(byte subTag, int byteLength) {
+        writeTag(TAG_ARRAY_BUFFER_VIEW);
+        writeTag(subTag);
+        writeVarLong(0);
+        writeVarLong(byteLength);
+        writeVarLong(0);
+    }
+
+    private void writeBigInt(int signum, long[] words) {
+        writeTag(TAG_BIGINT);
+        final int byteLength = words.length * Long.BYTES;
+        writeVarLong(((long) byteLength << 1) | (signum < 0 ? 1 : 0));
+        ensureCapacity(byteLength);
+        getSlice(position).asLongBuffer().put(words);
+        position += byteLength;
+    }
+
+    private void writeBigInteger(BigInteger bigInteger) {
+        final BigInteger magnitude = bigInteger.abs();
+        final long[] words = new long[(magnitude.bitLength() + Long.SIZE - 1) / Long.SIZE];
+        for (int i = 0; i < words.length; ++i) {
+            words[i] = magnitude.shiftRight(i * Long.SIZE).longValue();
+        }
+        writeBigInt(bigInteger.signum(), words);
+    }
+
+    private void writeDenseArrayBegin(int length) {
+        writeTag(TAG_BEGIN_DENSE_ARRAY);
+        writeVarLong(length);
+    }
+
+    private void writeDenseArrayEnd(int length) {
+        writeTag(TAG_END_DENSE_ARRAY);
+        writeVarLong(0);
+        writeVarLong(length);
+    }
+
+    private void writeDouble(double value) {
+        writeTag(TAG_DOUBLE);
+        ensureCapacity(Double.BYTES);
+        byteBuffer.putDouble(position, value);
+        position += Double.BYTES;
+    }
+
+    private void writeInt32(int value) {
+        writeTag(TAG_INT32);
+        writeVarLong(((value << 1) ^ (value >> 31)) & 0xFFFFFFFFL);
+    }
+
+    private void writeLong(long value) {
+        if (value == 0L) {
+            writeBigInt(0, new long[0]);
+        } else {
+            writeBigInt(value < 0 ? -1 : 1, new long[]{value < 0 ? -value : value});
+        }
+    }
+
+    private void writeObject(Object object, int depth) throws JavetException {
+        if (depth >= maxDepth) {
+            throw JavetConverterException.circularStructure(maxDepth);
+        }
+        if (object == null) {
+            writeTag(TAG_NULL);
+        } else if (object instanceof Integer) {
+            writeInt32((Integer) object);
+        } else if (object instanceof Boolean) {
+            writeTag((Boolean) object ? TAG_TRUE : TAG_FALSE);
+        } else if (object instanceof String) {
+            writeString((String) object);
+        } else if (object instanceof Double) {
+            writeDouble((Double) object);
+        } else if (object instanceof Float) {
+            writeDouble((Float) object);
+        } else if (object instanceof Long) {
+            writeLong((Long) object);
+        } else if (object instanceof Short) {
+            writeInt32((Short) object);
+        } else if (object instanceof ZonedDateTime) {
+            writeTag(TAG_DATE);
+            ensureCapacity(Double.BYTES);
+            byteBuffer.putDouble(position, ((ZonedDateTime) object).toInstant().toEpochMilli());
+            position += Double.BYTES;
+        } else if (object instanceof Byte) {
+            writeInt32((Byte) object);
+        } else if (object instanceof Character) {
+            writeString(object.toString());
+        } else if (object instanceof BigInteger) {
+            writeBigInteger((BigInteger) object);
+        } else if (object instanceof Optional) {
+            writeObject(((Optional<?>) object).orElse(null), depth);
+        } else if (object instanceof OptionalInt) {
+            OptionalInt optional = (OptionalInt) object;
+            writeObject(optional.isPresent() ? optional.getAsInt() : null, depth);
+        } else if (object instanceof OptionalDouble) {
+            OptionalDouble optional = (OptionalDouble) object;
+            writeObject(optional.isPresent() ? optional.getAsDouble() : null, depth);
+        } else if (object instanceof OptionalLong) {
+            OptionalLong optional = (OptionalLong) object;
+            writeObject(optional.isPresent() ? optional.getAsLong() : null, depth);
+        } else if (object instanceof IJavetEntityMap) {
+            final Map<?, ?> map = (Map<?, ?>) object;
+            writeTag(TAG_BEGIN_JS_MAP);
+            int count = 0;
+            for (Map.Entry<?, ?> entry : map.entrySet()) {
+                writeString(toKey(entry.getKey()));
+                writeObject(entry.getValue(), depth + 1);
+                ++count;
+            }
+            writeTag(TAG_END_JS_MAP);
+            writeVarLong(count << 1);
+        } else if (object instanceof Map) {
+            final Map<?, ?> map = (Map<?, ?>) object;
+            writeTag(TAG_BEGIN_JS_OBJECT);
+            int count = 0;
+            for (Map.Entry<?, ?> entry : map.entrySet()) {
+                writeString(toKey(entry.getKey()));
+                writeObject(entry.getValue(), depth + 1);
+                ++count;
+            }
+            writeTag(TAG_END_JS_OBJECT);
+            writeVarLong(count);
+        } else if (object instanceof Set) {
+            writeTag(TAG_BEGIN_JS_SET);
+            int count = 0;
+            for (Object item : (Set<?>) object) {
+                writeObject(item, depth + 1);
+                ++count;
+            }
+            writeTag(TAG_END_JS_SET);
+            writeVarLong(count);
+        } else if (object instanceof Collection) {
+            final Collection<?> collection = (Collection<?>) object;
+            final int length = collection.size();
+            writeDenseArrayBegin(length);
+            int count = 0;
+            for (Object item : collection) {
+                if (count >= length) {
+                    throw new JavetConverterException("Collection is modified during serialization");
+                }
+                writeObject(item, depth + 1);
+                ++count;
+            }
+            if (count != length) {
+                throw new JavetConverterException("Collection is modified during serialization");
+            }
+            writeDenseArrayEnd(length);
+        } else if (object instanceof Object[]) {
+            final Object[] objects = (Object[]) object;
+            writeDenseArrayBegin(objects.length);
+            for (Object item : objects) {
+                writeObject(item, depth + 1);
+            }
+            writeDenseArrayEnd(objects.length);
+        } else if (object instanceof boolean[]) {
+            final boolean[] booleans = (boolean[]) object;
+            writeDenseArrayBegin(booleans.length);
+            for (boolean item : booleans) {
+                writeTag(item ? TAG_TRUE : TAG_FALSE);
+            }
+            writeDenseArrayEnd(booleans.length);
+        } else if (object instanceof char[]) {
+            final char[] chars = (char[]) object;
+            writeDenseArrayBegin(chars.length);
+            for (char item : chars) {
+                writeString(Character.toString(item));
+            }
+            writeDenseArrayEnd(chars.length);
+        } else if (object instanceof byte[]) {
+            final byte[] bytes = (byte[]) object;
+            writeTypedArrayBuffer(bytes.length);
+            getSlice(position).put(bytes);
+            position += bytes.length;
+            writeArrayBufferView(VIEW_TAG_INT8_ARRAY, bytes.length);
+        } else if (object instanceof double[]) {
+            final double[] doubles = (double[]) object;
+            final int byteLength = doubles.length * Double.BYTES;
+            writeTypedArrayBuffer(byteLength);
+            getSlice(position).asDoubleBuffer().put(doubles);
+            position += byteLength;
+            writeArrayBufferView(VIEW_TAG_FLOAT64_ARRAY, byteLength);
+        } else if (object instanceof float[]) {
+            final float[] floats = (float[]) object;
+            final int byteLength = floats.length * Float.BYTES;
+            writeTypedArrayBuffer(byteLength);
+            getSlice(position).asFloatBuffer().put(floats);
+            position += byteLength;
+            writeArrayBufferView(VIEW_TAG_FLOAT32_ARRAY, byteLength);
+        } else if (object instanceof int[]) {
+            final int[] integers = (int[]) object;
+            final int byteLength = integers.length * Integer.BYTES;
+            writeTypedArrayBuffer(byteLength);
+            getSlice(position).asIntBuffer().put(integers);
+            position += byteLength;
+            writeArrayBufferView(VIEW_TAG_INT32_ARRAY, byteLength);
+        } else if (object instanceof long[]) {
+            final long[] longs = (long[]) object;
+            final int byteLength = longs.length * Long.BYTES;
+            writeTypedArrayBuffer(byteLength);
+            getSlice(position).asLongBuffer().put(longs);
+            position += byteLength;
+            writeArrayBufferView(VIEW_TAG_BIG_INT64_ARRAY, byteLength);
+        } else if (object instanceof short[]) {
+            final short[] shorts = (short[]) object;
+            final int byteLength = shorts.length * Short.BYTES;
+            writeTypedArrayBuffer(byteLength);
+            getSlice(position).asShortBuffer().put(shorts);
+            position += byteLength;
+            writeArrayBufferView(VIEW_TAG_INT16_ARRAY, byteLength);
+        } else {
+            throw unsupported(object);
+        }
+    }
+
+    private void writeString(String value) {
+        final int length = value.length();
+        boolean oneByte = true;
+        for (int i = 0; i < length; ++i) {
+            if (value.charAt(i) > 0xFF) {
+                oneByte = false;
+                break;
+            }
+        }
+        if (oneByte) {
+            writeTag(TAG_ONE_BYTE_STRING);
+            writeVarLong(length);
+            ensureCapacity(length);
+            for (int i = 0; i < length; ++i) {
+                byteBuffer.put(position++, (byte) value.charAt(i));
+            }
+        } else {
+            writeTag(TAG_TWO_BYTE_STRING);
+            writeVarLong((long) length * Character.BYTES);
+            ensureCapacity(length * Character.BYTES);
+            for (int i = 0; i < length; ++i) {
+                byteBuffer.putChar(position, value.charAt(i));
+                position += Character.BYTES;
+            }
+        }
+    }
+
+    private void writeTag(byte tag) {
+        ensureCapacity(1);
+        byteBuffer.put(position++, tag);
+    }
+
+    private void writeTypedArrayBuffer(int byteLength) {
+        writeTag(TAG_ARRAY_BUFFER);
+        writeVarLong(byteLength);
+        ensureCapacity(byteLength);
+    }
+
+    private void writeVarLong(long value) {
+        do {
+            byte b = (byte) (value & 0x7F);
+            value >>>= 7;
+            if (value != 0) {
+                b |= (byte) 0x80;
+            }
+            writeTag(b);
+        } while (value != 0);
+    }
+
+    private String toKey(Object key) throws JavetException {
+        if (key instanceof String) {
+            return (String) key;
+        } else if (key == null) {
+            throw new JavetConverterException("Key cannot be null");
+        }
+        return key.toString();
+    }
+}
@@ -143,6 +143,14 @@ public interface IJavetEnginePool<R extends V8Runtime> extends IJavetClosable {
      */
     int getReleasedEngineCount();
 
+    /**
+     * Gets statistics of the engine creation, the warm-up and the prelude.
+     *
+     * @return the statistics
+     * @since 5.0.4
+     */
+    JavetEnginePoolStatistics getStatistics();
+
     /**
      * Gets V8 shared memory statistics.
      *
@@ -167,15 +167,30 @@ public class JavetEngine<R extends V8Runtime> implements IJavetEngine<R> {
     @Override
     public void resetContext() throws JavetException {
         v8Runtime.resetContext();
+        runPrelude();
         usage.reset();
     }
 
     @Override
     public void resetIsolate() throws JavetException {
         v8Runtime.resetIsolate();
+        runPrelude();
         usage.reset();
     }
 
+    /**
+     * Run the prelude of the pool in a fresh context.
+     *
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    protected void runPrelude() throws JavetException {
+        JavetEnginePrelude prelude = getConfig().getPrelude();
+        if (prelude != null) {
+            prelude.run(v8Runtime);
+        }
+    }
+
     @Override
     public void sendGCNotification() {
         v8Runtime.lowMemoryNotification();
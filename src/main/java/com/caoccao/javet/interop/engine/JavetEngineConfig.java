@@ -18,6 +18,7 @@ package com.caoccao.javet.interop.engine;
 
 import com.caoccao.javet.enums.JSRuntimeType;
 import com.caoccao.javet.interfaces.IJavetLogger;
+import com.caoccao.javet.interop.V8CodeCache;
 import com.caoccao.javet.interop.V8Guard;
 import com.caoccao.javet.utils.JavetDefaultLogger;
 import com.caoccao.javet.utils.JavetOSUtils;
@@ -67,6 +68,12 @@ public final class JavetEngineConfig {
      * @since 0.7.2
      */
     public static final int DEFAULT_POOL_SHUTDOWN_TIMEOUT_SECONDS = 5;
+    /**
+     * The constant DEFAULT_POOL_WARM_UP_THREAD_COUNT.
+     *
+     * @since 5.0.4
+     */
+    public static final int DEFAULT_POOL_WARM_UP_THREAD_COUNT = 0;
     /**
      * The constant DEFAULT_RESET_ENGINE_TIMEOUT_SECONDS.
      *
@@ -117,11 +124,14 @@ public final class JavetEngineConfig {
     private int poolMinSize;
     private int poolShutdownTimeoutSeconds;
     private boolean poolSizeFrozen;
+    private int poolWarmUpThreadCount;
+    private JavetEnginePrelude prelude;
     private int resetEngineTimeoutSeconds;
     private int waitForEngineLogIntervalMillis;
     private int waitForEngineMaxRetryCount;
     private int[] waitForEngineSleepIntervalMillis;
     private byte[] snapshotBlob;
+    private V8CodeCache v8CodeCache;
 
     /**
      * Instantiates a new Javet engine config.
@@ -136,13 +146,16 @@ public final class JavetEngineConfig {
         setDefaultEngineGuardTimeoutMillis(V8Guard.DEFAULT_TIMEOUT_MILLIS);
         setGCBeforeEngineClose(false);
         setJSRuntimeType(DEFAULT_JS_RUNTIME_TYPE);
+        setPrelude(null);
         setSnapshotBlob(null);
+        setV8CodeCache(null);
         poolSizeFrozen = false;
         final int cpuCount = JavetOSUtils.getCPUCount();
         setPoolMinSize(Math.max(DEFAULT_POOL_MIN_SIZE, cpuCount >> 1));
         setPoolMaxSize(Math.max(DEFAULT_POOL_MIN_SIZE, cpuCount));
         setPoolIdleTimeoutSeconds(DEFAULT_POOL_IDLE_TIMEOUT_SECONDS);
         setPoolShutdownTimeoutSeconds(DEFAULT_POOL_SHUTDOWN_TIMEOUT_SECONDS);
+        setPoolWarmUpThreadCount(DEFAULT_POOL_WARM_UP_THREAD_COUNT);
         setPoolDaemonCheckIntervalMillis(DEFAULT_POOL_DAEMON_CHECK_INTERVAL_MILLIS);
         setResetEngineTimeoutSeconds(DEFAULT_RESET_ENGINE_TIMEOUT_SECONDS);
         setWaitForEngineLogIntervalMillis(DEFAULT_WAIT_FOR_ENGINE_LOG_INTERVAL_MILLIS);
@@ -270,6 +283,26 @@ public final class JavetEngineConfig {
         return poolShutdownTimeoutSeconds;
     }
 
+    /**
+     * Gets pool warm-up thread count.
+     *
+     * @return the pool warm-up thread count
+     * @since 5.0.4
+     */
+    public int getPoolWarmUpThreadCount() {
+        return poolWarmUpThreadCount;
+    }
+
+    /**
+     * Gets prelude executed in every engine.
+     *
+     * @return the prelude or null if not set
+     * @since 5.0.4
+     */
+    public JavetEnginePrelude getPrelude() {
+        return prelude;
+    }
+
     /**
      * Gets reset engine timeout seconds.
      *
@@ -280,6 +313,16 @@ public final class JavetEngineConfig {
         return resetEngineTimeoutSeconds;
     }
 
+    /**
+     * Gets V8 code cache shared by the engines.
+     *
+     * @return the V8 code cache or null if not set
+     * @since 5.0.4
+     */
+    public V8CodeCache getV8CodeCache() {
+        return v8CodeCache;
+    }
+
     /**
      * Gets wait for engine log interval millis.
      *
@@ -533,6 +576,35 @@ public final class JavetEngineConfig {
         return this;
     }
 
+    /**
+     * Sets pool warm-up thread count.
+     * If it is greater than 0, the engines are created in parallel by the warm-up threads
+     * before they are handed out, so that the request threads do not create engines.
+     *
+     * @param poolWarmUpThreadCount the pool warm-up thread count or 0 to disable the warm-up
+     * @return the self
+     * @since 5.0.4
+     */
+    @SuppressWarnings("UnusedReturnValue")
+    public JavetEngineConfig setPoolWarmUpThreadCount(int poolWarmUpThreadCount) {
+        assert poolWarmUpThreadCount >= 0 : "The pool warm-up thread count must not be negative.";
+        this.poolWarmUpThreadCount = poolWarmUpThreadCount;
+        return this;
+    }
+
+    /**
+     * Sets prelude executed in every engine before it is handed out.
+     *
+     * @param prelude the prelude or null to disable the prelude
+     * @return the self
+     * @since 5.0.4
+     */
+    @SuppressWarnings("UnusedReturnValue")
+    public JavetEngineConfig setPrelude(JavetEnginePrelude prelude) {
+        this.prelude = prelude;
+        return this;
+    }
+
     /**
      * Sets reset engine timeout seconds.
      *
@@ -547,6 +619,19 @@ public final class JavetEngineConfig {
         return this;
     }
 
+    /**
+     * Sets V8 code cache shared by the engines.
+     *
+     * @param v8CodeCache the V8 code cache or null to disable the lookup
+     * @return the self
+     * @since 5.0.4
+     */
+    @SuppressWarnings("UnusedReturnValue")
+    public JavetEngineConfig setV8CodeCache(V8CodeCache v8CodeCache) {
+        this.v8CodeCache = v8CodeCache;
+        return this;
+    }
+
     /**
      * Sets wait for engine log interval millis.
      *
@@ -16,7 +16,6 @@
 
 package com.caoccao.javet.interop.engine;
 
-import com.caoccao.javet.enums.JSRuntimeType;
 import com.caoccao.javet.exceptions.JavetError;
 import com.caoccao.javet.exceptions.JavetException;
 import com.caoccao.javet.interfaces.IJavetLogger;
@@ -35,8 +34,13 @@ import java.util.Random;
 import java.util.Set;
 import java.util.TreeSet;
 import java.util.concurrent.ConcurrentLinkedQueue;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.RejectedExecutionException;
 import java.util.concurrent.Semaphore;
 import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
 
 /**
  * The type Javet engine pool.
@@ -51,6 +55,30 @@ public class JavetEnginePool<R extends V8Runtime> implements IJavetEnginePool<R>
      * @since 0.8.10
      */
     protected static final String JAVET_DAEMON_THREAD_NAME = "Javet Daemon";
+    /**
+     * The constant JAVET_WARM_UP_THREAD_NAME.
+     *
+     * @since 5.0.4
+     */
+    protected static final String JAVET_WARM_UP_THREAD_NAME = "Javet Warm-up";
+    /**
+     * The Engine create count.
+     *
+     * @since 5.0.4
+     */
+    protected final AtomicLong engineCreateCount;
+    /**
+     * The Engine create time millis.
+     *
+     * @since 5.0.4
+     */
+    protected final AtomicLong engineCreateTimeMillis;
+    /**
+     * The Engine warm-up count.
+     *
+     * @since 5.0.4
+     */
+    protected final AtomicLong engineWarmUpCount;
     /**
      * The External lock.
      *
@@ -75,6 +103,12 @@ public class JavetEnginePool<R extends V8Runtime> implements IJavetEnginePool<R>
      * @since 1.0.5
      */
     protected final ConcurrentLinkedQueue<Integer> releasedEngineIndexList;
+    /**
+     * The Warming up engine count.
+     *
+     * @since 5.0.4
+     */
+    protected final AtomicInteger warmingUpEngineCount;
     /**
      * The Active.
      *
@@ -117,6 +151,12 @@ public class JavetEnginePool<R extends V8Runtime> implements IJavetEnginePool<R>
      * @since 1.1.6
      */
     protected Semaphore semaphore;
+    /**
+     * The Warm-up executor service.
+     *
+     * @since 5.0.4
+     */
+    protected ExecutorService warmUpExecutorService;
 
     /**
      * Instantiates a new Javet engine pool.
@@ -136,6 +176,9 @@ public class JavetEnginePool<R extends V8Runtime> implements IJavetEnginePool<R>
     @SuppressWarnings("unchecked")
     public JavetEnginePool(JavetEngineConfig config) {
         this.config = Objects.requireNonNull(config).freezePoolSize();
+        engineCreateCount = new AtomicLong();
+        engineCreateTimeMillis = new AtomicLong();
+        engineWarmUpCount = new AtomicLong();
         idleEngineIndexList = new ConcurrentLinkedQueue<>();
         releasedEngineIndexList = new ConcurrentLinkedQueue<>();
         engines = new JavetEngine[config.getPoolMaxSize()];
@@ -145,6 +188,8 @@ public class JavetEnginePool<R extends V8Runtime> implements IJavetEnginePool<R>
         quitting = false;
         random = new Random();
         semaphore = null;
+        warmingUpEngineCount = new AtomicInteger();
+        warmUpExecutorService = null;
         startDaemon();
     }
 
@@ -161,25 +206,35 @@ public class JavetEnginePool<R extends V8Runtime> implements IJavetEnginePool<R>
      * @since 0.7.0
      */
     protected JavetEngine<R> createEngine() throws JavetException {
-        JSRuntimeType jsRuntimeType = config.getJSRuntimeType();
-        RuntimeOptions<?> runtimeOptions = jsRuntimeType.getRuntimeOptions();
-        if (runtimeOptions instanceof V8RuntimeOptions) {
-            V8RuntimeOptions v8RuntimeOptions = (V8RuntimeOptions) runtimeOptions;
-            v8RuntimeOptions.setGlobalName(config.getGlobalName());
-            if (config.getSnapshotBlob() != null) {
-                v8RuntimeOptions.setSnapshotBlob(config.getSnapshotBlob());
-            }
+        final long startTime = System.currentTimeMillis();
+        JavetEnginePrelude prelude = config.getPrelude();
+        if (prelude != null) {
+            warmUpPrelude(prelude);
         }
         @SuppressWarnings("ConstantConditions")
-        R v8Runtime = V8Host.getInstance(jsRuntimeType).createV8Runtime(true, runtimeOptions);
+        R v8Runtime = V8Host.getInstance(config.getJSRuntimeType()).createV8Runtime(true, getRuntimeOptions());
         v8Runtime.allowEval(config.isAllowEval());
         v8Runtime.setLogger(config.getJavetLogger());
-        return new JavetEngine<>(this, v8Runtime);
+        v8Runtime.setV8CodeCache(config.getV8CodeCache());
+        JavetEngine<R> engine = new JavetEngine<>(this, v8Runtime);
+        try {
+            engine.runPrelude();
+        } catch (JavetException | RuntimeException e) {
+            try {
+                engine.close(true);
+            } catch (Throwable t) {
+                config.getJavetLogger().logError(t, "Failed to release the engine with a broken prelude.");
+            }
+            throw e;
+        }
+        engineCreateCount.incrementAndGet();
+        engineCreateTimeMillis.addAndGet(System.currentTimeMillis() - startTime);
+        return engine;
     }
 
     @Override
     public int getActiveEngineCount() {
-        return engines.length - getIdleEngineCount() - getReleasedEngineCount();
+        return engines.length - getIdleEngineCount() - getReleasedEngineCount() - warmingUpEngineCount.get();
     }
 
     @Override
@@ -247,6 +302,10 @@ public class JavetEnginePool<R extends V8Runtime> implements IJavetEnginePool<R>
         Objects.requireNonNull(engine).setActive(true);
         JavetEngineUsage usage = engine.getUsage();
         usage.increaseUsedCount();
+        if (warmUpExecutorService != null) {
+            // The daemon replenishes the idle engines in the background.
+            wakeUpDaemon();
+        }
         logger.debug("JavetEnginePool.getEngine() ends.");
         return engine;
     }
@@ -261,6 +320,41 @@ public class JavetEnginePool<R extends V8Runtime> implements IJavetEnginePool<R>
         return releasedEngineIndexList.size();
     }
 
+    /**
+     * Gets runtime options of the engines.
+     *
+     * @return the runtime options
+     * @since 5.0.4
+     */
+    protected RuntimeOptions<?> getRuntimeOptions() {
+        RuntimeOptions<?> runtimeOptions = config.getJSRuntimeType().getRuntimeOptions();
+        if (runtimeOptions instanceof V8RuntimeOptions) {
+            V8RuntimeOptions v8RuntimeOptions = (V8RuntimeOptions) runtimeOptions;
+            v8RuntimeOptions.setGlobalName(config.getGlobalName());
+            if (config.getSnapshotBlob() != null) {
+                v8RuntimeOptions.setSnapshotBlob(config.getSnapshotBlob());
+            }
+        }
+        return runtimeOptions;
+    }
+
+    @Override
+    public JavetEnginePoolStatistics getStatistics() {
+        JavetEnginePrelude prelude = config.getPrelude();
+        return new JavetEnginePoolStatistics(
+                getActiveEngineCount(),
+                engineCreateCount.get(),
+                engineCreateTimeMillis.get(),
+                engineWarmUpCount.get(),
+                getIdleEngineCount(),
+                prelude == null ? 0L : prelude.getCodeCacheConsumedCount(),
+                prelude == null ? 0 : prelude.getCodeCacheCount(),
+                prelude == null ? 0L : prelude.getCodeCacheRejectedCount(),
+                prelude == null ? 0L : prelude.getCompileTimeMillis(),
+                prelude == null ? 0 : prelude.getSize(),
+                warmingUpEngineCount.get());
+    }
+
     /**
      * Gets utc now.
      *
@@ -377,6 +471,7 @@ public class JavetEnginePool<R extends V8Runtime> implements IJavetEnginePool<R>
                     }
                 }
             }
+            warmUpEngines();
             synchronized (externalLock) {
                 try {
                     externalLock.wait(config.getPoolDaemonCheckIntervalMillis());
@@ -392,6 +487,18 @@ public class JavetEnginePool<R extends V8Runtime> implements IJavetEnginePool<R>
                 Integer.toString(getActiveEngineCount()),
                 Integer.toString(getIdleEngineCount()),
                 Integer.toString(engines.length));
+        if (warmUpExecutorService != null) {
+            warmUpExecutorService.shutdown();
+            try {
+                if (!warmUpExecutorService.awaitTermination(config.getPoolShutdownTimeoutSeconds(), TimeUnit.SECONDS)) {
+                    logger.logWarn("The warm-up threads did not quit in {0}s.",
+                            Integer.toString(config.getPoolShutdownTimeoutSeconds()));
+                }
+            } catch (InterruptedException e) {
+                Thread.currentThread().interrupt();
+                logger.logError(e, "Failed to wait for the warm-up threads to quit.");
+            }
+        }
         synchronized (internalLock) {
             Set<Integer> idleEngineIndexSet = new TreeSet<>(idleEngineIndexList);
             Set<Integer> releasedEngineIndexSet = new TreeSet<>(releasedEngineIndexList);
@@ -441,6 +548,15 @@ public class JavetEnginePool<R extends V8Runtime> implements IJavetEnginePool<R>
         }
         semaphore = new Semaphore(engines.length);
         quitting = false;
+        if (config.getPoolWarmUpThreadCount() > 0) {
+            warmUpExecutorService = Executors.newFixedThreadPool(config.getPoolWarmUpThreadCount(), runnable -> {
+                Thread thread = new Thread(runnable);
+                thread.setDaemon(true);
+                thread.setName(JAVET_WARM_UP_THREAD_NAME);
+                return thread;
+            });
+            warmUpEngines();
+        }
         daemonThread = new Thread(this);
         daemonThread.setDaemon(true);
         daemonThread.setName(JAVET_DAEMON_THREAD_NAME);
@@ -470,9 +586,103 @@ public class JavetEnginePool<R extends V8Runtime> implements IJavetEnginePool<R>
         active = false;
         quitting = false;
         semaphore = null;
+        warmUpExecutorService = null;
         logger.debug("JavetEnginePool.stopDaemon() ends.");
     }
 
+    /**
+     * Create an engine in the given released slot on a warm-up thread and hand it over as an idle engine.
+     * The engine is closed instead if the pool started quitting while it was being created,
+     * because the daemon may have released all the engines already.
+     *
+     * @param executorService the warm-up executor service the task runs on
+     * @param index           the index of the released slot
+     * @since 5.0.4
+     */
+    protected void warmUpEngine(ExecutorService executorService, int index) {
+        JavetEngine<R> engine = null;
+        try {
+            if (!quitting) {
+                engine = createEngine();
+                engine.setIndex(index);
+            }
+        } catch (Throwable t) {
+            config.getJavetLogger().logError(t, "Failed to warm up a new engine.");
+        } finally {
+            synchronized (internalLock) {
+                if (engine != null && (quitting || executorService.isShutdown())) {
+                    try {
+                        engine.close(true);
+                    } catch (Throwable t) {
+                        config.getJavetLogger().logError(t, "Failed to release engine.");
+                    }
+                    engine = null;
+                }
+                if (engine != null) {
+                    engines[index] = engine;
+                    engineWarmUpCount.incrementAndGet();
+                    idleEngineIndexList.add(index);
+                } else if (!releasedEngineIndexList.contains(index)) {
+                    releasedEngineIndexList.add(index);
+                }
+            }
+            warmingUpEngineCount.decrementAndGet();
+        }
+    }
+
+    /**
+     * Create engines in parallel on the warm-up threads until the idle engines and the engines being created
+     * reach the pool min size, so that the request threads get engines that are ready.
+     *
+     * @since 5.0.4
+     */
+    protected void warmUpEngines() {
+        final ExecutorService executorService = warmUpExecutorService;
+        if (executorService == null) {
+            return;
+        }
+        int count = config.getPoolMinSize() - getIdleEngineCount() - warmingUpEngineCount.get();
+        while (count > 0 && !quitting) {
+            warmingUpEngineCount.incrementAndGet();
+            final Integer index = releasedEngineIndexList.poll();
+            if (index == null) {
+                warmingUpEngineCount.decrementAndGet();
+                break;
+            }
+            try {
+                executorService.execute(() -> warmUpEngine(executorService, index));
+            } catch (RejectedExecutionException e) {
+                releasedEngineIndexList.add(index);
+                warmingUpEngineCount.decrementAndGet();
+                break;
+            }
+            --count;
+        }
+    }
+
+    /**
+     * Compile and execute the prelude once in a dedicated warm-up V8 runtime to produce the code caches.
+     * A failure is logged and the engines run the prelude without the code caches.
+     *
+     * @param prelude the prelude
+     * @since 5.0.4
+     */
+    protected void warmUpPrelude(JavetEnginePrelude prelude) {
+        if (prelude.isWarmedUp()) {
+            return;
+        }
+        synchronized (prelude) {
+            if (!prelude.isWarmedUp()) {
+                try (V8Runtime v8Runtime = V8Host.getInstance(config.getJSRuntimeType())
+                        .createV8Runtime(getRuntimeOptions())) {
+                    prelude.warmUp(v8Runtime);
+                } catch (Throwable t) {
+                    config.getJavetLogger().logError(t, "Failed to warm up the prelude.");
+                }
+            }
+        }
+    }
+
     @Override
     public void wakeUpDaemon() {
         synchronized (externalLock) {
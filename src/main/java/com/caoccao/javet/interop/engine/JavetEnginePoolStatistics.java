@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop.engine;
+
+/**
+ * The type Javet engine pool statistics is a snapshot of a Javet engine pool.
+ *
+ * @since 5.0.4
+ */
+public final class JavetEnginePoolStatistics {
+    private final int activeEngineCount;
+    private final long engineCreateCount;
+    private final long engineCreateTimeMillis;
+    private final long engineWarmUpCount;
+    private final int idleEngineCount;
+    private final long preludeCodeCacheConsumedCount;
+    private final int preludeCodeCacheCount;
+    private final long preludeCodeCacheRejectedCount;
+    private final long preludeCompileTimeMillis;
+    private final int preludeSize;
+    private final int warmingUpEngineCount;
+
+    /**
+     * Instantiates a new Javet engine pool statistics.
+     *
+     * @param activeEngineCount             the count of the engines in use
+     * @param engineCreateCount             the count of the created engines
+     * @param engineCreateTimeMillis        the total time spent on creating the engines
+     * @param engineWarmUpCount             the count of the engines created by the warm-up threads
+     * @param idleEngineCount               the count of the engines ready to be handed out
+     * @param preludeCodeCacheConsumedCount the count of the prelude scripts executed with an accepted code cache
+     * @param preludeCodeCacheCount         the count of the prelude scripts that have a code cache
+     * @param preludeCodeCacheRejectedCount the count of the prelude scripts executed with a rejected code cache
+     * @param preludeCompileTimeMillis      the time spent on compiling the prelude
+     * @param preludeSize                   the count of the prelude scripts
+     * @param warmingUpEngineCount          the count of the engines being created by the warm-up threads
+     * @since 5.0.4
+     */
+    public JavetEnginePoolStatistics(
+            int activeEngineCount,
+            long engineCreateCount,
+            long engineCreateTimeMillis,
+            long engineWarmUpCount,
+            int idleEngineCount,
+            long preludeCodeCacheConsumedCount,
+            int preludeCodeCacheCount,
+            long preludeCodeCacheRejectedCount,
+            long preludeCompileTimeMillis,
+            int preludeSize,
+            int warmingUpEngineCount) {
+        this.activeEngineCount = activeEngineCount;
+        this.engineCreateCount = engineCreateCount;
+        this.engineCreateTimeMillis = engineCreateTimeMillis;
+        this.engineWarmUpCount = engineWarmUpCount;
+        this.idleEngineCount = idleEngineCount;
+        this.preludeCodeCacheConsumedCount = preludeCodeCacheConsumedCount;
+        this.preludeCodeCacheCount = preludeCodeCacheCount;
+        this.preludeCodeCacheRejectedCount = preludeCodeCacheRejectedCount;
+        this.preludeCompileTimeMillis = preludeCompileTimeMillis;
+        this.preludeSize = preludeSize;
+        this.warmingUpEngineCount = warmingUpEngineCount;
+    }
+
+    /**
+     * Gets count of the engines in use.
+     *
+     * @return the count of the engines in use
+     * @since 5.0.4
+     */
+    public int getActiveEngineCount() {
+        return activeEngineCount;
+    }
+
+    /**
+     * Gets count of the created engines.
+     *
+     * @return the count of the created engines
+     * @since 5.0.4
+     */
+    public long getEngineCreateCount() {
+        return engineCreateCount;
+    }
+
+    /**
+     * Gets total time spent on creating the engines including the prelude.
+     *
+     * @return the total time spent on creating the engines
+     * @since 5.0.4
+     */
+    public long getEngineCreateTimeMillis() {
+        return engineCreateTimeMillis;
+    }
+
+    /**
+     * Gets count of the engines created by the warm-up threads.
+     *
+     * @return the count of the engines created by the warm-up threads
+     * @since 5.0.4
+     */
+    public long getEngineWarmUpCount() {
+        return engineWarmUpCount;
+    }
+
+    /**
+     * Gets count of the engines ready to be handed out.
+     *
+     * @return the count of the engines ready to be handed out
+     * @since 5.0.4
+     */
+    public int getIdleEngineCount() {
+        return idleEngineCount;
+    }
+
+    /**
+     * Gets count of the prelude scripts executed with an accepted code cache.
+     *
+     * @return the count of the prelude scripts executed with an accepted code cache
+     * @since 5.0.4
+     */
+    public long getPreludeCodeCacheConsumedCount() {
+        return preludeCodeCacheConsumedCount;
+    }
+
+    /**
+     * Gets count of the prelude scripts that have a code cache.
+     *
+     * @return the count of the prelude scripts that have a code cache
+     * @since 5.0.4
+     */
+    public int getPreludeCodeCacheCount() {
+        return preludeCodeCacheCount;
+    }
+
+    /**
+     * Gets count of the prelude scripts executed with a rejected code cache.
+     *
+     * @return the count of the prelude scripts executed with a rejected code cache
+     * @since 5.0.4
+     */
+    public long getPreludeCodeCacheRejectedCount() {
+        return preludeCodeCacheRejectedCount;
+    }
+
+    /**
+     * Gets time spent on compiling the prelude in the warm-up V8 runtime.
+     *
+     * @return the time spent on compiling the prelude
+     * @since 5.0.4
+     */
+    public long getPreludeCompileTimeMillis() {
+        return preludeCompileTimeMillis;
+    }
+
+    /**
+     * Gets count of the prelude scripts.
+     *
+     * @return the count of the prelude scripts
+     * @since 5.0.4
+     */
+    public int getPreludeSize() {
+        return preludeSize;
+    }
+
+    /**
+     * Gets count of the engines being created by the warm-up threads.
+     *
+     * @return the count of the engines being created by the warm-up threads
+     * @since 5.0.4
+     */
+    public int getWarmingUpEngineCount() {
+        return warmingUpEngineCount;
+    }
+}
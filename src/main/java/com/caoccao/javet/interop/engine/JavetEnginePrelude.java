@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop.engine;
+
+import com.caoccao.javet.exceptions.JavetException;
+import com.caoccao.javet.interop.V8Runtime;
+import com.caoccao.javet.interop.executors.IV8Executor;
+import com.caoccao.javet.values.reference.V8Module;
+import com.caoccao.javet.values.reference.V8Script;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Objects;
+import java.util.concurrent.atomic.AtomicLong;
+
+/**
+ * The type Javet engine prelude.
+ * <p>
+ * It is a list of scripts and modules executed in every engine of a pool before the engine is handed out.
+ * The prelude is compiled and executed once in a dedicated warm-up V8 runtime to produce the code caches,
+ * so that every engine consumes the code caches instead of compiling the prelude from scratch.
+ * The prelude cannot be changed once it is warmed up.
+ *
+ * @since 5.0.4
+ */
+public final class JavetEnginePrelude {
+    private final AtomicLong codeCacheConsumedCount;
+    private final AtomicLong codeCacheRejectedCount;
+    private final List<Entry> entries;
+    private final AtomicLong runCount;
+    private volatile long compileTimeMillis;
+    private volatile boolean warmedUp;
+
+    /**
+     * Instantiates a new Javet engine prelude.
+     *
+     * @since 5.0.4
+     */
+    public JavetEnginePrelude() {
+        codeCacheConsumedCount = new AtomicLong();
+        codeCacheRejectedCount = new AtomicLong();
+        compileTimeMillis = 0L;
+        entries = new ArrayList<>();
+        runCount = new AtomicLong();
+        warmedUp = false;
+    }
+
+    private synchronized JavetEnginePrelude add(String resourceName, String scriptString, boolean module) {
+        if (warmedUp) {
+            throw new IllegalStateException("The prelude cannot be changed once it is warmed up.");
+        }
+        entries.add(new Entry(Objects.requireNonNull(resourceName), Objects.requireNonNull(scriptString), module));
+        return this;
+    }
+
+    /**
+     * Add a module.
+     *
+     * @param resourceName the resource name
+     * @param scriptString the script string
+     * @return the self
+     * @since 5.0.4
+     */
+    public JavetEnginePrelude addModule(String resourceName, String scriptString) {
+        return add(resourceName, scriptString, true);
+    }
+
+    /**
+     * Add a script.
+     *
+     * @param resourceName the resource name
+     * @param scriptString the script string
+     * @return the self
+     * @since 5.0.4
+     */
+    public JavetEnginePrelude addScript(String resourceName, String scriptString) {
+        return add(resourceName, scriptString, false);
+    }
+
+    /**
+     * Gets the count of the scripts and modules in the prelude that have a code cache.
+     *
+     * @return the code cache count
+     * @since 5.0.4
+     */
+    public synchronized int getCodeCacheCount() {
+        int codeCacheCount = 0;
+        for (Entry entry : entries) {
+            if (entry.cachedData != null) {
+                ++codeCacheCount;
+            }
+        }
+        return codeCacheCount;
+    }
+
+    /**
+     * Gets the count of the scripts and modules executed with an accepted code cache in the engines.
+     *
+     * @return the code cache consumed count
+     * @since 5.0.4
+     */
+    public long getCodeCacheConsumedCount() {
+        return codeCacheConsumedCount.get();
+    }
+
+    /**
+     * Gets the count of the scripts and modules executed with a rejected code cache in the engines.
+     * A rejected code cache means the engines do not match the warm-up V8 runtime, e.g. in V8 flags.
+     *
+     * @return the code cache rejected count
+     * @since 5.0.4
+     */
+    public long getCodeCacheRejectedCount() {
+        return codeCacheRejectedCount.get();
+    }
+
+    /**
+     * Gets the time spent on compiling the prelude in the warm-up V8 runtime.
+     *
+     * @return the compile time millis
+     * @since 5.0.4
+     */
+    public long getCompileTimeMillis() {
+        return compileTimeMillis;
+    }
+
+    /**
+     * Gets the count of the scripts and modules in the prelude.
+     *
+     * @return the size
+     * @since 5.0.4
+     */
+    public synchronized int getSize() {
+        return entries.size();
+    }
+
+    /**
+     * Gets the count of the prelude runs in the engines.
+     *
+     * @return the run count
+     * @since 5.0.4
+     */
+    public long getRunCount() {
+        return runCount.get();
+    }
+
+    /**
+     * Is warmed up.
+     *
+     * @return true : warmed up, false : not warmed up
+     * @since 5.0.4
+     */
+    public boolean isWarmedUp() {
+        return warmedUp;
+    }
+
+    /**
+     * Run the prelude in the given V8 runtime with the code caches produced by the warm-up.
+     *
+     * @param v8Runtime the V8 runtime
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public void run(V8Runtime v8Runtime) throws JavetException {
+        Objects.requireNonNull(v8Runtime);
+        final List<Entry> snapshot;
+        synchronized (this) {
+            snapshot = new ArrayList<>(entries);
+        }
+        for (Entry entry : snapshot) {
+            byte[] cachedData = entry.cachedData;
+            IV8Executor iV8Executor = v8Runtime.getExecutor(entry.scriptString, cachedData)
+                    .setResourceName(entry.resourceName)
+                    .setModule(entry.module);
+            iV8Executor.executeVoid();
+            if (cachedData != null) {
+                if (iV8Executor.isCachedDataRejected()) {
+                    codeCacheRejectedCount.incrementAndGet();
+                } else {
+                    codeCacheConsumedCount.incrementAndGet();
+                }
+            }
+        }
+        runCount.incrementAndGet();
+    }
+
+    /**
+     * Warm up the prelude in the given dedicated V8 runtime.
+     * Every script and module is compiled and executed once, and the code cache is created after the execution
+     * so that the lazily compiled functions are included. The warm-up only happens once.
+     *
+     * @param v8Runtime the dedicated V8 runtime
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public synchronized void warmUp(V8Runtime v8Runtime) throws JavetException {
+        if (warmedUp) {
+            return;
+        }
+        Objects.requireNonNull(v8Runtime);
+        final long startTime = System.currentTimeMillis();
+        try {
+            for (Entry entry : entries) {
+                IV8Executor iV8Executor = v8Runtime.getExecutor(entry.scriptString)
+                        .setResourceName(entry.resourceName)
+                        .setModule(entry.module);
+                if (entry.module) {
+                    try (V8Module v8Module = iV8Executor.compileV8Module()) {
+                        v8Module.executeVoid();
+                        entry.cachedData = v8Module.getCachedData();
+                    }
+                } else {
+                    try (V8Script v8Script = iV8Executor.compileV8Script()) {
+                        v8Script.executeVoid();
+                        entry.cachedData = v8Script.getCachedData();
+                    }
+                }
+            }
+        } finally {
+            compileTimeMillis = System.currentTimeMillis() - startTime;
+            warmedUp = true;
+        }
+    }
+
+    private static final class Entry {
+        private final boolean module;
+        private final String resourceName;
+        private final String scriptString;
+        private volatile byte[] cachedData;
+
+        private Entry(String resourceName, String scriptString, boolean module) {
+            cachedData = null;
+            this.module = module;
+            this.resourceName = resourceName;
+            this.scriptString = scriptString;
+        }
+    }
+}
@@ -20,6 +20,7 @@ import com.caoccao.javet.annotations.CheckReturnValue;
 import com.caoccao.javet.exceptions.JavetException;
 import com.caoccao.javet.interop.IV8Executable;
 import com.caoccao.javet.interop.NodeRuntime;
+import com.caoccao.javet.interop.V8CompileHints;
 import com.caoccao.javet.interop.V8Runtime;
 import com.caoccao.javet.interop.V8ScriptOrigin;
 import com.caoccao.javet.node.modules.NodeModuleModule;
@@ -186,6 +187,18 @@ public interface IV8Executor extends IV8Executable {
      */
     V8ScriptOrigin getV8ScriptOrigin();
 
+    /**
+     * Is cached data rejected by V8 in the last compilation or execution.
+     * A rejected cached data is stale, e.g. after a V8 upgrade, a flag change or a source change,
+     * and the source was compiled from scratch instead.
+     *
+     * @return true : rejected, false : accepted or not given
+     * @since 5.0.4
+     */
+    default boolean isCachedDataRejected() {
+        return getV8ScriptOrigin().isCachedDataRejected();
+    }
+
     /**
      * Is module boolean.
      *
@@ -196,6 +209,45 @@ public interface IV8Executor extends IV8Executable {
         return getV8ScriptOrigin().isModule();
     }
 
+    /**
+     * Sets compile hints recorded from a previous run of the same source.
+     * The functions at the hinted positions are compiled eagerly. It is ignored by modules.
+     *
+     * @param compileHints the compile hints or null
+     * @return the self
+     * @since 5.0.4
+     */
+    default IV8Executor setCompileHints(V8CompileHints compileHints) {
+        getV8ScriptOrigin().setCompileHints(compileHints);
+        return this;
+    }
+
+    /**
+     * Sets eager compile so that all functions are compiled upfront instead of lazily.
+     * It takes precedence over the compile hints. It is ignored by modules.
+     *
+     * @param eagerCompile the eager compile
+     * @return the self
+     * @since 5.0.4
+     */
+    default IV8Executor setEagerCompile(boolean eagerCompile) {
+        getV8ScriptOrigin().setEagerCompile(eagerCompile);
+        return this;
+    }
+
+    /**
+     * Sets follow compile hints magic comment so that V8 honors
+     * the {@code //# allFunctionsCalledOnLoad} magic comment in the source. It is ignored by modules.
+     *
+     * @param followCompileHintsMagicComment the follow compile hints magic comment
+     * @return the self
+     * @since 5.0.4
+     */
+    default IV8Executor setFollowCompileHintsMagicComment(boolean followCompileHintsMagicComment) {
+        getV8ScriptOrigin().setFollowCompileHintsMagicComment(followCompileHintsMagicComment);
+        return this;
+    }
+
     /**
      * Sets module.
      *
@@ -208,6 +260,20 @@ public interface IV8Executor extends IV8Executable {
         return this;
     }
 
+    /**
+     * Sets produce compile hints so that the compiled script records the functions that actually run,
+     * which can be read via {@link com.caoccao.javet.values.reference.IV8Script#getCompileHints()}.
+     * The compile hints are not consumed while they are being produced. It is ignored by modules.
+     *
+     * @param produceCompileHints the produce compile hints
+     * @return the self
+     * @since 5.0.4
+     */
+    default IV8Executor setProduceCompileHints(boolean produceCompileHints) {
+        getV8ScriptOrigin().setProduceCompileHints(produceCompileHints);
+        return this;
+    }
+
     /**
      * Sets resource name.
      *
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop.executors;
+
+import com.caoccao.javet.annotations.CheckReturnValue;
+import com.caoccao.javet.exceptions.JavetException;
+import com.caoccao.javet.interop.V8ExternalSource;
+import com.caoccao.javet.interop.V8Runtime;
+import com.caoccao.javet.values.V8Value;
+import com.caoccao.javet.values.reference.V8Module;
+import com.caoccao.javet.values.reference.V8Script;
+import com.caoccao.javet.values.reference.V8ValueFunction;
+import com.caoccao.javet.values.reference.V8ValueObject;
+
+import java.util.Objects;
+
+/**
+ * The type V8 external source executor.
+ * The script source is shared with V8 without copying.
+ *
+ * @since 5.0.4
+ */
+public class V8ExternalSourceExecutor extends BaseV8Executor {
+
+    /**
+     * The Cached data.
+     *
+     * @since 5.0.4
+     */
+    protected byte[] cachedData;
+    /**
+     * The V8 external source.
+     *
+     * @since 5.0.4
+     */
+    protected V8ExternalSource v8ExternalSource;
+
+    /**
+     * Instantiates a new V8 external source executor.
+     *
+     * @param v8Runtime        the V8 runtime
+     * @param v8ExternalSource the V8 external source
+     * @since 5.0.4
+     */
+    public V8ExternalSourceExecutor(V8Runtime v8Runtime, V8ExternalSource v8ExternalSource) {
+        this(v8Runtime, v8ExternalSource, null);
+    }
+
+    /**
+     * Instantiates a new V8 external source executor.
+     *
+     * @param v8Runtime        the V8 runtime
+     * @param v8ExternalSource the V8 external source
+     * @param cachedData       the cached data
+     * @since 5.0.4
+     */
+    public V8ExternalSourceExecutor(V8Runtime v8Runtime, V8ExternalSource v8ExternalSource, byte[] cachedData) {
+        super(v8Runtime);
+        this.v8ExternalSource = Objects.requireNonNull(v8ExternalSource);
+        this.cachedData = cachedData;
+    }
+
+    @Override
+    @CheckReturnValue
+    public V8Module compileV8Module(boolean resultRequired) throws JavetException {
+        return v8Runtime.compileV8Module(v8ExternalSource, getCachedData(), v8ScriptOrigin, resultRequired);
+    }
+
+    @Override
+    @CheckReturnValue
+    public V8Script compileV8Script(boolean resultRequired) throws JavetException {
+        return v8Runtime.compileV8Script(v8ExternalSource, getCachedData(), v8ScriptOrigin, resultRequired);
+    }
+
+    @Override
+    @CheckReturnValue
+    public V8ValueFunction compileV8ValueFunction(
+            String[] arguments, V8ValueObject[] contextExtensions)
+            throws JavetException {
+        return v8Runtime.compileV8ValueFunction(
+                v8ExternalSource, getCachedData(), v8ScriptOrigin, arguments, contextExtensions);
+    }
+
+    @Override
+    @CheckReturnValue
+    public <T extends V8Value> T execute(boolean resultRequired) throws JavetException {
+        return v8Runtime.execute(v8ExternalSource, getCachedData(), v8ScriptOrigin, resultRequired);
+    }
+
+    @Override
+    public byte[] getCachedData() {
+        return cachedData;
+    }
+
+    /**
+     * Gets the script string.
+     * It decodes a copy of the V8 external source, so it should not be called in hot paths.
+     *
+     * @return the script string
+     * @throws JavetException the javet exception
+     */
+    @Override
+    public String getScriptString() throws JavetException {
+        return v8ExternalSource.toString();
+    }
+
+    /**
+     * Gets V8 external source.
+     *
+     * @return the V8 external source
+     * @since 5.0.4
+     */
+    public V8ExternalSource getV8ExternalSource() {
+        return v8ExternalSource;
+    }
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop.monitoring;
+
+/**
+ * The type V8 array buffer statistics is a snapshot of the per-runtime array buffer allocator.
+ * The byte counters are the lengths requested by V8, not the sizes rounded up by the pools.
+ *
+ * @since 5.0.4
+ */
+public final class V8ArrayBufferStatistics {
+    private final long allocatedBytes;
+    private final long allocationCount;
+    private final long hugePageBytes;
+    private final long maxAllocatedBytes;
+    private final long peakAllocatedBytes;
+    private final long poolHitCount;
+    private final long pooledBytes;
+    private final long rejectionCount;
+
+    /**
+     * Instantiates a new V8 array buffer statistics.
+     *
+     * @param allocatedBytes     the bytes held by live array buffers
+     * @param allocationCount    the count of successful allocations
+     * @param hugePageBytes      the bytes mapped for large array buffers with huge page advice
+     * @param maxAllocatedBytes  the max allocated bytes, 0 means unlimited
+     * @param peakAllocatedBytes the peak allocated bytes
+     * @param poolHitCount       the count of allocations served by the pools
+     * @param pooledBytes        the bytes kept in the pools for reuse
+     * @param rejectionCount     the count of rejected allocations
+     * @since 5.0.4
+     */
+    public V8ArrayBufferStatistics(
+            long allocatedBytes,
+            long allocationCount,
+            long hugePageBytes,
+            long maxAllocatedBytes,
+            long peakAllocatedBytes,
+            long poolHitCount,
+            long pooledBytes,
+            long rejectionCount) {
+        this.allocatedBytes = allocatedBytes;
+        this.allocationCount = allocationCount;
+        this.hugePageBytes = hugePageBytes;
+        this.maxAllocatedBytes = maxAllocatedBytes;
+        this.peakAllocatedBytes = peakAllocatedBytes;
+        this.poolHitCount = poolHitCount;
+        this.pooledBytes = pooledBytes;
+        this.rejectionCount = rejectionCount;
+    }
+
+    /**
+     * Gets bytes held by live array buffers.
+     *
+     * @return the bytes held by live array buffers
+     * @since 5.0.4
+     */
+    public long getAllocatedBytes() {
+        return allocatedBytes;
+    }
+
+    /**
+     * Gets count of successful allocations.
+     *
+     * @return the count of successful allocations
+     * @since 5.0.4
+     */
+    public long getAllocationCount() {
+        return allocationCount;
+    }
+
+    /**
+     * Gets bytes mapped for large array buffers with huge page advice.
+     *
+     * @return the bytes mapped for large array buffers with huge page advice
+     * @since 5.0.4
+     */
+    public long getHugePageBytes() {
+        return hugePageBytes;
+    }
+
+    /**
+     * Gets max allocated bytes, 0 means unlimited.
+     *
+     * @return the max allocated bytes, 0 means unlimited
+     * @since 5.0.4
+     */
+    public long getMaxAllocatedBytes() {
+        return maxAllocatedBytes;
+    }
+
+    /**
+     * Gets peak allocated bytes.
+     *
+     * @return the peak allocated bytes
+     * @since 5.0.4
+     */
+    public long getPeakAllocatedBytes() {
+        return peakAllocatedBytes;
+    }
+
+    /**
+     * Gets count of allocations served by the pools.
+     *
+     * @return the count of allocations served by the pools
+     * @since 5.0.4
+     */
+    public long getPoolHitCount() {
+        return poolHitCount;
+    }
+
+    /**
+     * Gets bytes kept in the pools for reuse.
+     *
+     * @return the bytes kept in the pools for reuse
+     * @since 5.0.4
+     */
+    public long getPooledBytes() {
+        return pooledBytes;
+    }
+
+    /**
+     * Gets count of rejected allocations.
+     *
+     * @return the count of rejected allocations
+     * @since 5.0.4
+     */
+    public long getRejectionCount() {
+        return rejectionCount;
+    }
+
+    @Override
+    public String toString() {
+        return toString(false);
+    }
+
+    /**
+     * To string with zero value ignored or not.
+     *
+     * @param ignoreZero ignore zero
+     * @return the string
+     * @since 5.0.4
+     */
+    public String toString(boolean ignoreZero) {
+        StringBuilder sb = new StringBuilder();
+        sb.append("name = ").append(getClass().getSimpleName());
+        if (!ignoreZero || allocatedBytes != 0)
+            sb.append(", ").append("allocatedBytes = ").append(allocatedBytes);
+        if (!ignoreZero || allocationCount != 0)
+            sb.append(", ").append("allocationCount = ").append(allocationCount);
+        if (!ignoreZero || hugePageBytes != 0)
+            sb.append(", ").append("hugePageBytes = ").append(hugePageBytes);
+        if (!ignoreZero || maxAllocatedBytes != 0)
+            sb.append(", ").append("maxAllocatedBytes = ").append(maxAllocatedBytes);
+        if (!ignoreZero || peakAllocatedBytes != 0)
+            sb.append(", ").append("peakAllocatedBytes = ").append(peakAllocatedBytes);
+        if (!ignoreZero || poolHitCount != 0)
+            sb.append(", ").append("poolHitCount = ").append(poolHitCount);
+        if (!ignoreZero || pooledBytes != 0)
+            sb.append(", ").append("pooledBytes = ").append(pooledBytes);
+        if (!ignoreZero || rejectionCount != 0)
+            sb.append(", ").append("rejectionCount = ").append(rejectionCount);
+        return sb.toString();
+    }
+}
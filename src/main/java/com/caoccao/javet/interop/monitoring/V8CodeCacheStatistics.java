@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop.monitoring;
+
+/**
+ * The type V8 code cache statistics is a snapshot of a V8 code cache.
+ *
+ * @since 5.0.4
+ */
+public final class V8CodeCacheStatistics {
+    private final long bytes;
+    private final long diskHitCount;
+    private final long evictCount;
+    private final long hitCount;
+    private final long missCount;
+    private final long rejectCount;
+    private final long size;
+    private final long storeCount;
+
+    /**
+     * Instantiates a new V8 code cache statistics.
+     *
+     * @param bytes        the byte length of the code caches in memory
+     * @param diskHitCount the count of the lookups served by the directory
+     * @param evictCount   the count of the evicted code caches
+     * @param hitCount     the count of the lookups served by the memory
+     * @param missCount    the count of the lookups that found nothing
+     * @param rejectCount  the count of the code caches rejected by V8
+     * @param size         the count of the code caches in memory
+     * @param storeCount   the count of the stored code caches
+     * @since 5.0.4
+     */
+    public V8CodeCacheStatistics(
+            long bytes,
+            long diskHitCount,
+            long evictCount,
+            long hitCount,
+            long missCount,
+            long rejectCount,
+            long size,
+            long storeCount) {
+        this.bytes = bytes;
+        this.diskHitCount = diskHitCount;
+        this.evictCount = evictCount;
+        this.hitCount = hitCount;
+        this.missCount = missCount;
+        this.rejectCount = rejectCount;
+        this.size = size;
+        this.storeCount = storeCount;
+    }
+
+    /**
+     * Gets byte length of the code caches in memory.
+     *
+     * @return the byte length of the code caches in memory
+     * @since 5.0.4
+     */
+    public long getBytes() {
+        return bytes;
+    }
+
+    /**
+     * Gets count of the lookups served by the directory.
+     *
+     * @return the count of the lookups served by the directory
+     * @since 5.0.4
+     */
+    public long getDiskHitCount() {
+        return diskHitCount;
+    }
+
+    /**
+     * Gets count of the evicted code caches.
+     *
+     * @return the count of the evicted code caches
+     * @since 5.0.4
+     */
+    public long getEvictCount() {
+        return evictCount;
+    }
+
+    /**
+     * Gets count of the lookups served by the memory.
+     *
+     * @return the count of the lookups served by the memory
+     * @since 5.0.4
+     */
+    public long getHitCount() {
+        return hitCount;
+    }
+
+    /**
+     * Gets count of the lookups that found nothing.
+     *
+     * @return the count of the lookups that found nothing
+     * @since 5.0.4
+     */
+    public long getMissCount() {
+        return missCount;
+    }
+
+    /**
+     * Gets count of the code caches rejected by V8.
+     *
+     * @return the count of the code caches rejected by V8
+     * @since 5.0.4
+     */
+    public long getRejectCount() {
+        return rejectCount;
+    }
+
+    /**
+     * Gets count of the code caches in memory.
+     *
+     * @return the count of the code caches in memory
+     * @since 5.0.4
+     */
+    public long getSize() {
+        return size;
+    }
+
+    /**
+     * Gets count of the stored code caches.
+     *
+     * @return the count of the stored code caches
+     * @since 5.0.4
+     */
+    public long getStoreCount() {
+        return storeCount;
+    }
+
+    @Override
+    public String toString() {
+        return toString(false);
+    }
+
+    /**
+     * To string with zero value ignored or not.
+     *
+     * @param ignoreZero ignore zero
+     * @return the string
+     * @since 5.0.4
+     */
+    public String toString(boolean ignoreZero) {
+        StringBuilder sb = new StringBuilder();
+        sb.append("name = ").append(getClass().getSimpleName());
+        if (!ignoreZero || bytes != 0)
+            sb.append(", ").append("bytes = ").append(bytes);
+        if (!ignoreZero || diskHitCount != 0)
+            sb.append(", ").append("diskHitCount = ").append(diskHitCount);
+        if (!ignoreZero || evictCount != 0)
+            sb.append(", ").append("evictCount = ").append(evictCount);
+        if (!ignoreZero || hitCount != 0)
+            sb.append(", ").append("hitCount = ").append(hitCount);
+        if (!ignoreZero || missCount != 0)
+            sb.append(", ").append("missCount = ").append(missCount);
+        if (!ignoreZero || rejectCount != 0)
+            sb.append(", ").append("rejectCount = ").append(rejectCount);
+        if (!ignoreZero || size != 0)
+            sb.append(", ").append("size = ").append(size);
+        if (!ignoreZero || storeCount != 0)
+            sb.append(", ").append("storeCount = ").append(storeCount);
+        return sb.toString();
+    }
+}
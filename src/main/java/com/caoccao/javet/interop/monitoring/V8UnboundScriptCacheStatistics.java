@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop.monitoring;
+
+/**
+ * The type V8 unbound script cache statistics is a snapshot of the per-isolate unbound script cache.
+ *
+ * @since 5.0.4
+ */
+public final class V8UnboundScriptCacheStatistics {
+    private final long capacity;
+    private final long evictionCount;
+    private final long hitCount;
+    private final long missCount;
+    private final long size;
+
+    /**
+     * Instantiates a new V8 unbound script cache statistics.
+     *
+     * @param capacity      the max count of the cached scripts, 0 means disabled
+     * @param evictionCount the count of the evicted scripts
+     * @param hitCount      the count of the lookups served by the cache
+     * @param missCount     the count of the lookups that compiled new scripts
+     * @param size          the count of the cached scripts
+     * @since 5.0.4
+     */
+    public V8UnboundScriptCacheStatistics(
+            long capacity,
+            long evictionCount,
+            long hitCount,
+            long missCount,
+            long size) {
+        this.capacity = capacity;
+        this.evictionCount = evictionCount;
+        this.hitCount = hitCount;
+        this.missCount = missCount;
+        this.size = size;
+    }
+
+    /**
+     * Gets max count of the cached scripts, 0 means disabled.
+     *
+     * @return the max count of the cached scripts, 0 means disabled
+     * @since 5.0.4
+     */
+    public long getCapacity() {
+        return capacity;
+    }
+
+    /**
+     * Gets count of the evicted scripts.
+     *
+     * @return the count of the evicted scripts
+     * @since 5.0.4
+     */
+    public long getEvictionCount() {
+        return evictionCount;
+    }
+
+    /**
+     * Gets count of the lookups served by the cache.
+     *
+     * @return the count of the lookups served by the cache
+     * @since 5.0.4
+     */
+    public long getHitCount() {
+        return hitCount;
+    }
+
+    /**
+     * Gets count of the lookups that compiled new scripts.
+     *
+     * @return the count of the lookups that compiled new scripts
+     * @since 5.0.4
+     */
+    public long getMissCount() {
+        return missCount;
+    }
+
+    /**
+     * Gets count of the cached scripts.
+     *
+     * @return the count of the cached scripts
+     * @since 5.0.4
+     */
+    public long getSize() {
+        return size;
+    }
+
+    @Override
+    public String toString() {
+        return toString(false);
+    }
+
+    /**
+     * To string with zero value ignored or not.
+     *
+     * @param ignoreZero ignore zero
+     * @return the string
+     * @since 5.0.4
+     */
+    public String toString(boolean ignoreZero) {
+        StringBuilder sb = new StringBuilder();
+        sb.append("name = ").append(getClass().getSimpleName());
+        if (!ignoreZero || capacity != 0)
+            sb.append(", ").append("capacity = ").append(capacity);
+        if (!ignoreZero || evictionCount != 0)
+            sb.append(", ").append("evictionCount = ").append(evictionCount);
+        if (!ignoreZero || hitCount != 0)
+            sb.append(", ").append("hitCount = ").append(hitCount);
+        if (!ignoreZero || missCount != 0)
+            sb.append(", ").append("missCount = ").append(missCount);
+        if (!ignoreZero || size != 0)
+            sb.append(", ").append("size = ").append(size);
+        return sb.toString();
+    }
+}
@@ -32,12 +32,26 @@ public abstract class RuntimeOptions<Options extends RuntimeOptions<Options>> {
      * @since 3.0.3
      */
     protected boolean createSnapshotEnabled;
+    /**
+     * The property key cache size is the max count of property keys cached per runtime.
+     * It is 0 (disabled) by default.
+     *
+     * @since 5.0.4
+     */
+    protected int propertyKeyCacheSize;
     /**
      * The Snapshot blob.
      *
      * @since 3.0.3
      */
     protected byte[] snapshotBlob;
+    /**
+     * The unbound script cache size is the max count of scripts cached per isolate.
+     * It is 0 (disabled) by default.
+     *
+     * @since 5.0.4
+     */
+    protected int unboundScriptCacheSize;
 
     /**
      * Instantiates a new Runtime options.
@@ -46,7 +60,19 @@ public abstract class RuntimeOptions<Options extends RuntimeOptions<Options>> {
      */
     public RuntimeOptions() {
         createSnapshotEnabled = false;
+        propertyKeyCacheSize = 0;
         snapshotBlob = null;
+        unboundScriptCacheSize = 0;
+    }
+
+    /**
+     * Gets property key cache size.
+     *
+     * @return the property key cache size, 0 means disabled
+     * @since 5.0.4
+     */
+    public int getPropertyKeyCacheSize() {
+        return propertyKeyCacheSize;
     }
 
     /**
@@ -59,6 +85,16 @@ public abstract class RuntimeOptions<Options extends RuntimeOptions<Options>> {
         return snapshotBlob;
     }
 
+    /**
+     * Gets unbound script cache size.
+     *
+     * @return the unbound script cache size, 0 means disabled
+     * @since 5.0.4
+     */
+    public int getUnboundScriptCacheSize() {
+        return unboundScriptCacheSize;
+    }
+
     /**
      * Is create snapshot enabled.
      *
@@ -81,6 +117,22 @@ public abstract class RuntimeOptions<Options extends RuntimeOptions<Options>> {
         return this;
     }
 
+    /**
+     * Sets property key cache size.
+     * <p>
+     * The property key cache maps string property keys, function names and private property names
+     * to internalized V8 strings and private symbols, so that the same keys accessed repeatedly
+     * are neither copied nor internalized again. It is dropped when the V8 context is reset.
+     *
+     * @param propertyKeyCacheSize the max count of the cached property keys, 0 disables the cache
+     * @return the self
+     * @since 5.0.4
+     */
+    public RuntimeOptions<Options> setPropertyKeyCacheSize(int propertyKeyCacheSize) {
+        this.propertyKeyCacheSize = Math.max(0, propertyKeyCacheSize);
+        return this;
+    }
+
     /**
      * Sets snapshot blob.
      *
@@ -92,4 +144,22 @@ public abstract class RuntimeOptions<Options extends RuntimeOptions<Options>> {
         this.snapshotBlob = ArrayUtils.isEmpty(snapshotBlob) ? null : snapshotBlob;
         return this;
     }
+
+    /**
+     * Sets unbound script cache size.
+     * <p>
+     * The unbound script cache keeps the context independent compilation result of the scripts
+     * compiled or executed in the V8 runtime, keyed by the source and the origin,
+     * so that a script is compiled once per isolate and only bound to the new context
+     * after the V8 context is reset. It is dropped when the isolate is reset.
+     * The scripts compiled with compile options or compile hints bypass the cache.
+     *
+     * @param unboundScriptCacheSize the max count of the cached scripts, 0 disables the cache
+     * @return the self
+     * @since 5.0.4
+     */
+    public RuntimeOptions<Options> setUnboundScriptCacheSize(int unboundScriptCacheSize) {
+        this.unboundScriptCacheSize = Math.max(0, unboundScriptCacheSize);
+        return this;
+    }
 }
@@ -24,6 +24,12 @@ import com.caoccao.javet.utils.StringUtils;
  * @since 1.0.0
  */
 public final class V8RuntimeOptions extends RuntimeOptions<V8RuntimeOptions> {
+    /**
+     * The constant DEFAULT_ARRAY_BUFFER_POOL_SIZE.
+     *
+     * @since 5.0.4
+     */
+    public static final long DEFAULT_ARRAY_BUFFER_POOL_SIZE = 1024L * 1024L;
     /**
      * The constant GLOBAL_THIS.
      *
@@ -36,7 +42,9 @@ public final class V8RuntimeOptions extends RuntimeOptions<V8RuntimeOptions> {
      * @since 1.1.7
      */
     public static final V8Flags V8_FLAGS = new V8Flags();
+    private long arrayBufferPoolSize;
     private String globalName;
+    private long maxArrayBufferSize;
 
     /**
      * Instantiates a new V8 runtime options.
@@ -45,7 +53,20 @@ public final class V8RuntimeOptions extends RuntimeOptions<V8RuntimeOptions> {
      */
     public V8RuntimeOptions() {
         super();
+        setArrayBufferPoolSize(DEFAULT_ARRAY_BUFFER_POOL_SIZE);
         setGlobalName(null);
+        setMaxArrayBufferSize(0);
+    }
+
+    /**
+     * Gets the array buffer pool size.
+     * It is the max bytes of freed small array buffers kept by the V8 runtime for reuse.
+     *
+     * @return the array buffer pool size in bytes
+     * @since 5.0.4
+     */
+    public long getArrayBufferPoolSize() {
+        return arrayBufferPoolSize;
     }
 
     /**
@@ -58,6 +79,30 @@ public final class V8RuntimeOptions extends RuntimeOptions<V8RuntimeOptions> {
         return globalName;
     }
 
+    /**
+     * Gets the max array buffer size.
+     * It is the max bytes held by all array buffers of the V8 runtime.
+     * An allocation beyond it fails with a RangeError in JavaScript.
+     *
+     * @return the max array buffer size in bytes, 0 means unlimited
+     * @since 5.0.4
+     */
+    public long getMaxArrayBufferSize() {
+        return maxArrayBufferSize;
+    }
+
+    /**
+     * Sets the array buffer pool size.
+     *
+     * @param arrayBufferPoolSize the array buffer pool size in bytes, 0 disables the pool
+     * @return the self
+     * @since 5.0.4
+     */
+    public V8RuntimeOptions setArrayBufferPoolSize(long arrayBufferPoolSize) {
+        this.arrayBufferPoolSize = Math.max(0L, arrayBufferPoolSize);
+        return this;
+    }
+
     /**
      * Sets global name.
      *
@@ -69,4 +114,16 @@ public final class V8RuntimeOptions extends RuntimeOptions<V8RuntimeOptions> {
         this.globalName = StringUtils.isEmpty(globalName) ? null : globalName;
         return this;
     }
+
+    /**
+     * Sets the max array buffer size.
+     *
+     * @param maxArrayBufferSize the max array buffer size in bytes, 0 means unlimited
+     * @return the self
+     * @since 5.0.4
+     */
+    public V8RuntimeOptions setMaxArrayBufferSize(long maxArrayBufferSize) {
+        this.maxArrayBufferSize = Math.max(0L, maxArrayBufferSize);
+        return this;
+    }
 }
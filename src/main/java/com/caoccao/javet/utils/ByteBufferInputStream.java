@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.utils;
+
+import java.io.InputStream;
+import java.nio.ByteBuffer;
+import java.util.Objects;
+
+/**
+ * The type byte buffer input stream.
+ * <p>
+ * It reads the remaining bytes of a byte buffer, e.g. a memory mapped file, without copying them
+ * into an intermediate array. The position of the given byte buffer is not changed.
+ *
+ * @since 5.0.4
+ */
+public final class ByteBufferInputStream extends InputStream {
+    private final ByteBuffer byteBuffer;
+    private int markedPosition;
+
+    /**
+     * Instantiates a new byte buffer input stream.
+     *
+     * @param byteBuffer the byte buffer
+     * @since 5.0.4
+     */
+    public ByteBufferInputStream(ByteBuffer byteBuffer) {
+        this.byteBuffer = Objects.requireNonNull(byteBuffer).slice();
+        markedPosition = 0;
+    }
+
+    @Override
+    public int available() {
+        return byteBuffer.remaining();
+    }
+
+    @Override
+    public synchronized void mark(int readLimit) {
+        markedPosition = byteBuffer.position();
+    }
+
+    @Override
+    public boolean markSupported() {
+        return true;
+    }
+
+    @Override
+    public int read() {
+        return byteBuffer.hasRemaining() ? byteBuffer.get() & 0xFF : -1;
+    }
+
+    @Override
+    public int read(byte[] bytes, int offset, int length) {
+        Objects.requireNonNull(bytes);
+        if (offset < 0 || length < 0 || length > bytes.length - offset) {
+            throw new IndexOutOfBoundsException();
+        }
+        if (length == 0) {
+            return 0;
+        }
+        if (!byteBuffer.hasRemaining()) {
+            return -1;
+        }
+        length = Math.min(length, byteBuffer.remaining());
+        byteBuffer.get(bytes, offset, length);
+        return length;
+    }
+
+    @Override
+    public synchronized void reset() {
+        byteBuffer.position(markedPosition);
+    }
+
+    @Override
+    public long skip(long n) {
+        if (n <= 0) {
+            return 0;
+        }
+        int skipped = (int) Math.min(n, byteBuffer.remaining());
+        byteBuffer.position(byteBuffer.position() + skipped);
+        return skipped;
+    }
+}
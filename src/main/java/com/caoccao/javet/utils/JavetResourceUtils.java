@@ -18,9 +18,11 @@ package com.caoccao.javet.utils;
 
 import com.caoccao.javet.exceptions.JavetException;
 import com.caoccao.javet.interfaces.IJavetClosable;
+import com.caoccao.javet.interop.V8Runtime;
 import com.caoccao.javet.values.V8Value;
 import com.caoccao.javet.values.reference.IV8ValueReference;
 
+import java.util.Arrays;
 import java.util.Collection;
 
 /**
@@ -53,9 +55,7 @@ public final class JavetResourceUtils {
      * @since 0.7.1
      */
     public static void safeClose(Object... objects) {
-        for (Object object : objects) {
-            safeClose(object);
-        }
+        safeCloseInBatch(Arrays.asList(objects));
     }
 
     /**
@@ -65,9 +65,7 @@ public final class JavetResourceUtils {
      * @since 2.2.0
      */
     public static void safeClose(V8Value... v8Values) {
-        for (V8Value v8Value : v8Values) {
-            safeClose(v8Value);
-        }
+        safeCloseInBatch(Arrays.asList(v8Values));
     }
 
     /**
@@ -94,16 +92,39 @@ public final class JavetResourceUtils {
             } catch (JavetException ignored) {
             }
         } else if (object instanceof V8Value[]) {
-            for (V8Value v8Value : (V8Value[]) object) {
-                safeClose(v8Value);
-            }
+            safeCloseInBatch(Arrays.asList((V8Value[]) object));
         } else if (object.getClass().isArray()) {
-            for (Object o : (Object[]) object) {
-                safeClose(o);
-            }
+            safeCloseInBatch(Arrays.asList((Object[]) object));
         } else if (object instanceof Collection) {
-            for (Object o : (Collection<?>) object) {
-                safeClose(o);
+            safeCloseInBatch((Collection<?>) object);
+        }
+    }
+
+    /**
+     * Safe close the objects with the references of the same V8 runtime released in one JNI call.
+     *
+     * @param objects the objects
+     * @since 5.0.4
+     */
+    private static void safeCloseInBatch(Iterable<?> objects) {
+        V8Runtime v8Runtime = null;
+        try {
+            for (Object object : objects) {
+                if (object instanceof IV8ValueReference && object instanceof V8Value) {
+                    V8Value v8Value = (V8Value) object;
+                    if (!v8Value.isClosed() && v8Value.getV8Runtime() != v8Runtime) {
+                        if (v8Runtime != null) {
+                            v8Runtime.endReferenceBatch();
+                        }
+                        v8Runtime = v8Value.getV8Runtime();
+                        v8Runtime.beginReferenceBatch();
+                    }
+                }
+                safeClose(object);
+            }
+        } finally {
+            if (v8Runtime != null) {
+                v8Runtime.endReferenceBatch();
             }
         }
     }
@@ -16,14 +16,53 @@
 
 package com.caoccao.javet.values;
 
+import com.caoccao.javet.enums.V8ValueTypeTag;
 import com.caoccao.javet.exceptions.JavetError;
 import com.caoccao.javet.exceptions.JavetException;
 import com.caoccao.javet.interop.V8Runtime;
 import com.caoccao.javet.interop.converters.JavetObjectConverter;
+import com.caoccao.javet.values.primitive.*;
+import com.caoccao.javet.values.reference.*;
+
+import java.util.HashMap;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
 
 public abstract class V8Value extends V8Data implements IV8Value {
     protected static final JavetObjectConverter OBJECT_CONVERTER = new JavetObjectConverter();
+    private static final Map<Class<?>, V8ValueTypeTag> KNOWN_TYPE_TAG_MAP;
+    private static final Map<Class<?>, V8ValueTypeTag> TYPE_TAG_CACHE = new ConcurrentHashMap<>();
+
+    static {
+        KNOWN_TYPE_TAG_MAP = new HashMap<>();
+        KNOWN_TYPE_TAG_MAP.put(V8ValueBigInteger.class, V8ValueTypeTag.BigInteger);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueBoolean.class, V8ValueTypeTag.Boolean);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueDouble.class, V8ValueTypeTag.Double);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueInteger.class, V8ValueTypeTag.Integer);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueLong.class, V8ValueTypeTag.Long);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueNull.class, V8ValueTypeTag.Null);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueString.class, V8ValueTypeTag.String);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueUndefined.class, V8ValueTypeTag.Undefined);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueZonedDateTime.class, V8ValueTypeTag.ZonedDateTime);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueArray.class, V8ValueTypeTag.Array);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueGlobalObject.class, V8ValueTypeTag.GlobalObject);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueMap.class, V8ValueTypeTag.Map);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueObject.class, V8ValueTypeTag.Object);
+        KNOWN_TYPE_TAG_MAP.put(V8ValuePromise.class, V8ValueTypeTag.Promise);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueProxy.class, V8ValueTypeTag.Proxy);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueReference.class, V8ValueTypeTag.Reference);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueRegExp.class, V8ValueTypeTag.RegExp);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueSet.class, V8ValueTypeTag.Set);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueSymbol.class, V8ValueTypeTag.Symbol);
+        KNOWN_TYPE_TAG_MAP.put(V8ValueSymbolObject.class, V8ValueTypeTag.SymbolObject);
+    }
 
+    /**
+     * The type tag is read by the native converter directly.
+     *
+     * @since 5.0.4
+     */
+    protected final int typeTag;
     protected V8Runtime v8Runtime;
 
     protected V8Value(V8Runtime v8Runtime) throws JavetException {
@@ -31,6 +70,34 @@ public abstract class V8Value extends V8Data implements IV8Value {
             throw new JavetException(JavetError.RuntimeNotRegistered);
         }
         this.v8Runtime = v8Runtime;
+        typeTag = getTypeTag(getClass()).getId();
+    }
+
+    /**
+     * Gets the type tag of a V8 value class.
+     * The nearest known class in the class hierarchy determines the type tag.
+     *
+     * @param clazz the V8 value class
+     * @return the type tag
+     * @since 5.0.4
+     */
+    public static V8ValueTypeTag getTypeTag(Class<?> clazz) {
+        V8ValueTypeTag cachedTypeTag = TYPE_TAG_CACHE.get(clazz);
+        if (cachedTypeTag != null) {
+            return cachedTypeTag;
+        }
+        V8ValueTypeTag typeTag = V8ValueTypeTag.Unknown;
+        Class<?> currentClass = clazz;
+        while (currentClass != null && currentClass != V8Value.class) {
+            V8ValueTypeTag knownTypeTag = KNOWN_TYPE_TAG_MAP.get(currentClass);
+            if (knownTypeTag != null) {
+                typeTag = knownTypeTag;
+                break;
+            }
+            currentClass = currentClass.getSuperclass();
+        }
+        TYPE_TAG_CACHE.put(clazz, typeTag);
+        return typeTag;
     }
 
     protected V8Runtime checkV8Runtime() throws JavetException {
@@ -46,6 +113,16 @@ public abstract class V8Value extends V8Data implements IV8Value {
     @Override
     public abstract boolean equals(V8Value v8Value) throws JavetException;
 
+    /**
+     * Gets type tag.
+     *
+     * @return the type tag
+     * @since 5.0.4
+     */
+    public V8ValueTypeTag getTypeTag() {
+        return V8ValueTypeTag.parse(typeTag);
+    }
+
     public V8Runtime getV8Runtime() {
         return v8Runtime;
     }
@@ -19,6 +19,7 @@ package com.caoccao.javet.values.reference;
 import com.caoccao.javet.annotations.CheckReturnValue;
 import com.caoccao.javet.exceptions.JavetException;
 import com.caoccao.javet.interop.IV8Executable;
+import com.caoccao.javet.interop.V8CompileHints;
 import com.caoccao.javet.values.IV8ValueNonProxyable;
 import com.caoccao.javet.values.V8Value;
 
@@ -29,6 +30,17 @@ import com.caoccao.javet.values.V8Value;
  */
 public interface IV8Script
         extends IV8Cacheable, IV8ValueReference, IV8Executable, IV8ValueNonProxyable {
+    /**
+     * Gets the compile hints recorded since the script was compiled with produce compile hints.
+     * They are the source positions of the functions that actually ran, and can be saved
+     * and set to later compilations of the same source so that these functions are compiled eagerly.
+     *
+     * @return the compile hints, empty if the script was not compiled with produce compile hints
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    V8CompileHints getCompileHints() throws JavetException;
+
     /**
      * Gets resource name.
      *
@@ -82,6 +82,152 @@ public interface IV8ValueArray extends IV8ValueObject {
      */
     int batchGet(V8Value[] v8Values, int startIndex, int endIndex) throws JavetException;
 
+    /**
+     * Batch get the given range of items from the array as booleans.
+     * The items are converted natively without creating any V8 values.
+     * Items that are not booleans are marked by false.
+     *
+     * @param values     the values
+     * @param startIndex the start index
+     * @param endIndex   the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    default int batchGetBooleans(boolean[] values, int startIndex, int endIndex) throws JavetException {
+        return batchGetBooleans(values, null, startIndex, endIndex);
+    }
+
+    /**
+     * Batch get the given range of items from the array as booleans.
+     * The items are converted natively without creating any V8 values.
+     * Items that are not booleans are marked by false.
+     * The validity of each item is written to the validity array if it is not null.
+     * If a getter throws, the items read before it are still written and the exception is thrown.
+     *
+     * @param values     the values
+     * @param validities the validities of the values, or null
+     * @param startIndex the start index
+     * @param endIndex   the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    int batchGetBooleans(boolean[] values, boolean[] validities, int startIndex, int endIndex) throws JavetException;
+
+    /**
+     * Batch get the given range of items from the array as doubles.
+     * The items are converted natively without creating any V8 values.
+     * Items that are not numbers are marked by NaN.
+     *
+     * @param values     the values
+     * @param startIndex the start index
+     * @param endIndex   the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    default int batchGetDoubles(double[] values, int startIndex, int endIndex) throws JavetException {
+        return batchGetDoubles(values, null, startIndex, endIndex);
+    }
+
+    /**
+     * Batch get the given range of items from the array as doubles.
+     * The items are converted natively without creating any V8 values.
+     * Items that are not numbers are marked by NaN.
+     * The validity of each item is written to the validity array if it is not null.
+     * If a getter throws, the items read before it are still written and the exception is thrown.
+     *
+     * @param values     the values
+     * @param validities the validities of the values, or null
+     * @param startIndex the start index
+     * @param endIndex   the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    int batchGetDoubles(double[] values, boolean[] validities, int startIndex, int endIndex) throws JavetException;
+
+    /**
+     * Batch get the given range of items from the array as integers.
+     * The items are converted natively without creating any V8 values.
+     * Items that are not 32-bit integers are marked by 0.
+     *
+     * @param values     the values
+     * @param startIndex the start index
+     * @param endIndex   the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    default int batchGetIntegers(int[] values, int startIndex, int endIndex) throws JavetException {
+        return batchGetIntegers(values, null, startIndex, endIndex);
+    }
+
+    /**
+     * Batch get the given range of items from the array as integers.
+     * The items are converted natively without creating any V8 values.
+     * Items that are not 32-bit integers are marked by 0.
+     * The validity of each item is written to the validity array if it is not null.
+     * If a getter throws, the items read before it are still written and the exception is thrown.
+     *
+     * @param values     the values
+     * @param validities the validities of the values, or null
+     * @param startIndex the start index
+     * @param endIndex   the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    int batchGetIntegers(int[] values, boolean[] validities, int startIndex, int endIndex) throws JavetException;
+
+    /**
+     * Batch get the given range of items from the array as longs.
+     * The items are converted natively without creating any V8 values.
+     * Items that are neither integral numbers nor big integers within the range of long are marked by 0.
+     *
+     * @param values     the values
+     * @param startIndex the start index
+     * @param endIndex   the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    default int batchGetLongs(long[] values, int startIndex, int endIndex) throws JavetException {
+        return batchGetLongs(values, null, startIndex, endIndex);
+    }
+
+    /**
+     * Batch get the given range of items from the array as longs.
+     * The items are converted natively without creating any V8 values.
+     * Items that are neither integral numbers nor big integers within the range of long are marked by 0.
+     * The validity of each item is written to the validity array if it is not null.
+     * If a getter throws, the items read before it are still written and the exception is thrown.
+     *
+     * @param values     the values
+     * @param validities the validities of the values, or null
+     * @param startIndex the start index
+     * @param endIndex   the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    int batchGetLongs(long[] values, boolean[] validities, int startIndex, int endIndex) throws JavetException;
+
+    /**
+     * Batch get the given range of items from the array as strings.
+     * The items are converted natively without creating any V8 values.
+     * Items that are not strings are marked by null.
+     *
+     * @param values     the values
+     * @param startIndex the start index
+     * @param endIndex   the end index
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    int batchGetStrings(String[] values, int startIndex, int endIndex) throws JavetException;
+
     /**
      * Batch get all the items from the array.
      *
@@ -65,6 +65,165 @@ public interface IV8ValueObject extends IV8ValueReference {
     @SuppressWarnings("UnusedReturnValue")
     int batchGet(V8Value[] v8ValueKeys, V8Value[] v8ValueValues, int length) throws JavetException;
 
+    /**
+     * Batch get a range of values by keys as booleans.
+     * The values are converted natively without creating any V8 values.
+     * Values that are not booleans are marked by false.
+     *
+     * @param v8ValueKeys the V8 value keys
+     * @param values      the values
+     * @param length      the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("UnusedReturnValue")
+    default int batchGetBooleans(V8Value[] v8ValueKeys, boolean[] values, int length) throws JavetException {
+        return batchGetBooleans(v8ValueKeys, values, null, length);
+    }
+
+    /**
+     * Batch get a range of values by keys as booleans.
+     * The values are converted natively without creating any V8 values.
+     * Values that are not booleans are marked by false.
+     * The validity of each value is written to the validity array if it is not null.
+     * If a getter throws, the values read before it are still written and the exception is thrown.
+     *
+     * @param v8ValueKeys the V8 value keys
+     * @param values      the values
+     * @param validities  the validities of the values, or null
+     * @param length      the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("UnusedReturnValue")
+    int batchGetBooleans(V8Value[] v8ValueKeys, boolean[] values, boolean[] validities, int length)
+            throws JavetException;
+
+    /**
+     * Batch get a range of values by keys as doubles.
+     * The values are converted natively without creating any V8 values.
+     * Values that are not numbers are marked by NaN.
+     *
+     * @param v8ValueKeys the V8 value keys
+     * @param values      the values
+     * @param length      the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("UnusedReturnValue")
+    default int batchGetDoubles(V8Value[] v8ValueKeys, double[] values, int length) throws JavetException {
+        return batchGetDoubles(v8ValueKeys, values, null, length);
+    }
+
+    /**
+     * Batch get a range of values by keys as doubles.
+     * The values are converted natively without creating any V8 values.
+     * Values that are not numbers are marked by NaN.
+     * The validity of each value is written to the validity array if it is not null.
+     * If a getter throws, the values read before it are still written and the exception is thrown.
+     *
+     * @param v8ValueKeys the V8 value keys
+     * @param values      the values
+     * @param validities  the validities of the values, or null
+     * @param length      the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("UnusedReturnValue")
+    int batchGetDoubles(V8Value[] v8ValueKeys, double[] values, boolean[] validities, int length)
+            throws JavetException;
+
+    /**
+     * Batch get a range of values by keys as integers.
+     * The values are converted natively without creating any V8 values.
+     * Values that are not 32-bit integers are marked by 0.
+     *
+     * @param v8ValueKeys the V8 value keys
+     * @param values      the values
+     * @param length      the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("UnusedReturnValue")
+    default int batchGetIntegers(V8Value[] v8ValueKeys, int[] values, int length) throws JavetException {
+        return batchGetIntegers(v8ValueKeys, values, null, length);
+    }
+
+    /**
+     * Batch get a range of values by keys as integers.
+     * The values are converted natively without creating any V8 values.
+     * Values that are not 32-bit integers are marked by 0.
+     * The validity of each value is written to the validity array if it is not null.
+     * If a getter throws, the values read before it are still written and the exception is thrown.
+     *
+     * @param v8ValueKeys the V8 value keys
+     * @param values      the values
+     * @param validities  the validities of the values, or null
+     * @param length      the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("UnusedReturnValue")
+    int batchGetIntegers(V8Value[] v8ValueKeys, int[] values, boolean[] validities, int length)
+            throws JavetException;
+
+    /**
+     * Batch get a range of values by keys as longs.
+     * The values are converted natively without creating any V8 values.
+     * Values that are neither integral numbers nor big integers within the range of long are marked by 0.
+     *
+     * @param v8ValueKeys the V8 value keys
+     * @param values      the values
+     * @param length      the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("UnusedReturnValue")
+    default int batchGetLongs(V8Value[] v8ValueKeys, long[] values, int length) throws JavetException {
+        return batchGetLongs(v8ValueKeys, values, null, length);
+    }
+
+    /**
+     * Batch get a range of values by keys as longs.
+     * The values are converted natively without creating any V8 values.
+     * Values that are neither integral numbers nor big integers within the range of long are marked by 0.
+     * The validity of each value is written to the validity array if it is not null.
+     * If a getter throws, the values read before it are still written and the exception is thrown.
+     *
+     * @param v8ValueKeys the V8 value keys
+     * @param values      the values
+     * @param validities  the validities of the values, or null
+     * @param length      the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("UnusedReturnValue")
+    int batchGetLongs(V8Value[] v8ValueKeys, long[] values, boolean[] validities, int length)
+            throws JavetException;
+
+    /**
+     * Batch get a range of values by keys as strings.
+     * The values are converted natively without creating any V8 values.
+     * Values that are not strings are marked by null.
+     *
+     * @param v8ValueKeys the V8 value keys
+     * @param values      the values
+     * @param length      the length
+     * @return the actual item count
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    @SuppressWarnings("UnusedReturnValue")
+    int batchGetStrings(V8Value[] v8ValueKeys, String[] values, int length) throws JavetException;
+
     /**
      * Bind both functions via @V8Function and properties via @V8Property.
      *
@@ -34,6 +34,17 @@ public interface IV8ValueSet extends IV8ValueKeyContainer {
      */
     void add(Object key) throws JavetException;
 
+    /**
+     * Add multiple keys in one call.
+     * The keys are converted and added in one pass. It stops at the first key that cannot be added.
+     *
+     * @param keys the keys
+     * @return the count of the keys that are added
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    int batchAdd(Object... keys) throws JavetException;
+
     /**
      * Add null.
      *
@@ -19,6 +19,7 @@ package com.caoccao.javet.values.reference;
 import com.caoccao.javet.annotations.CheckReturnValue;
 import com.caoccao.javet.enums.V8ValueReferenceType;
 import com.caoccao.javet.exceptions.JavetException;
+import com.caoccao.javet.interop.V8CompileHints;
 import com.caoccao.javet.interop.V8Runtime;
 import com.caoccao.javet.values.V8Value;
 
@@ -60,6 +61,11 @@ public class V8Script extends V8ValueReference implements IV8Script {
         return checkV8Runtime().getV8Internal().scriptGetCachedData(this);
     }
 
+    @Override
+    public V8CompileHints getCompileHints() throws JavetException {
+        return checkV8Runtime().getV8Internal().scriptGetCompileHints(this);
+    }
+
     @Override
     public String getResourceName() throws JavetException {
         if (resourceName == null) {
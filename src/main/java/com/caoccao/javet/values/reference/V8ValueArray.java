@@ -61,6 +61,35 @@ public class V8ValueArray extends V8ValueObject implements IV8ValueArray {
         return checkV8Runtime().getV8Internal().batchArrayGet(this, v8Values, startIndex, endIndex);
     }
 
+    @Override
+    public int batchGetBooleans(boolean[] values, boolean[] validities, int startIndex, int endIndex)
+            throws JavetException {
+        return checkV8Runtime().getV8Internal().batchArrayGetBooleans(this, values, validities, startIndex, endIndex);
+    }
+
+    @Override
+    public int batchGetDoubles(double[] values, boolean[] validities, int startIndex, int endIndex)
+            throws JavetException {
+        return checkV8Runtime().getV8Internal().batchArrayGetDoubles(this, values, validities, startIndex, endIndex);
+    }
+
+    @Override
+    public int batchGetIntegers(int[] values, boolean[] validities, int startIndex, int endIndex)
+            throws JavetException {
+        return checkV8Runtime().getV8Internal().batchArrayGetIntegers(this, values, validities, startIndex, endIndex);
+    }
+
+    @Override
+    public int batchGetLongs(long[] values, boolean[] validities, int startIndex, int endIndex)
+            throws JavetException {
+        return checkV8Runtime().getV8Internal().batchArrayGetLongs(this, values, validities, startIndex, endIndex);
+    }
+
+    @Override
+    public int batchGetStrings(String[] values, int startIndex, int endIndex) throws JavetException {
+        return checkV8Runtime().getV8Internal().batchArrayGetStrings(this, values, startIndex, endIndex);
+    }
+
     @Override
     public <Value extends V8Value, E extends Throwable> int forEach(
             IJavetUniConsumer<Value, E> consumer)
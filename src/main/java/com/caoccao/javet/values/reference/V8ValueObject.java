@@ -84,6 +84,35 @@ public class V8ValueObject extends V8ValueReference implements IV8ValueObject {
         return checkV8Runtime().getV8Internal().batchObjectGet(this, v8ValueKeys, v8ValueValues, length);
     }
 
+    @Override
+    public int batchGetBooleans(V8Value[] v8ValueKeys, boolean[] values, boolean[] validities, int length)
+            throws JavetException {
+        return checkV8Runtime().getV8Internal().batchObjectGetBooleans(this, v8ValueKeys, values, validities, length);
+    }
+
+    @Override
+    public int batchGetDoubles(V8Value[] v8ValueKeys, double[] values, boolean[] validities, int length)
+            throws JavetException {
+        return checkV8Runtime().getV8Internal().batchObjectGetDoubles(this, v8ValueKeys, values, validities, length);
+    }
+
+    @Override
+    public int batchGetIntegers(V8Value[] v8ValueKeys, int[] values, boolean[] validities, int length)
+            throws JavetException {
+        return checkV8Runtime().getV8Internal().batchObjectGetIntegers(this, v8ValueKeys, values, validities, length);
+    }
+
+    @Override
+    public int batchGetLongs(V8Value[] v8ValueKeys, long[] values, boolean[] validities, int length)
+            throws JavetException {
+        return checkV8Runtime().getV8Internal().batchObjectGetLongs(this, v8ValueKeys, values, validities, length);
+    }
+
+    @Override
+    public int batchGetStrings(V8Value[] v8ValueKeys, String[] values, int length) throws JavetException {
+        return checkV8Runtime().getV8Internal().batchObjectGetStrings(this, v8ValueKeys, values, length);
+    }
+
     @Override
     public List<JavetCallbackContext> bind(Object callbackReceiver) throws JavetException {
         Objects.requireNonNull(callbackReceiver);
@@ -196,6 +225,7 @@ public class V8ValueObject extends V8ValueReference implements IV8ValueObject {
                                 Modifier.isStatic(functionMethodDescriptor.getMethod().getModifiers()) ?
                                         null : callbackReceiver,
                                 functionMethodDescriptor.getMethod(), functionMethodDescriptor.isThisObjectRequired());
+                        javetCallbackContext.setFastCall(functionMethodDescriptor.isFastCall());
                         javetCallbackContexts.add(javetCallbackContext);
                         bindFunction(javetCallbackContext);
                     } catch (Exception e) {
@@ -431,7 +461,11 @@ public class V8ValueObject extends V8ValueReference implements IV8ValueObject {
                     if (!functionMap.containsKey(functionName)) {
                         functionMap.put(
                                 functionName,
-                                new MethodDescriptor(method, v8Function.thisObjectRequired()));
+                                new MethodDescriptor(
+                                        method,
+                                        v8Function.thisObjectRequired(),
+                                        V8ValueSymbolType.None,
+                                        v8Function.fastCall()));
                         methodHandled = true;
                     }
                 }
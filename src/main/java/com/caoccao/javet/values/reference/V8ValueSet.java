@@ -22,8 +22,10 @@ import com.caoccao.javet.exceptions.JavetException;
 import com.caoccao.javet.interfaces.IJavetUniConsumer;
 import com.caoccao.javet.interfaces.IJavetUniIndexedConsumer;
 import com.caoccao.javet.interop.V8Runtime;
+import com.caoccao.javet.utils.ArrayUtils;
 import com.caoccao.javet.values.V8Value;
 import com.caoccao.javet.values.virtual.V8VirtualValue;
+import com.caoccao.javet.values.virtual.V8VirtualValueList;
 
 import java.util.Objects;
 
@@ -72,6 +74,16 @@ public class V8ValueSet extends V8ValueObject implements IV8ValueSet {
         return checkV8Runtime().getV8Internal().setAsArray(this);
     }
 
+    @Override
+    public int batchAdd(Object... keys) throws JavetException {
+        if (ArrayUtils.isEmpty(keys)) {
+            return 0;
+        }
+        try (V8VirtualValueList v8VirtualValueList = new V8VirtualValueList(checkV8Runtime(), null, keys)) {
+            return v8Runtime.getV8Internal().batchSetAdd(this, v8VirtualValueList.get(), keys.length);
+        }
+    }
+
     @Override
     public void clear() throws JavetException {
         checkV8Runtime().getV8Internal().setClear(this);
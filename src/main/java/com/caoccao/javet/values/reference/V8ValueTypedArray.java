@@ -23,43 +23,43 @@ import com.caoccao.javet.interop.V8Runtime;
 import com.caoccao.javet.values.V8Value;
 import com.caoccao.javet.values.virtual.V8VirtualValue;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.Objects;
 
 /**
  * The type V8 value typed array.
- * The typical way of manipulating the typed array is as following.
- * 1. Get array buffer and apply try-with-resource.
- * 2. Create the value array by length.
- * 3. Fill the value array.
+ * <p>
+ * The typed array exposes a direct byte buffer in native byte order which is a view of exactly
+ * its own window (byte offset and byte length) in the backing store, so reading or writing
+ * the elements does not allocate a V8 value array buffer per access. The view is rebuilt
+ * per call and must not be kept after the backing store is detached, transferred or resized.
  * <p>
  * E.g.:
  * <pre>
- * try (V8ValueArrayBuffer v8ValueArrayBuffer = v8ValueTypedArray.getArrayBuffer()) {
- *     long[] longs = new long[v8ValueArrayBuffer.getLength()];
- *     v8ValueArrayBuffer.toLongs(longs);
- *     // ...
- * }
+ * long[] longs = v8ValueTypedArray.toLongs();
+ * LongBuffer longBuffer = v8ValueTypedArray.getByteBuffer().asLongBuffer();
  * </pre>
  * <p>
- * Or, play with ByteBuffer directly.
- * 1. Get array buffer and apply try-with-resource.
- * 2. Get native ByteBuffer.
- * 3. Set order of the native ByteBuffer to native order.
- * 4. Get typed buffer by type.
- * 5. Read from or write to the typed buffer.
+ * A region can also be copied between the typed array and a Java primitive array
+ * without any byte buffer in between.
  * <p>
- * E.g:
+ * E.g.:
  * <pre>
- * try (V8ValueArrayBuffer v8ValueArrayBuffer = v8ValueTypedArray.getArrayBuffer()) {
- *     LongBuffer longBuffer = v8ValueArrayBuffer.getByteBuffer().order(ByteOrder.nativeOrder()).asLongBuffer();
- *     // ...
- * }
+ * int[] integers = new int[16];
+ * v8ValueTypedArray.toIntegers(100, integers, 0, integers.length);
  * </pre>
  *
  * @since 0.7.2
  */
 public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArray {
 
+    /**
+     * The empty byte buffer for detached or out of bounds typed arrays.
+     *
+     * @since 5.0.4
+     */
+    protected static final ByteBuffer EMPTY_BYTE_BUFFER = ByteBuffer.allocateDirect(0);
     /**
      * The constant PROPERTY_BYTE_LENGTH.
      *
@@ -149,9 +149,35 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
             case Int8Array:
             case Uint8Array:
             case Uint8ClampedArray:
-                try (V8ValueArrayBuffer v8ValueArrayBuffer = getBuffer()) {
-                    return v8ValueArrayBuffer.fromBytes(bytes);
+                ByteBuffer byteBuffer = getByteBuffer();
+                if (bytes.length > 0 && bytes.length == byteBuffer.capacity()) {
+                    byteBuffer.put(bytes);
+                    return true;
                 }
+                return false;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * Copy a region of the byte array to the typed array without any byte buffer in between.
+     *
+     * @param index  the start index in the typed array
+     * @param bytes  the byte array
+     * @param offset the start offset in the byte array
+     * @param length the element count
+     * @return true : copied, false : type mismatch or out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public boolean fromBytes(int index, byte[] bytes, int offset, int length) throws JavetException {
+        Objects.requireNonNull(bytes);
+        switch (getType()) {
+            case Int8Array:
+            case Uint8Array:
+            case Uint8ClampedArray:
+                return fromRegion(index, bytes, bytes.length, offset, length);
             default:
                 return false;
         }
@@ -168,13 +194,34 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
     public boolean fromDoubles(double[] doubles) throws JavetException {
         Objects.requireNonNull(doubles);
         if (getType() == V8ValueReferenceType.Float64Array) {
-            try (V8ValueArrayBuffer v8ValueArrayBuffer = getBuffer()) {
-                return v8ValueArrayBuffer.fromDoubles(doubles);
+            ByteBuffer byteBuffer = getByteBuffer();
+            if (doubles.length > 0 && doubles.length == byteBuffer.capacity() / EIGHT_BYTES_PER_VALUE) {
+                byteBuffer.asDoubleBuffer().put(doubles);
+                return true;
             }
         }
         return false;
     }
 
+    /**
+     * Copy a region of the double array to the typed array without any byte buffer in between.
+     *
+     * @param index   the start index in the typed array
+     * @param doubles the double array
+     * @param offset  the start offset in the double array
+     * @param length  the element count
+     * @return true : copied, false : type mismatch or out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public boolean fromDoubles(int index, double[] doubles, int offset, int length) throws JavetException {
+        Objects.requireNonNull(doubles);
+        if (getType() == V8ValueReferenceType.Float64Array) {
+            return fromRegion(index, doubles, doubles.length, offset, length);
+        }
+        return false;
+    }
+
     /**
      * From float array.
      *
@@ -186,13 +233,34 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
     public boolean fromFloats(float[] floats) throws JavetException {
         Objects.requireNonNull(floats);
         if (getType() == V8ValueReferenceType.Float32Array) {
-            try (V8ValueArrayBuffer v8ValueArrayBuffer = getBuffer()) {
-                return v8ValueArrayBuffer.fromFloats(floats);
+            ByteBuffer byteBuffer = getByteBuffer();
+            if (floats.length > 0 && floats.length == byteBuffer.capacity() / FOUR_BYTES_PER_VALUE) {
+                byteBuffer.asFloatBuffer().put(floats);
+                return true;
             }
         }
         return false;
     }
 
+    /**
+     * Copy a region of the float array to the typed array without any byte buffer in between.
+     *
+     * @param index  the start index in the typed array
+     * @param floats the float array
+     * @param offset the start offset in the float array
+     * @param length the element count
+     * @return true : copied, false : type mismatch or out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public boolean fromFloats(int index, float[] floats, int offset, int length) throws JavetException {
+        Objects.requireNonNull(floats);
+        if (getType() == V8ValueReferenceType.Float32Array) {
+            return fromRegion(index, floats, floats.length, offset, length);
+        }
+        return false;
+    }
+
     /**
      * From integer array.
      *
@@ -206,9 +274,34 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
         switch (getType()) {
             case Int32Array:
             case Uint32Array:
-                try (V8ValueArrayBuffer v8ValueArrayBuffer = getBuffer()) {
-                    return v8ValueArrayBuffer.fromIntegers(integers);
+                ByteBuffer byteBuffer = getByteBuffer();
+                if (integers.length > 0 && integers.length == byteBuffer.capacity() / FOUR_BYTES_PER_VALUE) {
+                    byteBuffer.asIntBuffer().put(integers);
+                    return true;
                 }
+                return false;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * Copy a region of the integer array to the typed array without any byte buffer in between.
+     *
+     * @param index    the start index in the typed array
+     * @param integers the integer array
+     * @param offset   the start offset in the integer array
+     * @param length   the element count
+     * @return true : copied, false : type mismatch or out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public boolean fromIntegers(int index, int[] integers, int offset, int length) throws JavetException {
+        Objects.requireNonNull(integers);
+        switch (getType()) {
+            case Int32Array:
+            case Uint32Array:
+                return fromRegion(index, integers, integers.length, offset, length);
             default:
                 return false;
         }
@@ -227,14 +320,59 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
         switch (getType()) {
             case BigInt64Array:
             case BigUint64Array:
-                try (V8ValueArrayBuffer v8ValueArrayBuffer = getBuffer()) {
-                    return v8ValueArrayBuffer.fromLongs(longs);
+                ByteBuffer byteBuffer = getByteBuffer();
+                if (longs.length > 0 && longs.length == byteBuffer.capacity() / EIGHT_BYTES_PER_VALUE) {
+                    byteBuffer.asLongBuffer().put(longs);
+                    return true;
                 }
+                return false;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * Copy a region of the long array to the typed array without any byte buffer in between.
+     *
+     * @param index  the start index in the typed array
+     * @param longs  the long array
+     * @param offset the start offset in the long array
+     * @param length the element count
+     * @return true : copied, false : type mismatch or out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public boolean fromLongs(int index, long[] longs, int offset, int length) throws JavetException {
+        Objects.requireNonNull(longs);
+        switch (getType()) {
+            case BigInt64Array:
+            case BigUint64Array:
+                return fromRegion(index, longs, longs.length, offset, length);
             default:
                 return false;
         }
     }
 
+    /**
+     * Copy a region from a Java primitive array to the typed array.
+     *
+     * @param index       the start index in the typed array
+     * @param array       the Java primitive array
+     * @param arrayLength the length of the Java primitive array
+     * @param offset      the start offset in the Java primitive array
+     * @param length      the element count
+     * @return true : copied, false : out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    protected boolean fromRegion(int index, Object array, int arrayLength, int offset, int length)
+            throws JavetException {
+        if (offset < 0 || length < 0 || offset > arrayLength - length) {
+            return false;
+        }
+        return checkV8Runtime().getV8Internal().typedArraySetRegion(this, index, array, offset, length);
+    }
+
     /**
      * From short array.
      *
@@ -249,9 +387,35 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
             case Int16Array:
             case Uint16Array:
             case Float16Array:
-                try (V8ValueArrayBuffer v8ValueArrayBuffer = getBuffer()) {
-                    return v8ValueArrayBuffer.fromShorts(shorts);
+                ByteBuffer byteBuffer = getByteBuffer();
+                if (shorts.length > 0 && shorts.length == byteBuffer.capacity() / TWO_BYTES_PER_VALUE) {
+                    byteBuffer.asShortBuffer().put(shorts);
+                    return true;
                 }
+                return false;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * Copy a region of the short array to the typed array without any byte buffer in between.
+     *
+     * @param index  the start index in the typed array
+     * @param shorts the short array
+     * @param offset the start offset in the short array
+     * @param length the element count
+     * @return true : copied, false : type mismatch or out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public boolean fromShorts(int index, short[] shorts, int offset, int length) throws JavetException {
+        Objects.requireNonNull(shorts);
+        switch (getType()) {
+            case Int16Array:
+            case Uint16Array:
+            case Float16Array:
+                return fromRegion(index, shorts, shorts.length, offset, length);
             default:
                 return false;
         }
@@ -271,6 +435,23 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
         return get(PROPERTY_BUFFER);
     }
 
+    /**
+     * Gets the byte buffer view of the typed array in native byte order.
+     * The view is zero-copy and covers exactly the byte offset and byte length of the typed array.
+     * It is empty if the typed array is detached or out of bounds.
+     *
+     * @return the byte buffer
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public ByteBuffer getByteBuffer() throws JavetException {
+        ByteBuffer byteBuffer = checkV8Runtime().getV8Internal().typedArrayGetByteBuffer(this);
+        if (byteBuffer == null) {
+            byteBuffer = EMPTY_BYTE_BUFFER.duplicate();
+        }
+        return byteBuffer.order(ByteOrder.nativeOrder());
+    }
+
     @Override
     public int getByteLength() throws JavetException {
         return getInteger(PROPERTY_BYTE_LENGTH);
@@ -349,14 +530,38 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
             case Int8Array:
             case Uint8Array:
             case Uint8ClampedArray:
-                try (V8ValueArrayBuffer v8ValueArrayBuffer = getBuffer()) {
-                    return v8ValueArrayBuffer.toBytes();
-                }
+                ByteBuffer byteBuffer = getByteBuffer();
+                byte[] bytes = new byte[byteBuffer.capacity()];
+                byteBuffer.get(bytes);
+                return bytes;
             default:
                 return null;
         }
     }
 
+    /**
+     * Copy a region of the typed array to the byte array without any byte buffer in between.
+     *
+     * @param index  the start index in the typed array
+     * @param bytes  the byte array
+     * @param offset the start offset in the byte array
+     * @param length the element count
+     * @return true : copied, false : type mismatch or out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public boolean toBytes(int index, byte[] bytes, int offset, int length) throws JavetException {
+        Objects.requireNonNull(bytes);
+        switch (getType()) {
+            case Int8Array:
+            case Uint8Array:
+            case Uint8ClampedArray:
+                return toRegion(index, bytes, bytes.length, offset, length);
+            default:
+                return false;
+        }
+    }
+
     /**
      * To double array.
      *
@@ -366,13 +571,33 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
      */
     public double[] toDoubles() throws JavetException {
         if (getType() == V8ValueReferenceType.Float64Array) {
-            try (V8ValueArrayBuffer v8ValueArrayBuffer = getBuffer()) {
-                return v8ValueArrayBuffer.toDoubles();
-            }
+            ByteBuffer byteBuffer = getByteBuffer();
+            double[] doubles = new double[byteBuffer.capacity() / EIGHT_BYTES_PER_VALUE];
+            byteBuffer.asDoubleBuffer().get(doubles);
+            return doubles;
         }
         return null;
     }
 
+    /**
+     * Copy a region of the typed array to the double array without any byte buffer in between.
+     *
+     * @param index   the start index in the typed array
+     * @param doubles the double array
+     * @param offset  the start offset in the double array
+     * @param length  the element count
+     * @return true : copied, false : type mismatch or out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public boolean toDoubles(int index, double[] doubles, int offset, int length) throws JavetException {
+        Objects.requireNonNull(doubles);
+        if (getType() == V8ValueReferenceType.Float64Array) {
+            return toRegion(index, doubles, doubles.length, offset, length);
+        }
+        return false;
+    }
+
     /**
      * To float array.
      *
@@ -382,13 +607,33 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
      */
     public float[] toFloats() throws JavetException {
         if (getType() == V8ValueReferenceType.Float32Array) {
-            try (V8ValueArrayBuffer v8ValueArrayBuffer = getBuffer()) {
-                return v8ValueArrayBuffer.toFloats();
-            }
+            ByteBuffer byteBuffer = getByteBuffer();
+            float[] floats = new float[byteBuffer.capacity() / FOUR_BYTES_PER_VALUE];
+            byteBuffer.asFloatBuffer().get(floats);
+            return floats;
         }
         return null;
     }
 
+    /**
+     * Copy a region of the typed array to the float array without any byte buffer in between.
+     *
+     * @param index  the start index in the typed array
+     * @param floats the float array
+     * @param offset the start offset in the float array
+     * @param length the element count
+     * @return true : copied, false : type mismatch or out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public boolean toFloats(int index, float[] floats, int offset, int length) throws JavetException {
+        Objects.requireNonNull(floats);
+        if (getType() == V8ValueReferenceType.Float32Array) {
+            return toRegion(index, floats, floats.length, offset, length);
+        }
+        return false;
+    }
+
     /**
      * To int array.
      *
@@ -400,14 +645,37 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
         switch (getType()) {
             case Int32Array:
             case Uint32Array:
-                try (V8ValueArrayBuffer v8ValueArrayBuffer = getBuffer()) {
-                    return v8ValueArrayBuffer.toIntegers();
-                }
+                ByteBuffer byteBuffer = getByteBuffer();
+                int[] integers = new int[byteBuffer.capacity() / FOUR_BYTES_PER_VALUE];
+                byteBuffer.asIntBuffer().get(integers);
+                return integers;
             default:
                 return null;
         }
     }
 
+    /**
+     * Copy a region of the typed array to the integer array without any byte buffer in between.
+     *
+     * @param index    the start index in the typed array
+     * @param integers the integer array
+     * @param offset   the start offset in the integer array
+     * @param length   the element count
+     * @return true : copied, false : type mismatch or out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public boolean toIntegers(int index, int[] integers, int offset, int length) throws JavetException {
+        Objects.requireNonNull(integers);
+        switch (getType()) {
+            case Int32Array:
+            case Uint32Array:
+                return toRegion(index, integers, integers.length, offset, length);
+            default:
+                return false;
+        }
+    }
+
     /**
      * To long array.
      *
@@ -419,14 +687,57 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
         switch (getType()) {
             case BigInt64Array:
             case BigUint64Array:
-                try (V8ValueArrayBuffer v8ValueArrayBuffer = getBuffer()) {
-                    return v8ValueArrayBuffer.toLongs();
-                }
+                ByteBuffer byteBuffer = getByteBuffer();
+                long[] longs = new long[byteBuffer.capacity() / EIGHT_BYTES_PER_VALUE];
+                byteBuffer.asLongBuffer().get(longs);
+                return longs;
             default:
                 return null;
         }
     }
 
+    /**
+     * Copy a region of the typed array to the long array without any byte buffer in between.
+     *
+     * @param index  the start index in the typed array
+     * @param longs  the long array
+     * @param offset the start offset in the long array
+     * @param length the element count
+     * @return true : copied, false : type mismatch or out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public boolean toLongs(int index, long[] longs, int offset, int length) throws JavetException {
+        Objects.requireNonNull(longs);
+        switch (getType()) {
+            case BigInt64Array:
+            case BigUint64Array:
+                return toRegion(index, longs, longs.length, offset, length);
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * Copy a region from the typed array to a Java primitive array.
+     *
+     * @param index       the start index in the typed array
+     * @param array       the Java primitive array
+     * @param arrayLength the length of the Java primitive array
+     * @param offset      the start offset in the Java primitive array
+     * @param length      the element count
+     * @return true : copied, false : out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    protected boolean toRegion(int index, Object array, int arrayLength, int offset, int length)
+            throws JavetException {
+        if (offset < 0 || length < 0 || offset > arrayLength - length) {
+            return false;
+        }
+        return checkV8Runtime().getV8Internal().typedArrayGetRegion(this, index, array, offset, length);
+    }
+
     /**
      * To short array.
      *
@@ -439,11 +750,35 @@ public class V8ValueTypedArray extends V8ValueObject implements IV8ValueTypedArr
             case Int16Array:
             case Uint16Array:
             case Float16Array:
-                try (V8ValueArrayBuffer v8ValueArrayBuffer = getBuffer()) {
-                    return v8ValueArrayBuffer.toShorts();
-                }
+                ByteBuffer byteBuffer = getByteBuffer();
+                short[] shorts = new short[byteBuffer.capacity() / TWO_BYTES_PER_VALUE];
+                byteBuffer.asShortBuffer().get(shorts);
+                return shorts;
             default:
                 return null;
         }
     }
+
+    /**
+     * Copy a region of the typed array to the short array without any byte buffer in between.
+     *
+     * @param index  the start index in the typed array
+     * @param shorts the short array
+     * @param offset the start offset in the short array
+     * @param length the element count
+     * @return true : copied, false : type mismatch or out of bounds
+     * @throws JavetException the javet exception
+     * @since 5.0.4
+     */
+    public boolean toShorts(int index, short[] shorts, int offset, int length) throws JavetException {
+        Objects.requireNonNull(shorts);
+        switch (getType()) {
+            case Int16Array:
+            case Uint16Array:
+            case Float16Array:
+                return toRegion(index, shorts, shorts.length, offset, length);
+            default:
+                return false;
+        }
+    }
 }
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop;
+
+import com.caoccao.javet.BaseTestJavetRuntime;
+import com.caoccao.javet.exceptions.JavetError;
+import com.caoccao.javet.exceptions.JavetException;
+import com.caoccao.javet.values.reference.V8ValueArrayBuffer;
+import com.caoccao.javet.values.reference.V8ValueSharedArrayBuffer;
+import org.junit.jupiter.api.Test;
+
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+public class TestV8BackingStore extends BaseTestJavetRuntime {
+    @Test
+    public void testClosed() {
+        V8BackingStore v8BackingStore = v8Host.createV8BackingStore(16, false);
+        assertFalse(v8BackingStore.isClosed());
+        v8BackingStore.close();
+        assertTrue(v8BackingStore.isClosed());
+        v8BackingStore.close();
+        try {
+            v8Runtime.createV8ValueArrayBuffer(v8BackingStore).close();
+            fail("Failed to report closed backing store.");
+        } catch (JavetException e) {
+            assertEquals(JavetError.RuntimeBackingStoreInvalid, e.getError());
+        }
+        assertThrows(IllegalArgumentException.class, () -> v8Host.createV8BackingStore(ByteBuffer.allocate(1), false));
+    }
+
+    @Test
+    public void testCloseWhileInUse() {
+        V8BackingStore v8BackingStore = v8Host.createV8BackingStore(16, false);
+        assertTrue(v8BackingStore.acquire());
+        // The close from another thread is deferred until the attachment completes.
+        v8BackingStore.close();
+        assertTrue(v8BackingStore.isClosed());
+        assertNotEquals(0L, v8BackingStore.getHandle());
+        assertFalse(v8BackingStore.acquire());
+        v8BackingStore.release();
+        assertEquals(0L, v8BackingStore.getHandle());
+    }
+
+    @Test
+    public void testDirectByteBuffer() throws JavetException {
+        ByteBuffer byteBuffer = ByteBuffer.allocateDirect(4);
+        byteBuffer.put(new byte[]{1, 2, 3, 4});
+        ((Buffer) byteBuffer).flip();
+        try (V8BackingStore v8BackingStore = v8Host.createV8BackingStore(byteBuffer, false)) {
+            assertEquals(4, v8BackingStore.getLength());
+            assertFalse(v8BackingStore.isShared());
+            try (V8ValueArrayBuffer v8ValueArrayBuffer = v8Runtime.createV8ValueArrayBuffer(v8BackingStore)) {
+                v8Runtime.getGlobalObject().set("a", v8ValueArrayBuffer);
+            }
+            assertEquals("1,2,3,4", v8Runtime.getExecutor("new Uint8Array(a).join(',')").executeString());
+            byteBuffer.put(0, (byte) 5);
+            assertEquals(5, v8Runtime.getExecutor("new Uint8Array(a)[0]").executeInteger());
+        }
+        v8Runtime.getGlobalObject().delete("a");
+        v8Runtime.lowMemoryNotification();
+    }
+
+    @Test
+    public void testSharedByRuntimes() throws JavetException {
+        try (V8BackingStore v8BackingStore = v8Host.createV8BackingStore(1024, true)) {
+            assertTrue(v8BackingStore.isShared());
+            v8BackingStore.getByteBuffer().put(0, (byte) 1);
+            try (V8ValueArrayBuffer v8ValueArrayBuffer = v8Runtime.createV8ValueArrayBuffer(v8BackingStore)) {
+                assertInstanceOf(V8ValueSharedArrayBuffer.class, v8ValueArrayBuffer);
+                v8Runtime.getGlobalObject().set("a", v8ValueArrayBuffer);
+            }
+            try (V8Runtime anotherV8Runtime = v8Host.createV8Runtime()) {
+                try (V8ValueArrayBuffer v8ValueArrayBuffer = anotherV8Runtime.createV8ValueArrayBuffer(v8BackingStore)) {
+                    anotherV8Runtime.getGlobalObject().set("a", v8ValueArrayBuffer);
+                }
+                anotherV8Runtime.getExecutor("new Uint8Array(a)[1] = 2;").executeVoid();
+            }
+            // The memory is still alive because this V8 runtime holds another reference.
+            assertEquals(
+                    "1,2,1024",
+                    v8Runtime.getExecutor("const b = new Uint8Array(a); [b[0], b[1], a.byteLength].join(',')")
+                            .executeString());
+        }
+        assertEquals(2, v8Runtime.getExecutor("new Uint8Array(a)[1]").executeInteger());
+    }
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop;
+
+import com.caoccao.javet.BaseTestJavetRuntime;
+import com.caoccao.javet.exceptions.JavetException;
+import com.caoccao.javet.interop.executors.IV8Executor;
+import com.caoccao.javet.interop.monitoring.V8CodeCacheStatistics;
+import com.caoccao.javet.values.reference.V8Script;
+import com.caoccao.javet.values.reference.V8ValueFunction;
+import org.junit.jupiter.api.Test;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.stream.Stream;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+public class TestV8CodeCache extends BaseTestJavetRuntime {
+    private static final String SCRIPT_STRING = "const f = (a, b) => a + b; f(1, 2);";
+
+    private static void deleteDirectory(Path directory) throws IOException {
+        try (Stream<Path> stream = Files.list(directory)) {
+            for (Path path : (Iterable<Path>) stream::iterator) {
+                Files.delete(path);
+            }
+        }
+        Files.delete(directory);
+    }
+
+    @Test
+    public void testDirectory() throws JavetException, IOException {
+        Path directory = Files.createTempDirectory("javet-code-cache");
+        try {
+            V8CodeCache v8CodeCache = new V8CodeCache(directory);
+            v8Runtime.setV8CodeCache(v8CodeCache);
+            assertEquals(3, v8Runtime.getExecutor(SCRIPT_STRING).executeInteger());
+            try (Stream<Path> stream = Files.list(directory)) {
+                assertEquals(1L, stream.count());
+            }
+            // A new code cache reads the persisted code cache.
+            V8CodeCache newV8CodeCache = new V8CodeCache(directory);
+            v8Runtime.setV8CodeCache(newV8CodeCache);
+            resetContext();
+            assertEquals(3, v8Runtime.getExecutor(SCRIPT_STRING).executeInteger());
+            V8CodeCacheStatistics statistics = newV8CodeCache.getStatistics();
+            assertEquals(1, statistics.getDiskHitCount());
+            assertEquals(0, statistics.getMissCount());
+            assertEquals(0, statistics.getStoreCount());
+            v8CodeCache.clear();
+            newV8CodeCache.clear();
+        } finally {
+            v8Runtime.setV8CodeCache(null);
+            deleteDirectory(directory);
+        }
+    }
+
+    @Test
+    public void testEviction() throws IOException {
+        Path directory = Files.createTempDirectory("javet-code-cache");
+        try {
+            V8CodeCache v8CodeCache = new V8CodeCache(directory, 2, 10L);
+            assertEquals(2, v8CodeCache.getMaxSize());
+            assertEquals(10L, v8CodeCache.getMaxBytes());
+            v8CodeCache.put("a", new byte[]{1, 2, 3});
+            v8CodeCache.put("b", new byte[]{4, 5, 6});
+            assertNotNull(v8CodeCache.get("a"));
+            // The least recently used code cache is evicted from both the memory and the directory.
+            v8CodeCache.put("c", new byte[]{7, 8, 9});
+            V8CodeCacheStatistics statistics = v8CodeCache.getStatistics();
+            assertEquals(2, statistics.getSize());
+            assertEquals(6L, statistics.getBytes());
+            assertEquals(1, statistics.getEvictCount());
+            assertFalse(Files.exists(directory.resolve("b.cache")));
+            assertNull(v8CodeCache.get("b"));
+            // The max byte length evicts as well.
+            v8CodeCache.put("d", new byte[]{1, 2, 3, 4, 5, 6, 7, 8});
+            statistics = v8CodeCache.getStatistics();
+            assertEquals(1, statistics.getSize());
+            assertEquals(8L, statistics.getBytes());
+            assertEquals(3, statistics.getEvictCount());
+            // A code cache beyond the max byte length is not kept.
+            v8CodeCache.put("e", new byte[11]);
+            assertNull(v8CodeCache.get("e"));
+            assertArrayEquals(new byte[]{1, 2, 3, 4, 5, 6, 7, 8}, v8CodeCache.get("d"));
+            try (Stream<Path> stream = Files.list(directory)) {
+                assertEquals(1L, stream.count());
+            }
+        } finally {
+            deleteDirectory(directory);
+        }
+    }
+
+    @Test
+    public void testMemory() throws JavetException {
+        V8CodeCache v8CodeCache = new V8CodeCache();
+        v8Runtime.setV8CodeCache(v8CodeCache);
+        try {
+            assertEquals(3, v8Runtime.getExecutor(SCRIPT_STRING).executeInteger());
+            V8CodeCacheStatistics statistics = v8CodeCache.getStatistics();
+            assertEquals(0, statistics.getHitCount());
+            assertEquals(1, statistics.getMissCount());
+            assertEquals(1, statistics.getSize());
+            assertEquals(1, statistics.getStoreCount());
+            resetContext();
+            assertEquals(3, v8Runtime.getExecutor(SCRIPT_STRING).executeInteger());
+            resetContext();
+            try (V8Script v8Script = v8Runtime.getExecutor(SCRIPT_STRING).compileV8Script()) {
+                assertEquals(3, v8Script.executeInteger());
+            }
+            statistics = v8CodeCache.getStatistics();
+            assertEquals(2, statistics.getHitCount());
+            assertEquals(1, statistics.getMissCount());
+            // A different origin is a different key.
+            assertEquals(3, v8Runtime.getExecutor("1 + 2").setResourceName("a.js").executeInteger());
+            assertEquals(3, v8Runtime.getExecutor("1 + 2").setResourceName("b.js").executeInteger());
+            assertEquals(3, v8CodeCache.getStatistics().getSize());
+            try (V8ValueFunction v8ValueFunction = v8Runtime.getExecutor("return a + b;")
+                    .compileV8ValueFunction(new String[]{"a", "b"})) {
+                assertEquals(3, v8ValueFunction.callInteger(null, 1, 2));
+            }
+            assertEquals(4, v8CodeCache.getStatistics().getSize());
+            // Explicit cached data bypasses the code cache.
+            byte[] cachedData;
+            try (V8Script v8Script = v8Runtime.getExecutor("1 + 1").compileV8Script()) {
+                cachedData = v8Script.getCachedData();
+            }
+            assertEquals(5, v8CodeCache.getStatistics().getSize());
+            assertEquals(2, v8Runtime.getExecutor("1 + 1", cachedData).executeInteger());
+            assertEquals(5, v8CodeCache.getStatistics().getSize());
+        } finally {
+            v8Runtime.setV8CodeCache(null);
+        }
+    }
+
+    @Test
+    public void testRejected() throws JavetException {
+        V8CodeCache v8CodeCache = new V8CodeCache();
+        v8Runtime.setV8CodeCache(v8CodeCache);
+        try {
+            // A stale code cache is replaced by a fresh one.
+            String key = v8CodeCache.getKey(
+                    v8Runtime, V8CodeCache.KIND_SCRIPT, SCRIPT_STRING, new V8ScriptOrigin(), null);
+            v8CodeCache.put(key, new byte[]{1, 2, 3, 4, 5, 6, 7, 8});
+            IV8Executor iV8Executor = v8Runtime.getExecutor(SCRIPT_STRING);
+            assertEquals(3, iV8Executor.executeInteger());
+            assertTrue(iV8Executor.isCachedDataRejected());
+            V8CodeCacheStatistics statistics = v8CodeCache.getStatistics();
+            assertEquals(1, statistics.getHitCount());
+            assertEquals(1, statistics.getRejectCount());
+            assertEquals(1, statistics.getSize());
+            assertEquals(2, statistics.getStoreCount());
+            resetContext();
+            iV8Executor = v8Runtime.getExecutor(SCRIPT_STRING);
+            assertEquals(3, iV8Executor.executeInteger());
+            assertFalse(iV8Executor.isCachedDataRejected());
+            statistics = v8CodeCache.getStatistics();
+            assertEquals(2, statistics.getHitCount());
+            assertEquals(1, statistics.getRejectCount());
+        } finally {
+            v8Runtime.setV8CodeCache(null);
+        }
+    }
+}
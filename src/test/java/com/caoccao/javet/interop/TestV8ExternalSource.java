@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop;
+
+import com.caoccao.javet.BaseTestJavetRuntime;
+import com.caoccao.javet.exceptions.JavetError;
+import com.caoccao.javet.exceptions.JavetException;
+import com.caoccao.javet.values.reference.V8Script;
+import com.caoccao.javet.values.reference.V8ValueFunction;
+import org.junit.jupiter.api.Test;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+public class TestV8ExternalSource extends BaseTestJavetRuntime {
+    @Test
+    public void testClosed() throws JavetException {
+        V8ExternalSource v8ExternalSource = v8Host.createV8ExternalSource("1 + 1");
+        assertFalse(v8ExternalSource.isClosed());
+        v8ExternalSource.close();
+        assertTrue(v8ExternalSource.isClosed());
+        v8ExternalSource.close();
+        try {
+            v8Runtime.getExecutor(v8ExternalSource).executeInteger();
+            fail("Failed to report closed external source.");
+        } catch (JavetException e) {
+            assertEquals(JavetError.RuntimeExternalSourceInvalid, e.getError());
+        }
+    }
+
+    @Test
+    public void testCloseWhileInUse() throws JavetException {
+        V8ExternalSource v8ExternalSource = v8Host.createV8ExternalSource("1 + 1");
+        assertTrue(v8ExternalSource.acquire());
+        // The close from another thread is deferred until the compilation completes.
+        v8ExternalSource.close();
+        assertTrue(v8ExternalSource.isClosed());
+        assertNotEquals(0L, v8ExternalSource.getHandle());
+        assertFalse(v8ExternalSource.acquire());
+        v8ExternalSource.release();
+        assertEquals(0L, v8ExternalSource.getHandle());
+    }
+
+    @Test
+    public void testDirectByteBuffer() throws JavetException {
+        byte[] bytes = "'abc' + 'é'".getBytes(StandardCharsets.ISO_8859_1);
+        ByteBuffer byteBuffer = ByteBuffer.allocateDirect(bytes.length + 2);
+        byteBuffer.put((byte) ' ').put(bytes).put((byte) ' ');
+        byteBuffer.flip();
+        try (V8ExternalSource v8ExternalSource = v8Host.createV8ExternalSource(byteBuffer, true)) {
+            assertTrue(v8ExternalSource.isOneByte());
+            assertEquals(bytes.length + 2, v8ExternalSource.getLength());
+            assertEquals("abcé", v8Runtime.getExecutor(v8ExternalSource).executeString());
+        }
+        assertThrows(IllegalArgumentException.class, () -> v8Host.createV8ExternalSource(ByteBuffer.allocate(1), true));
+    }
+
+    @Test
+    public void testSharedByRuntimes() throws JavetException {
+        String codeString = "const a = ['中文', 'abc']; a.join(',') + ' ' + (() => 1 + 1)()";
+        try (V8ExternalSource v8ExternalSource = v8Host.createV8ExternalSource(codeString)) {
+            assertFalse(v8ExternalSource.isOneByte());
+            assertEquals(codeString, v8ExternalSource.toString());
+            assertEquals(codeString, v8Runtime.getExecutor(v8ExternalSource).getScriptString());
+            assertEquals("中文,abc 2", v8Runtime.getExecutor(v8ExternalSource).executeString());
+            try (V8Runtime anotherV8Runtime = v8Host.createV8Runtime()) {
+                assertEquals("中文,abc 2", anotherV8Runtime.getExecutor(v8ExternalSource).executeString());
+            }
+        }
+        try (V8ExternalSource v8ExternalSource = v8Host.createV8ExternalSource("a + b")) {
+            assertTrue(v8ExternalSource.isOneByte());
+            try (V8Script v8Script = v8Runtime.getExecutor(v8ExternalSource).compileV8Script()) {
+                v8Runtime.getGlobalObject().set("a", 1);
+                v8Runtime.getGlobalObject().set("b", 2);
+                assertEquals(3, v8Script.executeInteger());
+            }
+            try (V8ValueFunction v8ValueFunction = v8Runtime.getExecutor(v8ExternalSource)
+                    .compileV8ValueFunction(new String[]{"a", "b"})) {
+                assertEquals(5, v8ValueFunction.callInteger(null, 2, 3));
+            }
+        }
+        // The native sources are released once V8 collects the strings created from them.
+        v8Runtime.lowMemoryNotification();
+    }
+}
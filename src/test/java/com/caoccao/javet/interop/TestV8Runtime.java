@@ -28,12 +28,17 @@ import com.caoccao.javet.interop.callback.IJavetNearHeapLimitCallback;
 import com.caoccao.javet.interop.options.RuntimeOptions;
 import com.caoccao.javet.interop.options.V8RuntimeOptions;
 import com.caoccao.javet.mock.MockNearHeapLimitCallback;
+import com.caoccao.javet.utils.JavetResourceUtils;
 import com.caoccao.javet.utils.SimpleList;
+import com.caoccao.javet.values.reference.V8ValueArray;
 import com.caoccao.javet.values.reference.V8ValueObject;
 import org.junit.jupiter.api.Test;
 import org.junit.jupiter.params.ParameterizedTest;
 import org.junit.jupiter.params.provider.EnumSource;
 
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
 import java.util.ArrayList;
 import java.util.EnumSet;
 import java.util.List;
@@ -75,6 +80,28 @@ public class TestV8Runtime extends BaseTestJavet {
         assertTrue(danglingV8Runtime.isClosed());
     }
 
+    @Test
+    public void testDeserialize() throws JavetException {
+        try (V8Runtime v8Runtime = v8Host.createV8Runtime()) {
+            ByteBuffer byteBuffer = ByteBuffer.allocateDirect(1024);
+            int length;
+            try (V8ValueObject v8ValueObject = v8Runtime.getExecutor("({ a: 1, b: 'x' })").execute()) {
+                length = v8Runtime.serialize(v8ValueObject, byteBuffer);
+            }
+            assertTrue(length > 0);
+            try (V8ValueObject v8ValueObject = v8Runtime.deserialize(byteBuffer, length)) {
+                assertEquals(1, v8ValueObject.getInteger("a"));
+                assertEquals("x", v8ValueObject.getString("b"));
+            }
+            // Truncated data is reported instead of being returned as undefined.
+            final int truncatedLength = length - 1;
+            assertThrows(JavetException.class, () -> v8Runtime.deserialize(byteBuffer, truncatedLength));
+            assertThrows(JavetException.class, () -> v8Runtime.deserialize(byteBuffer, 0));
+            assertThrows(IllegalArgumentException.class, () -> v8Runtime.deserialize(ByteBuffer.allocate(16), 16));
+            assertEquals(2, v8Runtime.getExecutor("1 + 1").executeInteger());
+        }
+    }
+
     @Test
     public void testExecuteScript() throws JavetException {
         try (V8Runtime v8Runtime = v8Host.createV8Runtime()) {
@@ -149,6 +176,59 @@ public class TestV8Runtime extends BaseTestJavet {
         }
     }
 
+    @Test
+    public void testJson() throws JavetException {
+        try (V8Runtime v8Runtime = v8Host.createV8Runtime()) {
+            String json = "{\"a\":1,\"b\":[\"x\",\"é中😀\"],\"c\":null}";
+            byte[] bytes = json.getBytes(StandardCharsets.UTF_8);
+            ByteBuffer byteBuffer = ByteBuffer.allocateDirect(bytes.length + 1);
+            byteBuffer.put((byte) ' ').put(bytes);
+            ((Buffer) byteBuffer).flip();
+            ((Buffer) byteBuffer).position(1);
+            try (V8ValueObject v8ValueObject = v8Runtime.jsonParse(byteBuffer)) {
+                assertFalse(byteBuffer.hasRemaining());
+                assertEquals(1, v8ValueObject.getInteger("a"));
+                try (V8ValueArray v8ValueArray = v8ValueObject.get("b")) {
+                    assertEquals("é中😀", v8ValueArray.getString(1));
+                }
+                ByteBuffer smallByteBuffer = ByteBuffer.allocateDirect(4);
+                smallByteBuffer.put((byte) '[');
+                assertEquals(bytes.length, v8Runtime.jsonStringify(v8ValueObject, smallByteBuffer));
+                assertEquals(1, smallByteBuffer.position());
+                ByteBuffer grownByteBuffer = v8Runtime.jsonStringifyGrowable(v8ValueObject, smallByteBuffer);
+                assertNotSame(smallByteBuffer, grownByteBuffer);
+                assertEquals(bytes.length + 1, grownByteBuffer.position());
+                ((Buffer) grownByteBuffer).flip();
+                byte[] outputBytes = new byte[grownByteBuffer.remaining()];
+                grownByteBuffer.get(outputBytes);
+                assertEquals("[" + json, new String(outputBytes, StandardCharsets.UTF_8));
+            }
+            ((Buffer) byteBuffer).clear();
+            byteBuffer.put("{".getBytes(StandardCharsets.UTF_8));
+            ((Buffer) byteBuffer).flip();
+            assertThrows(JavetExecutionException.class, () -> v8Runtime.jsonParse(byteBuffer));
+            assertThrows(IllegalArgumentException.class, () -> v8Runtime.jsonParse(ByteBuffer.wrap(bytes)));
+            // The value is stringified only once even if the byte buffer grows.
+            try (V8ValueObject v8ValueObject = v8Runtime.getExecutor(
+                    "globalThis.count = 0; ({ toJSON() { ++globalThis.count; return 'abc'; } })").execute()) {
+                ByteBuffer grownByteBuffer = v8Runtime.jsonStringifyGrowable(v8ValueObject, ByteBuffer.allocateDirect(1));
+                assertEquals(5, grownByteBuffer.position());
+                assertEquals(1, v8Runtime.getGlobalObject().getInteger("count"));
+                // The bytes after the limit are not written even if the capacity is large enough.
+                ByteBuffer limitedByteBuffer = ByteBuffer.allocateDirect(16);
+                ((Buffer) limitedByteBuffer).limit(2);
+                assertEquals(5, v8Runtime.jsonStringify(v8ValueObject, limitedByteBuffer));
+                assertEquals(0, limitedByteBuffer.position());
+                assertEquals(0, limitedByteBuffer.get(0));
+                grownByteBuffer = v8Runtime.jsonStringifyGrowable(v8ValueObject, limitedByteBuffer);
+                assertNotSame(limitedByteBuffer, grownByteBuffer);
+                assertEquals(5, grownByteBuffer.position());
+                assertEquals(3, v8Runtime.getGlobalObject().getInteger("count"));
+                v8Runtime.getGlobalObject().delete("count");
+            }
+        }
+    }
+
     @Test
     public void testLowMemoryNotification() throws JavetException {
         try (V8Runtime v8Runtime = v8Host.createV8Runtime()) {
@@ -209,6 +289,37 @@ public class TestV8Runtime extends BaseTestJavet {
         }
     }
 
+    @Test
+    public void testReferenceRelease() throws JavetException {
+        try (V8Runtime v8Runtime = v8Host.createV8Runtime()) {
+            // Batch
+            List<V8ValueObject> v8ValueObjects = new ArrayList<>();
+            for (int i = 0; i < 1000; ++i) {
+                v8ValueObjects.add(v8Runtime.createV8ValueObject());
+            }
+            assertEquals(1000, v8Runtime.getReferenceCount());
+            JavetResourceUtils.safeClose(v8ValueObjects);
+            assertEquals(0, v8Runtime.getReferenceCount());
+            assertEquals(0, v8Runtime.getPendingReferenceCount());
+            assertTrue(v8ValueObjects.stream().allMatch(V8ValueObject::isClosed));
+            // Deferred
+            assertFalse(v8Runtime.isReferenceReleaseDeferred());
+            v8Runtime.setReferenceReleaseDeferred(true);
+            assertTrue(v8Runtime.isReferenceReleaseDeferred());
+            for (int i = 0; i < 10; ++i) {
+                v8Runtime.createV8ValueObject().close();
+            }
+            assertEquals(0, v8Runtime.getReferenceCount());
+            assertEquals(10, v8Runtime.getPendingReferenceCount());
+            v8Runtime.flushReferences();
+            assertEquals(0, v8Runtime.getPendingReferenceCount());
+            v8Runtime.createV8ValueObject().close();
+            assertEquals(1, v8Runtime.getPendingReferenceCount());
+            v8Runtime.setReferenceReleaseDeferred(false);
+            assertEquals(0, v8Runtime.getPendingReferenceCount());
+        }
+    }
+
     @Test
     public void testResetContext() throws JavetException {
         try (V8Runtime v8Runtime = v8Host.createV8Runtime()) {
@@ -35,9 +35,77 @@ import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.List;
 
-import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.*;
 
 public class TestV8FunctionCallback extends BaseTestJavetRuntime {
+    @Test
+    public void testFastCall() throws JavetException {
+        IJavetAnonymous anonymous = new IJavetAnonymous() {
+            @V8Function(fastCall = true)
+            public double multiply(double a, int b) {
+                return a * b;
+            }
+        };
+        try (V8ValueObject v8ValueObject = v8Runtime.createV8ValueObject()) {
+            v8Runtime.getGlobalObject().set("a", v8ValueObject);
+            List<JavetCallbackContext> javetCallbackContexts = v8ValueObject.bind(anonymous);
+            assertEquals(1, javetCallbackContexts.size());
+            assertTrue(javetCallbackContexts.get(0).isFastCall());
+            // The results are the same whether the optimized code takes the fast API call or not.
+            assertEquals(
+                    2.0 * 100_000,
+                    v8Runtime.getExecutor(
+                            "let sum = 0; for (let i = 0; i < 100_000; ++i) { sum += a.multiply(0.5, 4); } sum;")
+                            .executeDouble(),
+                    0.001);
+            assertEquals(3.0, v8Runtime.getExecutor("a.multiply(1.5, 2)").executeDouble(), 0.001);
+            v8Runtime.getGlobalObject().delete("a");
+        }
+    }
+
+    @Test
+    public void testPrimitiveSignature() throws JavetException, NoSuchMethodException {
+        IJavetAnonymous anonymous = new IJavetAnonymous() {
+            @V8Function
+            public double add(double a, int b) {
+                return a + b;
+            }
+
+            @V8Function
+            public String concat(String a, long b, boolean c) {
+                return a + b + c;
+            }
+
+            @V8Function
+            public String empty() {
+                return null;
+            }
+
+            @V8Function
+            public void throwError(int a) {
+                throw new RuntimeException("Error " + a);
+            }
+        };
+        try (V8ValueObject v8ValueObject = v8Runtime.createV8ValueObject()) {
+            v8Runtime.getGlobalObject().set("a", v8ValueObject);
+            v8ValueObject.bind(anonymous);
+            // Exact types go through the primitive trampoline.
+            assertEquals(3.5, v8Runtime.getExecutor("a.add(1.5, 2)").executeDouble(), 0.001);
+            assertEquals("x1true", v8Runtime.getExecutor("a.concat('x', 1, true)").executeString());
+            assertEquals("x2false", v8Runtime.getExecutor("a.concat('x', 2n, false)").executeString());
+            assertTrue(v8Runtime.getExecutor("a.empty() === null").executeBoolean());
+            assertEquals("Error 1", v8Runtime.getExecutor(
+                    "try { a.throwError(1); } catch (e) { e.message; }").executeString());
+            // Mismatched types fall back to the regular callback path.
+            assertEquals(1.5, v8Runtime.getExecutor("a.add(1.5)").executeDouble(), 0.001);
+            assertEquals("x0false", v8Runtime.getExecutor("a.concat('x')").executeString());
+            v8Runtime.getGlobalObject().delete("a");
+        }
+        JavetCallbackContext javetCallbackContext = new JavetCallbackContext(
+                "add", anonymous, anonymous.getClass().getMethod("add", double.class, int.class), true);
+        assertNull(javetCallbackContext.getPrimitiveSignature(), "This object disables the primitive signature.");
+    }
+
     @Test
     @Tag("performance")
     public void testReceiveCallbackMultipleThreaded() {
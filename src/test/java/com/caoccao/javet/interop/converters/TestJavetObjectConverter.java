@@ -21,6 +21,7 @@ import com.caoccao.javet.entities.JavetEntityFunction;
 import com.caoccao.javet.entities.JavetEntityMap;
 import com.caoccao.javet.entities.JavetEntitySymbol;
 import com.caoccao.javet.enums.JSFunctionType;
+import com.caoccao.javet.enums.JavetConversionMode;
 import com.caoccao.javet.enums.V8ValueErrorType;
 import com.caoccao.javet.enums.V8ValueReferenceType;
 import com.caoccao.javet.exceptions.JavetConverterException;
@@ -36,7 +37,9 @@ import com.caoccao.javet.values.V8Value;
 import com.caoccao.javet.values.reference.*;
 import org.junit.jupiter.api.Test;
 
+import java.math.BigInteger;
 import java.time.ZonedDateTime;
+import java.util.Arrays;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
@@ -280,6 +283,100 @@ public class TestJavetObjectConverter extends BaseTestJavetRuntime {
         }
     }
 
+    @Test
+    public void testSerializedConversionMode() throws JavetException {
+        JavetObjectConverter recursiveConverter = new JavetObjectConverter();
+        JavetObjectConverter serializedConverter = new JavetObjectConverter();
+        serializedConverter.getConfig().setConversionMode(JavetConversionMode.Serialized);
+        String codeString = "({\n" +
+                "  a: [1, 'abc', 1.5, null, undefined, true, 123n, 2 ** 31],\n" +
+                "  b: new Map([['x', 1], [2, 'y']]),\n" +
+                "  c: new Set(['x', 1]),\n" +
+                "  d: new Date(1611710223719),\n" +
+                "  e: new Int32Array([1, 2, 3]),\n" +
+                "  f: { g: '中文', h: undefined },\n" +
+                "  i: [, 1],\n" +
+                "})";
+        try (V8ValueObject v8ValueObject = v8Runtime.getExecutor(codeString).execute()) {
+            Map<String, Object> expectedMap = recursiveConverter.toObject(v8ValueObject);
+            Map<String, Object> map = serializedConverter.toObject(v8ValueObject);
+            assertEquals(expectedMap.keySet(), map.keySet());
+            assertEquals(expectedMap.get("a"), map.get("a"));
+            assertInstanceOf(JavetEntityMap.class, map.get("b"));
+            assertEquals(expectedMap.get("b"), map.get("b"));
+            assertEquals(expectedMap.get("c"), map.get("c"));
+            assertEquals(expectedMap.get("d"), map.get("d"));
+            assertArrayEquals((int[]) expectedMap.get("e"), (int[]) map.get("e"));
+            assertEquals(expectedMap.get("f"), map.get("f"));
+            assertEquals(expectedMap.get("i"), map.get("i"));
+        }
+        // Functions cannot be serialized so that the conversion falls back to the recursive one.
+        try (V8ValueObject v8ValueObject = v8Runtime.getExecutor("({ a: 1, b: () => 1 })").execute()) {
+            Map<String, Object> map = serializedConverter.toObject(v8ValueObject);
+            assertEquals(SimpleMap.of("a", 1), map);
+        }
+        v8Runtime.getExecutor("var a = {}; a.b = a;").executeVoid();
+        try (V8ValueObject v8ValueObject = v8Runtime.getGlobalObject().get("a")) {
+            serializedConverter.toObject(v8ValueObject);
+            fail("Failed to report circular structure.");
+        } catch (JavetConverterException e) {
+            assertEquals(JavetError.ConverterCircularStructure, e.getError());
+        }
+    }
+
+    @Test
+    public void testSerializedConversionModeToV8Value() throws JavetException {
+        JavetObjectConverter converter = new JavetObjectConverter();
+        converter.getConfig().setConversionMode(JavetConversionMode.Serialized);
+        JavetEntityMap javetEntityMap = new JavetEntityMap();
+        javetEntityMap.put("x", 1);
+        Map<String, Object> map = new HashMap<>();
+        map.put("a", SimpleList.of(1, "abc", 1.5D, null, true, 123L, "中文"));
+        map.put("b", javetEntityMap);
+        map.put("c", SimpleSet.of("x"));
+        map.put("d", JavetDateTimeUtils.toZonedDateTime(1611710223719L));
+        map.put("e", new int[]{1, 2, 3});
+        map.put("f", new Object[]{SimpleMap.of("g", 'h')});
+        try (V8ValueObject v8ValueObject = converter.toV8Value(v8Runtime, map)) {
+            v8Runtime.getGlobalObject().set("o", v8ValueObject);
+        }
+        assertEquals(
+                "[1,\"abc\",1.5,null,true,\"bigint\",\"中文\"]",
+                v8Runtime.getExecutor("JSON.stringify(o.a.map(v => typeof v === 'bigint' ? 'bigint' : v))")
+                        .executeString());
+        assertEquals(123L, v8Runtime.getExecutor("o.a[5]").executeLong());
+        assertTrue(v8Runtime.getExecutor("o.b instanceof Map && o.b.get('x') === 1").executeBoolean());
+        assertTrue(v8Runtime.getExecutor("o.c instanceof Set && o.c.has('x')").executeBoolean());
+        assertEquals(1611710223719L, v8Runtime.getExecutor("o.d.getTime()").executeLong());
+        assertEquals("Int32Array:1,2,3", v8Runtime.getExecutor("`${o.e.constructor.name}:${o.e}`").executeString());
+        assertEquals("h", v8Runtime.getExecutor("o.f[0].g").executeString());
+        v8Runtime.getGlobalObject().delete("o");
+        // Java objects that are not plain data fall back to the recursive conversion.
+        try (V8ValueArray v8ValueArray = converter.toV8Value(v8Runtime, SimpleList.of(new JavetEntitySymbol("s")))) {
+            try (V8Value v8Value = v8ValueArray.get(0)) {
+                assertInstanceOf(V8ValueSymbol.class, v8Value);
+            }
+        }
+    }
+
+    @Test
+    public void testSerializedConversionModeWithBigInt() throws JavetException {
+        JavetObjectConverter serializedConverter = new JavetObjectConverter();
+        serializedConverter.getConfig().setConversionMode(JavetConversionMode.Serialized);
+        String codeString = "[0n, 1n, -1n, 2n ** 63n - 1n, -(2n ** 63n), 2n ** 63n, -(2n ** 63n) - 1n, 2n ** 64n - 1n, 2n ** 64n]";
+        try (V8ValueArray v8ValueArray = v8Runtime.getExecutor(codeString).execute()) {
+            List<Object> list = serializedConverter.toObject(v8ValueArray);
+            assertEquals(
+                    Arrays.asList(
+                            0L, 1L, -1L, Long.MAX_VALUE, Long.MIN_VALUE,
+                            BigInteger.ONE.shiftLeft(63),
+                            BigInteger.ONE.shiftLeft(63).negate().subtract(BigInteger.ONE),
+                            BigInteger.ONE.shiftLeft(64).subtract(BigInteger.ONE),
+                            BigInteger.ONE.shiftLeft(64)),
+                    list);
+        }
+    }
+
     @Test
     public void testSet() throws JavetException {
         IJavetConverter converter = new JavetObjectConverter();
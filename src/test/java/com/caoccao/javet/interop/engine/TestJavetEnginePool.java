@@ -261,6 +261,38 @@ public class TestJavetEnginePool extends BaseTestJavet {
         assertStatistics();
     }
 
+    @Test
+    public void testPrelude() throws Exception {
+        javetEnginePool.close();
+        javetEngineConfig = new JavetEngineConfig()
+                .setJSRuntimeType(v8Host.getJSRuntimeType())
+                .setPoolDaemonCheckIntervalMillis(TEST_POOL_DAEMON_CHECK_INTERVAL_MILLIS)
+                .setPoolMaxSize(4)
+                .setPoolMinSize(2)
+                .setPoolWarmUpThreadCount(2)
+                .setPrelude(new JavetEnginePrelude()
+                        .addScript("prelude.js", "function add(a, b) { return a + b; } add(1, 2);"));
+        javetEnginePool = new JavetEnginePool<>(javetEngineConfig);
+        runAndWait(TEST_MAX_TIMEOUT * 10, () -> javetEnginePool.getIdleEngineCount() == 2);
+        JavetEnginePoolStatistics statistics = javetEnginePool.getStatistics();
+        assertEquals(0, statistics.getActiveEngineCount());
+        assertEquals(2, statistics.getEngineCreateCount());
+        assertEquals(2, statistics.getEngineWarmUpCount());
+        assertEquals(2, statistics.getIdleEngineCount());
+        assertEquals(1, statistics.getPreludeSize());
+        assertEquals(1, statistics.getPreludeCodeCacheCount());
+        assertEquals(2, statistics.getPreludeCodeCacheConsumedCount());
+        assertTrue(javetEngineConfig.getPrelude().isWarmedUp());
+        assertThrows(IllegalStateException.class, () -> javetEngineConfig.getPrelude().addScript("a.js", "1"));
+        try (IJavetEngine<?> engine = javetEnginePool.getEngine()) {
+            V8Runtime v8Runtime = engine.getV8Runtime();
+            assertEquals(3, v8Runtime.getExecutor("add(1, 2)").executeInteger());
+            engine.resetContext();
+            assertEquals(5, v8Runtime.getExecutor("add(2, 3)").executeInteger());
+        }
+        runAndWait(TEST_MAX_TIMEOUT, () -> javetEnginePool.getActiveEngineCount() == 0);
+    }
+
     @Test
     public void testSingleThreadedExecution() throws Exception {
         final List<CompletableFuture<V8HeapStatistics>> v8HeapStatisticsFutureList = new ArrayList<>();
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop.monitoring;
+
+import com.caoccao.javet.BaseTestJavetRuntime;
+import com.caoccao.javet.exceptions.JavetException;
+import com.caoccao.javet.exceptions.JavetExecutionException;
+import com.caoccao.javet.exceptions.JavetOutOfMemoryException;
+import com.caoccao.javet.interop.V8Runtime;
+import com.caoccao.javet.interop.options.V8RuntimeOptions;
+import org.junit.jupiter.api.Test;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+public class TestV8ArrayBufferStatistics extends BaseTestJavetRuntime {
+    @Test
+    public void testGetV8ArrayBufferStatistics() throws JavetException {
+        if (isNode()) {
+            assertNull(v8Runtime.getV8ArrayBufferStatistics());
+            return;
+        }
+        V8RuntimeOptions v8RuntimeOptions = new V8RuntimeOptions()
+                .setArrayBufferPoolSize(64 * 1024)
+                .setMaxArrayBufferSize(1024 * 1024);
+        try (V8Runtime cappedV8Runtime = v8Host.createV8Runtime(v8RuntimeOptions)) {
+            V8ArrayBufferStatistics v8ArrayBufferStatistics = cappedV8Runtime.getV8ArrayBufferStatistics();
+            assertNotNull(v8ArrayBufferStatistics);
+            assertEquals(1024 * 1024, v8ArrayBufferStatistics.getMaxAllocatedBytes());
+            assertEquals(0, v8ArrayBufferStatistics.getRejectionCount());
+            cappedV8Runtime.getExecutor("var a = new ArrayBuffer(512 * 1024);").executeVoid();
+            v8ArrayBufferStatistics = cappedV8Runtime.getV8ArrayBufferStatistics();
+            assertTrue(v8ArrayBufferStatistics.getAllocatedBytes() >= 512 * 1024);
+            assertTrue(v8ArrayBufferStatistics.getPeakAllocatedBytes() >= 512 * 1024);
+            assertTrue(v8ArrayBufferStatistics.getAllocationCount() >= 1);
+            try {
+                cappedV8Runtime.getExecutor("new ArrayBuffer(768 * 1024);").executeVoid();
+                fail("Failed to reject the array buffer beyond the cap.");
+            } catch (JavetExecutionException e) {
+                assertTrue(e.getMessage().contains("RangeError"));
+            }
+            assertEquals(1, cappedV8Runtime.getV8ArrayBufferStatistics().getRejectionCount());
+            assertThrows(JavetOutOfMemoryException.class, () -> cappedV8Runtime.createV8ValueArrayBuffer(768 * 1024));
+            assertEquals(2, cappedV8Runtime.getV8ArrayBufferStatistics().getRejectionCount());
+            // Small array buffers are returned to the pools after GC and reused afterwards.
+            cappedV8Runtime.getExecutor("for (let i = 0; i < 100; ++i) new Uint8Array(new ArrayBuffer(1000));").executeVoid();
+            cappedV8Runtime.lowMemoryNotification();
+            cappedV8Runtime.getExecutor("new ArrayBuffer(1000);").executeVoid();
+            v8ArrayBufferStatistics = cappedV8Runtime.getV8ArrayBufferStatistics();
+            assertTrue(v8ArrayBufferStatistics.getPooledBytes() <= 64 * 1024);
+            assertNotNull(v8ArrayBufferStatistics.toString());
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop.monitoring;
+
+import com.caoccao.javet.BaseTestJavetRuntime;
+import com.caoccao.javet.exceptions.JavetException;
+import com.caoccao.javet.interop.V8Runtime;
+import com.caoccao.javet.interop.options.RuntimeOptions;
+import com.caoccao.javet.values.reference.V8ValueObject;
+import org.junit.jupiter.api.Test;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+public class TestV8PropertyKeyCacheStatistics extends BaseTestJavetRuntime {
+    @Test
+    public void testDisabledByDefault() throws JavetException {
+        V8PropertyKeyCacheStatistics v8PropertyKeyCacheStatistics = v8Runtime.getV8PropertyKeyCacheStatistics();
+        assertNotNull(v8PropertyKeyCacheStatistics);
+        assertEquals(0, v8PropertyKeyCacheStatistics.getCapacity());
+        v8Runtime.getGlobalObject().set("a", 1);
+        assertEquals(1, v8Runtime.getGlobalObject().getInteger("a"));
+        v8PropertyKeyCacheStatistics = v8Runtime.getV8PropertyKeyCacheStatistics();
+        assertEquals(0, v8PropertyKeyCacheStatistics.getHitCount());
+        assertEquals(0, v8PropertyKeyCacheStatistics.getMissCount());
+        assertEquals(0, v8PropertyKeyCacheStatistics.getSize());
+    }
+
+    @Test
+    public void testGetV8PropertyKeyCacheStatistics() throws JavetException {
+        RuntimeOptions<?> runtimeOptions = v8Host.getJSRuntimeType().getRuntimeOptions();
+        runtimeOptions.setPropertyKeyCacheSize(2);
+        try (V8Runtime cachedV8Runtime = v8Host.createV8Runtime(runtimeOptions)) {
+            try (V8ValueObject v8ValueObject = cachedV8Runtime.getExecutor(
+                    "const o = { f: function(x) { return x + 1; } }; o;").execute()) {
+                v8ValueObject.set("a", 1);
+                assertEquals(1, v8ValueObject.getInteger("a"));
+                v8ValueObject.setPrivateProperty("b", 2);
+                assertEquals(2, v8ValueObject.getPrivatePropertyInteger("b"));
+                assertTrue(v8ValueObject.hasPrivateProperty("b"));
+                assertFalse(v8ValueObject.has("b"));
+                assertEquals(3, v8ValueObject.invokeInteger("f", 2));
+                assertEquals(1, v8ValueObject.getInteger("a"));
+            }
+            V8PropertyKeyCacheStatistics v8PropertyKeyCacheStatistics = cachedV8Runtime.getV8PropertyKeyCacheStatistics();
+            assertEquals(2, v8PropertyKeyCacheStatistics.getCapacity());
+            assertEquals(2, v8PropertyKeyCacheStatistics.getSize());
+            assertTrue(v8PropertyKeyCacheStatistics.getHitCount() >= 2);
+            assertTrue(v8PropertyKeyCacheStatistics.getMissCount() >= 4);
+            assertTrue(v8PropertyKeyCacheStatistics.getEvictionCount() >= 2);
+            assertNotNull(v8PropertyKeyCacheStatistics.toString());
+            cachedV8Runtime.resetContext();
+            assertEquals(0, cachedV8Runtime.getV8PropertyKeyCacheStatistics().getSize());
+            cachedV8Runtime.getGlobalObject().set("a", 1);
+            assertEquals(1, cachedV8Runtime.getGlobalObject().getInteger("a"));
+            assertTrue(cachedV8Runtime.getV8PropertyKeyCacheStatistics().getSize() >= 1);
+        }
+    }
+}
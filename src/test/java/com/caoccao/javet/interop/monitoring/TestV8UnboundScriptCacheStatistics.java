@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026. caoccao.com Sam Cao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.caoccao.javet.interop.monitoring;
+
+import com.caoccao.javet.BaseTestJavetRuntime;
+import com.caoccao.javet.exceptions.JavetException;
+import com.caoccao.javet.interop.V8Runtime;
+import com.caoccao.javet.interop.options.RuntimeOptions;
+import com.caoccao.javet.values.reference.V8Script;
+import org.junit.jupiter.api.Test;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+public class TestV8UnboundScriptCacheStatistics extends BaseTestJavetRuntime {
+    @Test
+    public void testDisabledByDefault() throws JavetException {
+        V8UnboundScriptCacheStatistics v8UnboundScriptCacheStatistics = v8Runtime.getV8UnboundScriptCacheStatistics();
+        assertNotNull(v8UnboundScriptCacheStatistics);
+        assertEquals(0, v8UnboundScriptCacheStatistics.getCapacity());
+        assertEquals(2, v8Runtime.getExecutor("1 + 1").executeInteger());
+        v8UnboundScriptCacheStatistics = v8Runtime.getV8UnboundScriptCacheStatistics();
+        assertEquals(0, v8UnboundScriptCacheStatistics.getHitCount());
+        assertEquals(0, v8UnboundScriptCacheStatistics.getMissCount());
+        assertEquals(0, v8UnboundScriptCacheStatistics.getSize());
+    }
+
+    @Test
+    public void testGetV8UnboundScriptCacheStatistics() throws JavetException {
+        RuntimeOptions<?> runtimeOptions = v8Host.getJSRuntimeType().getRuntimeOptions();
+        runtimeOptions.setUnboundScriptCacheSize(2);
+        try (V8Runtime cachedV8Runtime = v8Host.createV8Runtime(runtimeOptions)) {
+            final String codeString = "var a = (a || 0) + 1; a;";
+            assertEquals(1, cachedV8Runtime.getExecutor(codeString).executeInteger());
+            assertEquals(2, cachedV8Runtime.getExecutor(codeString).executeInteger());
+            // The script is bound to the new context without being compiled again.
+            cachedV8Runtime.resetContext();
+            try (V8Script v8Script = cachedV8Runtime.getExecutor(codeString).compileV8Script()) {
+                assertEquals(1, v8Script.executeInteger());
+            }
+            V8UnboundScriptCacheStatistics v8UnboundScriptCacheStatistics =
+                    cachedV8Runtime.getV8UnboundScriptCacheStatistics();
+            assertEquals(2, v8UnboundScriptCacheStatistics.getCapacity());
+            assertEquals(2, v8UnboundScriptCacheStatistics.getHitCount());
+            assertEquals(1, v8UnboundScriptCacheStatistics.getMissCount());
+            assertEquals(1, v8UnboundScriptCacheStatistics.getSize());
+            // A different origin is a different script.
+            assertEquals(2, cachedV8Runtime.getExecutor(codeString).setResourceName("a.js").executeInteger());
+            assertEquals(3, cachedV8Runtime.getExecutor("1 + 2").executeInteger());
+            v8UnboundScriptCacheStatistics = cachedV8Runtime.getV8UnboundScriptCacheStatistics();
+            assertEquals(2, v8UnboundScriptCacheStatistics.getSize());
+            assertEquals(1, v8UnboundScriptCacheStatistics.getEvictionCount());
+            assertNotNull(v8UnboundScriptCacheStatistics.toString());
+            cachedV8Runtime.resetIsolate();
+            assertEquals(0, cachedV8Runtime.getV8UnboundScriptCacheStatistics().getSize());
+        }
+    }
+}
@@ -51,6 +51,31 @@ public class TestV8ValueString extends BaseTestJavetRuntime {
         }
     }
 
+    @Test
+    public void testRoundTrip() throws JavetException {
+        String[] strings = new String[]{
+                "", "abc", "café", "ÿ\u0080", "a\u0000b", "中文", "😀", "aé中😀"};
+        for (String string : strings) {
+            v8Runtime.getGlobalObject().set("a", string);
+            assertEquals(string.length(), v8Runtime.getExecutor("a.length").executeInteger());
+            assertEquals(string, v8Runtime.getExecutor("a").executeString());
+            assertEquals(string, v8Runtime.getGlobalObject().getString("a"));
+            assertTrue(v8Runtime.getExecutor("a === '" + string.replace("\u0000", "\\0") + "'").executeBoolean());
+        }
+        StringBuilder sb = new StringBuilder();
+        for (int i = 0; i < 1024; ++i) {
+            sb.append((char) ('a' + i % 26));
+        }
+        String longAsciiString = sb.toString();
+        String longLatin1String = longAsciiString + "é";
+        String longTwoByteString = longAsciiString + "中";
+        for (String string : new String[]{longAsciiString, longLatin1String, longTwoByteString}) {
+            v8Runtime.getGlobalObject().set("a", string);
+            assertEquals(string, v8Runtime.getExecutor("a").executeString());
+        }
+        v8Runtime.getGlobalObject().delete("a");
+    }
+
     @Test
     public void testString() throws JavetException {
         try (V8ValueString v8ValueString = v8Runtime.getExecutor("'abc' + 'def'").execute()) {
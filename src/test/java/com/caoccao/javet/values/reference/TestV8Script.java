@@ -17,11 +17,30 @@
 package com.caoccao.javet.values.reference;
 
 import com.caoccao.javet.BaseTestJavetRuntime;
+import com.caoccao.javet.exceptions.JavetError;
 import com.caoccao.javet.exceptions.JavetCompilationException;
 import com.caoccao.javet.exceptions.JavetException;
+import com.caoccao.javet.interop.V8CompileHints;
+import com.caoccao.javet.interop.V8ScriptOrigin;
 import com.caoccao.javet.interop.executors.IV8Executor;
 import org.junit.jupiter.api.Test;
 
+import java.io.ByteArrayInputStream;
+import java.io.IOException;
+import java.nio.channels.FileChannel;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.TimeUnit;
+
 import static org.junit.jupiter.api.Assertions.*;
 
 public class TestV8Script extends BaseTestJavetRuntime {
@@ -51,6 +70,138 @@ public class TestV8Script extends BaseTestJavetRuntime {
         assertEquals(2, iV8Executor.executeInteger());
     }
 
+    @Test
+    public void testCachedDataRejected() throws JavetException {
+        String codeString = "1 + 1";
+        byte[] staleCachedData = new byte[]{1, 2, 3, 4, 5, 6, 7, 8};
+        IV8Executor iV8Executor = v8Runtime.getExecutor(codeString, staleCachedData);
+        assertEquals(2, iV8Executor.executeInteger());
+        assertTrue(iV8Executor.isCachedDataRejected());
+        List<byte[]> freshCachedDataList = new ArrayList<>();
+        v8Runtime.setCodeCacheRejectedCallback((v8ScriptOrigin, scriptString, cachedData) -> {
+            assertEquals(codeString, scriptString);
+            freshCachedDataList.add(cachedData);
+        });
+        try {
+            try (V8Script v8Script = iV8Executor.compileV8Script()) {
+                assertTrue(iV8Executor.isCachedDataRejected());
+                assertEquals(2, v8Script.executeInteger());
+            }
+            assertEquals(1, freshCachedDataList.size());
+            IV8Executor freshV8Executor = v8Runtime.getExecutor(codeString, freshCachedDataList.get(0));
+            assertEquals(2, freshV8Executor.executeInteger());
+            assertFalse(freshV8Executor.isCachedDataRejected());
+            assertEquals(2, iV8Executor.executeInteger());
+            assertTrue(iV8Executor.isCachedDataRejected());
+            assertEquals(2, freshCachedDataList.size());
+        } finally {
+            v8Runtime.setCodeCacheRejectedCallback(null);
+        }
+    }
+
+    @Test
+    public void testCompileAsync() throws JavetException, IOException, InterruptedException, ExecutionException {
+        String resourceName = "./test.js";
+        String codeString = "const a = [1, 2, 3].map(x => x * 2); /* \u4e2d\u6587 */ a.join(',');";
+        byte[] bytes = codeString.getBytes(StandardCharsets.UTF_8);
+        ExecutorService executorService = Executors.newSingleThreadExecutor();
+        Path path = Files.createTempFile("javet-script", ".js");
+        try {
+            try (V8Script v8Script = v8Runtime.compileV8ScriptAsync(
+                    new ByteArrayInputStream(bytes), new V8ScriptOrigin(resourceName), executorService).get()) {
+                assertNotNull(v8Script);
+                assertEquals(resourceName, v8Script.getResourceName());
+                assertEquals("2,4,6", v8Script.executeString());
+            }
+            resetContext();
+            Files.write(path, bytes);
+            try (V8Script v8Script = v8Runtime.compileV8ScriptAsync(
+                    path, new V8ScriptOrigin(resourceName), executorService).get()) {
+                assertEquals("2,4,6", v8Script.executeString());
+            }
+            resetContext();
+            try (FileChannel fileChannel = FileChannel.open(path, StandardOpenOption.READ);
+                 V8Script v8Script = v8Runtime.compileV8ScriptAsync(
+                         fileChannel, new V8ScriptOrigin(resourceName), executorService).get()) {
+                assertEquals("2,4,6", v8Script.executeString());
+            }
+            try {
+                v8Runtime.compileV8ScriptAsync(
+                        new ByteArrayInputStream("a b c".getBytes(StandardCharsets.UTF_8)),
+                        new V8ScriptOrigin(resourceName), executorService).get();
+                fail("Failed to report error.");
+            } catch (ExecutionException e) {
+                assertInstanceOf(JavetCompilationException.class, e.getCause());
+            }
+        } finally {
+            executorService.shutdown();
+            assertTrue(executorService.awaitTermination(10, TimeUnit.SECONDS));
+            Files.deleteIfExists(path);
+        }
+    }
+
+    @Test
+    public void testCompileAsyncWithResetIsolate() throws JavetException, InterruptedException {
+        byte[] bytes = "1 + 1".getBytes(StandardCharsets.UTF_8);
+        CountDownLatch countDownLatch = new CountDownLatch(1);
+        ExecutorService executorService = Executors.newSingleThreadExecutor();
+        try {
+            executorService.execute(() -> {
+                try {
+                    countDownLatch.await();
+                } catch (InterruptedException ignored) {
+                }
+            });
+            CompletableFuture<V8Script> future = v8Runtime.compileV8ScriptAsync(
+                    new ByteArrayInputStream(bytes), new V8ScriptOrigin("./test.js"), executorService);
+            v8Runtime.resetIsolate();
+            countDownLatch.countDown();
+            try {
+                future.get();
+                fail("Failed to report error.");
+            } catch (ExecutionException e) {
+                assertInstanceOf(JavetException.class, e.getCause());
+                assertEquals(JavetError.RuntimeAlreadyClosed, ((JavetException) e.getCause()).getError());
+            }
+            assertEquals(2, v8Runtime.getExecutor("1 + 1").executeInteger());
+        } finally {
+            countDownLatch.countDown();
+            executorService.shutdown();
+            assertTrue(executorService.awaitTermination(10, TimeUnit.SECONDS));
+        }
+    }
+
+    @Test
+    public void testCompileHints() throws JavetException, IOException {
+        String codeString = "function f(a) { return a + 1; } function g(a) { return a + 2; } f(1);";
+        Path path = Files.createTempFile("javet-compile-hints", ".bin");
+        try {
+            V8CompileHints compileHints;
+            try (V8Script v8Script = v8Runtime.getExecutor(codeString).setProduceCompileHints(true).compileV8Script()) {
+                assertTrue(v8Script.getCompileHints().isEmpty());
+                assertEquals(2, v8Script.executeInteger());
+                compileHints = v8Script.getCompileHints();
+            }
+            assertFalse(compileHints.isEmpty());
+            compileHints.save(path);
+            V8CompileHints loadedCompileHints = V8CompileHints.load(path);
+            assertArrayEquals(compileHints.getPositions(), loadedCompileHints.getPositions());
+            assertEquals(compileHints.size(), compileHints.merge(loadedCompileHints).size());
+            resetContext();
+            assertEquals(2, v8Runtime.getExecutor(codeString).setCompileHints(loadedCompileHints).executeInteger());
+            resetContext();
+            try (V8Script v8Script = v8Runtime.getExecutor(codeString).setEagerCompile(true).compileV8Script()) {
+                assertTrue(v8Script.getCompileHints().isEmpty());
+                assertEquals(2, v8Script.executeInteger());
+            }
+            resetContext();
+            assertEquals(2, v8Runtime.getExecutor("//# allFunctionsCalledOnLoad\n" + codeString)
+                    .setFollowCompileHintsMagicComment(true).executeInteger());
+        } finally {
+            Files.deleteIfExists(path);
+        }
+    }
+
     @Test
     public void testExecute() throws JavetException {
         String resourceName = "./test.js";
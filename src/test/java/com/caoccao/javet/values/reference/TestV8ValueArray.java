@@ -60,6 +60,38 @@ public class TestV8ValueArray extends BaseTestJavetRuntime {
         }
     }
 
+    @Test
+    public void testBatchGetPrimitives() throws JavetException {
+        try (V8ValueArray v8ValueArray = v8Runtime.getExecutor(
+                "[1, 2.5, 'a', true, null, 2 ** 40, 3n, 2n ** 64n];").execute()) {
+            double[] doubles = new double[10];
+            assertEquals(8, v8ValueArray.batchGetDoubles(doubles, 0, 10));
+            assertArrayEquals(
+                    new double[]{1, 2.5, Double.NaN, Double.NaN, Double.NaN, 1099511627776D, Double.NaN, Double.NaN},
+                    Arrays.copyOf(doubles, 8));
+            int[] integers = new int[3];
+            boolean[] validities = new boolean[8];
+            assertEquals(3, v8ValueArray.batchGetIntegers(integers, validities, 0, 7));
+            assertArrayEquals(new int[]{1, 0, 0}, integers);
+            assertArrayEquals(new boolean[]{true, false, false}, Arrays.copyOf(validities, 3));
+            long[] longs = new long[7];
+            assertEquals(3, v8ValueArray.batchGetLongs(longs, validities, 5, 8));
+            assertArrayEquals(new long[]{1099511627776L, 3L, 0L}, Arrays.copyOf(longs, 3));
+            assertArrayEquals(new boolean[]{true, true, false}, Arrays.copyOf(validities, 3));
+            boolean[] booleans = new boolean[7];
+            assertEquals(7, v8ValueArray.batchGetBooleans(booleans, validities, 0, 7));
+            assertArrayEquals(new boolean[]{false, false, false, true, false, false, false}, booleans);
+            assertArrayEquals(
+                    new boolean[]{false, false, false, true, false, false, false}, Arrays.copyOf(validities, 7));
+            assertEquals(2, v8ValueArray.batchGetDoubles(doubles, new boolean[2], 0, 7));
+            String[] strings = new String[7];
+            assertEquals(7, v8ValueArray.batchGetStrings(strings, 0, 7));
+            assertArrayEquals(new String[]{null, null, "a", null, null, null, null}, strings);
+            assertEquals(0, v8ValueArray.batchGetDoubles(doubles, 8, 10));
+            assertEquals(0, v8ValueArray.batchGetDoubles(doubles, -1, 10));
+        }
+    }
+
     @Test
     public void testBatchPush() throws JavetException {
         // Test empty array
@@ -171,6 +203,37 @@ public class TestV8ValueArray extends BaseTestJavetRuntime {
         }
     }
 
+    @Test
+    public void testCreateFromPrimitives() throws JavetException {
+        try (V8ValueArray v8ValueArray = v8Runtime.createV8ValueArray(new int[]{1, -2, 3})) {
+            v8Runtime.getGlobalObject().set("a", v8ValueArray);
+            assertEquals("1,-2,3", v8Runtime.getExecutor("a.join()").executeString());
+        }
+        try (V8ValueArray v8ValueArray = v8Runtime.createV8ValueArray(new double[]{1.5, Double.NaN})) {
+            assertEquals(2, v8ValueArray.getLength());
+            assertEquals(1.5D, v8ValueArray.getDouble(0), 0.001D);
+            assertTrue(Double.isNaN(v8ValueArray.getDouble(1)));
+        }
+        try (V8ValueArray v8ValueArray = v8Runtime.createV8ValueArray(new long[]{Long.MAX_VALUE})) {
+            v8Runtime.getGlobalObject().set("a", v8ValueArray);
+            assertEquals("bigint", v8Runtime.getExecutor("typeof a[0]").executeString());
+            assertEquals(Long.MAX_VALUE, v8ValueArray.getLong(0));
+        }
+        try (V8ValueArray v8ValueArray = v8Runtime.createV8ValueArray(new boolean[]{true, false})) {
+            assertTrue(v8ValueArray.getBoolean(0));
+            assertFalse(v8ValueArray.getBoolean(1));
+        }
+        try (V8ValueArray v8ValueArray = v8Runtime.createV8ValueArray(new String[]{"a", null, "\u4e2d"})) {
+            assertEquals("a", v8ValueArray.getString(0));
+            assertTrue(v8ValueArray.get(1).isNull());
+            assertEquals("\u4e2d", v8ValueArray.getString(2));
+        }
+        try (V8ValueArray v8ValueArray = v8Runtime.createV8ValueArray(new int[0])) {
+            assertEquals(0, v8ValueArray.getLength());
+        }
+        v8Runtime.getGlobalObject().delete("a");
+    }
+
     @Test
     public void testForEach() throws JavetException {
         try (V8ValueArray v8ValueArray = v8Runtime.getExecutor("const a = new Array(0,1,2); a;").execute()) {
@@ -21,6 +21,7 @@ import com.caoccao.javet.annotations.V8Function;
 import com.caoccao.javet.annotations.V8Property;
 import com.caoccao.javet.entities.JavetEntityFunction;
 import com.caoccao.javet.enums.JSFunctionType;
+import com.caoccao.javet.enums.V8ValueTypeTag;
 import com.caoccao.javet.exceptions.JavetException;
 import com.caoccao.javet.exceptions.JavetExecutionException;
 import com.caoccao.javet.interfaces.IJavetAnonymous;
@@ -135,6 +136,51 @@ public class TestV8ValueObject extends BaseTestJavetRuntime {
         }
     }
 
+    @Test
+    public void testBatchGetPrimitives() throws JavetException {
+        try (V8ValueObject v8ValueObject = v8Runtime.getExecutor(
+                "const x = {a: 1, b: 2.5, c: 'c', d: true, 1: 3};"
+                        + "Object.defineProperty(x, 'e', { get() { throw new Error('e'); } }); x;").execute()) {
+            V8Value[] v8ValueKeys = new V8Value[]{
+                    v8Runtime.createV8ValueString("a"),
+                    v8Runtime.createV8ValueString("b"),
+                    v8Runtime.createV8ValueString("c"),
+                    v8Runtime.createV8ValueString("d"),
+                    v8Runtime.createV8ValueInteger(1),
+                    v8Runtime.createV8ValueString("x"),
+            };
+            double[] doubles = new double[v8ValueKeys.length];
+            assertEquals(6, v8ValueObject.batchGetDoubles(v8ValueKeys, doubles, v8ValueKeys.length));
+            assertArrayEquals(new double[]{1, 2.5, Double.NaN, Double.NaN, 3, Double.NaN}, doubles);
+            int[] integers = new int[v8ValueKeys.length];
+            boolean[] validities = new boolean[v8ValueKeys.length];
+            assertEquals(6, v8ValueObject.batchGetIntegers(v8ValueKeys, integers, validities, v8ValueKeys.length));
+            assertArrayEquals(new int[]{1, 0, 0, 0, 3, 0}, integers);
+            assertArrayEquals(new boolean[]{true, false, false, false, true, false}, validities);
+            long[] longs = new long[v8ValueKeys.length];
+            assertEquals(6, v8ValueObject.batchGetLongs(v8ValueKeys, longs, v8ValueKeys.length));
+            assertArrayEquals(new long[]{1, 0, 0, 0, 3, 0}, longs);
+            boolean[] booleans = new boolean[v8ValueKeys.length];
+            assertEquals(6, v8ValueObject.batchGetBooleans(v8ValueKeys, booleans, v8ValueKeys.length));
+            assertArrayEquals(new boolean[]{false, false, false, true, false, false}, booleans);
+            String[] strings = new String[v8ValueKeys.length];
+            assertEquals(2, v8ValueObject.batchGetStrings(v8ValueKeys, strings, 2));
+            assertArrayEquals(new String[]{null, null, null, null, null, null}, strings);
+            assertEquals(6, v8ValueObject.batchGetStrings(v8ValueKeys, strings, 10));
+            assertArrayEquals(new String[]{null, null, "c", null, null, null}, strings);
+            V8Value[] v8ValueKeysWithGetter = new V8Value[]{
+                    v8Runtime.createV8ValueString("a"),
+                    v8Runtime.createV8ValueString("e"),
+            };
+            try {
+                v8ValueObject.batchGetDoubles(v8ValueKeysWithGetter, doubles, v8ValueKeysWithGetter.length);
+                fail("Failed to throw exception.");
+            } catch (JavetExecutionException e) {
+                assertEquals("Error: e", e.getMessage());
+            }
+        }
+    }
+
     @Test
     public void testClearWeak() throws JavetException {
         V8ValueObject a = v8Runtime.createV8ValueObject();
@@ -564,6 +610,24 @@ public class TestV8ValueObject extends BaseTestJavetRuntime {
         }
     }
 
+    @Test
+    public void testSetInBatch() throws JavetException {
+        try (V8ValueObject v8ValueObject = v8Runtime.getExecutor(
+                "const x = {}; Object.defineProperty(x, 'c', { set(v) { throw new Error('c'); } }); x;").execute()) {
+            assertTrue(v8ValueObject.set("a", 1, 2, "b"));
+            assertEquals(1, v8ValueObject.getInteger("a"));
+            assertEquals("b", v8ValueObject.getString(2));
+            try {
+                v8ValueObject.set("d", 4, "c", 3, "e", 5);
+                fail("Failed to throw exception.");
+            } catch (JavetExecutionException e) {
+                assertEquals("Error: c", e.getMessage());
+            }
+            assertEquals(4, v8ValueObject.getInteger("d"));
+            assertTrue(v8ValueObject.get("e").isUndefined());
+        }
+    }
+
     @Test
     public void testSetProperty() throws JavetException {
         ZonedDateTime now = ZonedDateTime.now();
@@ -663,6 +727,30 @@ public class TestV8ValueObject extends BaseTestJavetRuntime {
         }
     }
 
+    @Test
+    public void testTypeTag() throws JavetException {
+        assertEquals(V8ValueTypeTag.Null, v8Runtime.createV8ValueNull().getTypeTag());
+        assertEquals(V8ValueTypeTag.Undefined, v8Runtime.createV8ValueUndefined().getTypeTag());
+        assertEquals(V8ValueTypeTag.Integer, v8Runtime.createV8ValueInteger(1).getTypeTag());
+        assertEquals(V8ValueTypeTag.String, v8Runtime.createV8ValueString("a").getTypeTag());
+        assertEquals(V8ValueTypeTag.GlobalObject, v8Runtime.getGlobalObject().getTypeTag());
+        try (V8ValueObject v8ValueObject = v8Runtime.createV8ValueObject();
+             V8ValueArguments v8ValueArguments = v8Runtime.getExecutor(
+                     "(function() { return arguments; })(1, 2)").execute();
+             V8ValueFunction v8ValueFunction = v8Runtime.getExecutor("() => 1").execute()) {
+            assertEquals(V8ValueTypeTag.Object, v8ValueObject.getTypeTag());
+            assertEquals(V8ValueTypeTag.Array, v8ValueArguments.getTypeTag());
+            assertEquals(V8ValueTypeTag.Object, v8ValueFunction.getTypeTag());
+            v8ValueObject.set("a", v8ValueArguments, "b", v8ValueFunction, "c", "x", "d", 1);
+            v8Runtime.getGlobalObject().set("o", v8ValueObject);
+            assertEquals(2, v8Runtime.getExecutor("o.a.length").executeInteger());
+            assertEquals(1, v8Runtime.getExecutor("o.b()").executeInteger());
+            assertEquals("x", v8ValueObject.getString("c"));
+            assertEquals(1, v8ValueObject.getInteger("d"));
+            v8Runtime.getGlobalObject().delete("o");
+        }
+    }
+
     @Test
     public void testToJsonString() throws JavetException {
         try (V8ValueObject v8ValueObject = v8Runtime.getExecutor("const x = {}; x;").execute()) {
@@ -73,6 +73,18 @@ public class TestV8ValueSet extends BaseTestJavetRuntime {
         }
     }
 
+    @Test
+    public void testBatchAdd() throws JavetException {
+        try (V8ValueSet v8ValueSet = v8Runtime.createV8ValueSet()) {
+            assertEquals(0, v8ValueSet.batchAdd());
+            assertEquals(4, v8ValueSet.batchAdd(1, "x", 1, null));
+            assertEquals(3, v8ValueSet.getSize());
+            assertTrue(v8ValueSet.has(1));
+            assertTrue(v8ValueSet.has("x"));
+            assertTrue(v8ValueSet.hasNull());
+        }
+    }
+
     @Test
     public void testClear() throws JavetException {
         try (V8ValueSet v8ValueSet = v8Runtime.createV8ValueSet()) {
@@ -25,8 +25,7 @@ import org.junit.jupiter.api.Test;
 import java.util.Random;
 import java.util.stream.IntStream;
 
-import static org.junit.jupiter.api.Assertions.assertEquals;
-import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assertions.*;
 
 public class TestV8ValueTypedArray extends BaseTestJavetRuntime {
 
@@ -75,6 +74,39 @@ public class TestV8ValueTypedArray extends BaseTestJavetRuntime {
         }
     }
 
+    @Test
+    public void testCreateFromPrimitives() throws JavetException {
+        try (V8ValueTypedArray v8ValueTypedArray = v8Runtime.createV8ValueTypedArray(new double[]{1.5, -2.5})) {
+            assertEquals(V8ValueReferenceType.Float64Array, v8ValueTypedArray.getType());
+            assertArrayEquals(new double[]{1.5, -2.5}, v8ValueTypedArray.toDoubles(), 0.001D);
+        }
+        try (V8ValueTypedArray v8ValueTypedArray = v8Runtime.createV8ValueTypedArray(new int[]{1, -2, 3})) {
+            assertEquals(V8ValueReferenceType.Int32Array, v8ValueTypedArray.getType());
+            assertArrayEquals(new int[]{1, -2, 3}, v8ValueTypedArray.toIntegers());
+        }
+        try (V8ValueTypedArray v8ValueTypedArray = v8Runtime.createV8ValueTypedArray(new long[]{Long.MIN_VALUE})) {
+            assertEquals(V8ValueReferenceType.BigInt64Array, v8ValueTypedArray.getType());
+            assertArrayEquals(new long[]{Long.MIN_VALUE}, v8ValueTypedArray.toLongs());
+        }
+        try (V8ValueTypedArray v8ValueTypedArray = v8Runtime.createV8ValueTypedArray(new int[0])) {
+            assertEquals(0, v8ValueTypedArray.getLength());
+        }
+    }
+
+    @Test
+    public void testDetached() throws JavetException {
+        try (V8ValueTypedArray v8ValueTypedArray = v8Runtime.getExecutor(
+                "const a = new Int32Array([1, 2, 3, 4]); a;").execute()) {
+            assertArrayEquals(new int[]{1, 2, 3, 4}, v8ValueTypedArray.toIntegers());
+            v8Runtime.getExecutor("const b = a.buffer.transfer();").executeVoid();
+            assertEquals(0, v8ValueTypedArray.getByteBuffer().capacity());
+            assertArrayEquals(new int[0], v8ValueTypedArray.toIntegers());
+            assertFalse(v8ValueTypedArray.fromIntegers(new int[]{5, 6, 7, 8}));
+            assertFalse(v8ValueTypedArray.toIntegers(0, new int[4], 0, 4));
+            assertEquals("1,2,3,4", v8Runtime.getExecutor("new Int32Array(b).join(',')").executeString());
+        }
+    }
+
     @Test
     public void testDouble() throws JavetException {
         final int length = 16;
@@ -269,6 +301,38 @@ public class TestV8ValueTypedArray extends BaseTestJavetRuntime {
         }
     }
 
+    @Test
+    public void testOffsetViewAndRegion() throws JavetException {
+        v8Runtime.getExecutor("const buffer = new ArrayBuffer(64);" +
+                "new Int8Array(buffer).fill(-1);" +
+                "const a = new Int32Array(buffer, 16, 4);" +
+                "const b = new Float64Array(buffer, 32, 4);").executeVoid();
+        try (V8ValueTypedArray v8ValueTypedArray = v8Runtime.getExecutor("a").execute()) {
+            assertEquals(16, v8ValueTypedArray.getByteBuffer().capacity());
+            assertTrue(v8ValueTypedArray.fromIntegers(new int[]{1, 2, 3, 4}));
+            assertArrayEquals(new int[]{1, 2, 3, 4}, v8ValueTypedArray.toIntegers());
+            assertEquals(-1, v8Runtime.getExecutor("new Int32Array(buffer, 12, 1)[0]").executeInteger());
+            assertEquals(-1, v8Runtime.getExecutor("new Int32Array(buffer, 32, 1)[0]").executeInteger());
+            int[] integers = new int[]{0, 0, 0, 0, 0};
+            assertTrue(v8ValueTypedArray.toIntegers(1, integers, 2, 3));
+            assertArrayEquals(new int[]{0, 0, 2, 3, 4}, integers);
+            assertTrue(v8ValueTypedArray.fromIntegers(0, new int[]{7, 8, 9}, 1, 2));
+            assertEquals("8,9,3,4", v8Runtime.getExecutor("a.join(',')").executeString());
+            assertFalse(v8ValueTypedArray.toIntegers(3, integers, 0, 2));
+            assertFalse(v8ValueTypedArray.toIntegers(0, integers, 4, 2));
+            assertFalse(v8ValueTypedArray.toLongs(0, new long[4], 0, 4));
+        }
+        try (V8ValueTypedArray v8ValueTypedArray = v8Runtime.getExecutor("b").execute()) {
+            double[] doubles = new double[]{1.5D, 2.5D, 3.5D, 4.5D};
+            assertTrue(v8ValueTypedArray.fromDoubles(0, doubles, 0, doubles.length));
+            assertEquals(1.5D, v8ValueTypedArray.getByteBuffer().asDoubleBuffer().get(0), 0.001D);
+            double[] copiedDoubles = new double[doubles.length];
+            assertTrue(v8ValueTypedArray.toDoubles(0, copiedDoubles, 0, copiedDoubles.length));
+            assertArrayEquals(doubles, copiedDoubles, 0.001D);
+            assertEquals(4.5D, v8Runtime.getExecutor("b[3]").executeDouble(), 0.001D);
+        }
+    }
+
     @Test
     public void testShort() throws JavetException {
         final int length = 16;